@@ -142,6 +142,39 @@ extern OCIOEXPORT void ResetToDefaultLoggingFunction();
 //!cpp:function:: Log a message using the library logging function.
 extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 
+//!cpp:function:: Set the directory of the on-disk LUT cache. The parsed content of the
+// LUT files is stored there in a binary form so other processes do not parse the same
+// LUT files again. An empty string (the default) disables the cache. The default value
+// comes from the :envvar:`OCIO_LUT_CACHE_DIR` environment variable.
+extern OCIOEXPORT void SetLutCacheDirectory(const char * directory);
+//!cpp:function:: Another call to :cpp:func:`SetLutCacheDirectory` modifies the string
+// obtained from a previous call.
+extern OCIOEXPORT const char * GetLutCacheDirectory();
+
+//!cpp:function:: Set the maximum size in bytes of the on-disk LUT cache. The oldest
+// entries are removed when the size is exceeded. The default value comes from the
+// :envvar:`OCIO_LUT_CACHE_MAX_SIZE` environment variable (in megabytes), or is 512 MB.
+extern OCIOEXPORT void SetLutCacheMaxSize(unsigned long long maxSize);
+//!cpp:function::
+extern OCIOEXPORT unsigned long long GetLutCacheMaxSize();
+
+//!cpp:function:: Enable the lazy loading of the files of the :cpp:class:`FileTransform`.
+// When enabled, creating a processor only identifies the files (i.e. their paths and fast
+// hashes) and the files are loaded when the ops are needed, for example when creating the
+// CPU or GPU processors. The processor metadata, cache id and no-op state are available
+// without loading the files. The default value comes from the
+// :envvar:`OCIO_LAZY_FILE_LOADING` environment variable, or is false.
+extern OCIOEXPORT void SetLazyFileLoading(bool lazy);
+//!cpp:function::
+extern OCIOEXPORT bool IsLazyFileLoading();
+
+//!cpp:function:: Get the memory used by the LUT values. The LUTs holding the same values
+// share them, so the unique size is the memory actually used by the LUT values whereas the
+// logical size is the memory the LUTs would use without sharing their values. Both sizes
+// are in bytes.
+extern OCIOEXPORT void GetLutMemoryUsage(unsigned long long & uniqueSize,
+                                         unsigned long long & logicalSize);
+
 //
 // Note that the following env. variable access methods are not thread safe.
 //
@@ -1092,6 +1125,12 @@ public:
     ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
+    //!cpp:function:: Same as above but also specifies the maximum error allowed by the
+    // OPTIMIZATION_BAKE_LUT3D optimization (default is 1e-3).
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    float bakeMaxError) const;
 
 private:
     Processor();
@@ -1136,6 +1175,14 @@ public:
     //!cpp:function:: Refer to :cpp:func:`GPUProcessor::getDynamicProperty`.
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 
+    //!cpp:function:: Number of pixels processed by the neutral axis table since the creation
+    // of the processor (refer to OPTIMIZATION_NEUTRAL_AXIS).
+    size_t getNumNeutralAxisPixels() const;
+
+    //!cpp:function:: Number of pixels whose processing was skipped because they repeat the
+    // previous pixel since the creation of the processor (refer to OPTIMIZATION_RUN_LENGTH).
+    size_t getNumSkippedPixels() const;
+
     ///////////////////////////////////////////////////////////////////////////
     //!rst::
     // Apply to an image with any kind of channel ordering while respecting
@@ -1368,6 +1415,13 @@ public:
     // default: <format specific>
     void setCubeSize(int cubesize);
 
+    //!cpp:function::
+    int getNumThreads() const;
+    //!cpp:function:: Set the number of threads used to evaluate the baked LUT values. Default
+    // value is 0, which uses the number of hardware threads. A value of 1 evaluates the values
+    // on the calling thread only.
+    void setNumThreads(int numThreads);
+
     //!cpp:function:: Bake the LUT into the output stream.
     void bake(std::ostream & os) const;
 
@@ -458,6 +458,48 @@ enum OptimizationFlags : unsigned long
     // finalization (e.g. ExposureContrast).
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x00020000,
 
+    // Replace any run of separable ops (i.e. no channel crosstalk ops) containing a 1D LUT
+    // by a single 1D LUT.  The LUT size is selected so that the error stays well below the
+    // precision of a 16-bit integer.  As it is lossy (i.e. errors up to 1e-5), it is not
+    // part of OPTIMIZATION_VERY_GOOD.
+    OPTIMIZATION_COMP_SEPARABLE_LUT1D            = 0x00040000,
+
+    // Replace any run of expensive ops (e.g. fixed functions, logs with a matrix) by a shaper
+    // 1D LUT and a 3D LUT.  The 3D LUT size is selected to meet a maximum error (see
+    // Processor::getOptimizedCPUProcessor) that is verified on a set of colors within
+    // [-64, 64].  The ops are kept if the error can not be met.  It is not part of any
+    // optimization level other than OPTIMIZATION_DRAFT.
+    OPTIMIZATION_BAKE_LUT3D                      = 0x00080000,
+
+    // Fuse the matrix and range ops surrounding a 3D LUT into the input and output stages of
+    // the 3D LUT so that the CPU processes them in a single pass over the pixels.
+    OPTIMIZATION_FUSE_LUT3D_STAGES               = 0x00100000,
+
+    // For the CPU processor in SSE mode, use the fast approximations of the log, exp and pow
+    // functions (i.e. about 15 bits of mantissa) instead of the accurate ones (i.e. within
+    // 1 ulp of the exact result).
+    OPTIMIZATION_FAST_LOG_EXP_POW                = 0x00200000,
+
+    // For the CPU processor, process the runs of achromatic pixels (i.e. R == G == B) with a
+    // table holding the response of the color transformation along the neutral axis. Only the
+    // pixels whose value is a sample of the table (i.e. all the integer code values of the
+    // input bit-depth, or all the half float values for float input bit-depths) use the table,
+    // so that their results are unchanged.
+    OPTIMIZATION_NEUTRAL_AXIS                    = 0x00400000,
+
+    // With OPTIMIZATION_NEUTRAL_AXIS, also process the achromatic 32-bit float values falling
+    // between two samples of the table using a linear interpolation.
+    OPTIMIZATION_NEUTRAL_AXIS_INTERPOLATION      = 0x00800000,
+
+    // For the CPU processor, detect the runs of identical pixels so that only the first pixel
+    // of each run is processed, its result being copied to the other pixels of the run.
+    OPTIMIZATION_RUN_LENGTH                      = 0x01000000,
+
+    // For the CPU processor, apply the range ops within the pass over the pixels of a
+    // neighbouring matrix, 1D LUT or 3D LUT op (i.e. as an input or output stage) instead of
+    // in a separate pass.
+    OPTIMIZATION_FUSE_RANGE                      = 0x02000000,
+
     // Apply all possible optimizations.
     OPTIMIZATION_ALL                             = 0xFFFFFFFF,
 
@@ -476,14 +518,19 @@ enum OptimizationFlags : unsigned long
                                 OPTIMIZATION_COMP_EXPONENT |
                                 OPTIMIZATION_COMP_GAMMA |
                                 OPTIMIZATION_COMP_MATRIX |
-                                OPTIMIZATION_COMP_RANGE),
+                                OPTIMIZATION_COMP_RANGE |
+                                OPTIMIZATION_FUSE_LUT3D_STAGES |
+                                OPTIMIZATION_FUSE_RANGE),
 
     OPTIMIZATION_VERY_GOOD  = (OPTIMIZATION_LOSSLESS |
                                 OPTIMIZATION_COMP_LUT1D |
                                 OPTIMIZATION_LUT_INV_FAST |
-                                OPTIMIZATION_COMP_SEPARABLE_PREFIX),
+                                OPTIMIZATION_COMP_SEPARABLE_PREFIX |
+                                OPTIMIZATION_FAST_LOG_EXP_POW),
 
-    OPTIMIZATION_GOOD       = OPTIMIZATION_VERY_GOOD | OPTIMIZATION_COMP_LUT3D,
+    OPTIMIZATION_GOOD       = (OPTIMIZATION_VERY_GOOD |
+                                OPTIMIZATION_COMP_LUT3D |
+                                OPTIMIZATION_COMP_SEPARABLE_LUT1D),
 
     // For quite lossy optimizations.
     OPTIMIZATION_DRAFT      = OPTIMIZATION_ALL,
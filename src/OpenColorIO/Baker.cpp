@@ -36,10 +36,12 @@ public:
     std::string m_targetSpace;
     int m_shapersize;
     int m_cubesize;
+    int m_numThreads;
 
     Impl() :
         m_shapersize(-1),
-        m_cubesize(-1)
+        m_cubesize(-1),
+        m_numThreads(0)
     {
     }
 
@@ -62,6 +64,7 @@ public:
             m_targetSpace = rhs.m_targetSpace;
             m_shapersize = rhs.m_shapersize;
             m_cubesize = rhs.m_cubesize;
+            m_numThreads = rhs.m_numThreads;
         }
         return *this;
     }
@@ -205,6 +208,20 @@ int Baker::getCubeSize() const
     return getImpl()->m_cubesize;
 }
 
+void Baker::setNumThreads(int numThreads)
+{
+    if (numThreads < 0)
+    {
+        throw Exception("The number of threads cannot be negative.");
+    }
+    getImpl()->m_numThreads = numThreads;
+}
+
+int Baker::getNumThreads() const
+{
+    return getImpl()->m_numThreads;
+}
+
 void Baker::bake(std::ostream & os) const
 {
     FileFormat* fmt = FormatRegistry::GetInstance().getFileFormatByName(getImpl()->m_formatName);
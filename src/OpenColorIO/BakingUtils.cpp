@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BakingUtils.h"
+#include "Platform.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Number of pixels generated and evaluated at once (i.e. small enough to stay in the cache).
+static constexpr long BLOCK_NUM_PIXELS = 4096;
+
+// Minimum number of pixels per thread to benefit from the threads.
+static constexpr long MIN_THREAD_NUM_PIXELS = 4 * BLOCK_NUM_PIXELS;
+
+// Process the pixels by blocks of BLOCK_NUM_PIXELS pixels, the blocks being processed
+// concurrently by the baker threads.
+void ParallelBake(const Baker & baker,
+                  long numPixels,
+                  const std::function<void(long first, long last)> & processBlock)
+{
+    if (numPixels <= 0)
+    {
+        return;
+    }
+
+    // Note: The threads are also limited by the thread budget of the library.
+    const long maxThreads = baker.getNumThreads() > 0
+        ? long(baker.getNumThreads())
+        : long(std::max(1u, std::thread::hardware_concurrency()));
+    const long numThreads
+        = std::min(maxThreads, std::max(1L, numPixels / MIN_THREAD_NUM_PIXELS));
+
+    const long numBlocks = (numPixels + BLOCK_NUM_PIXELS - 1) / BLOCK_NUM_PIXELS;
+
+    Platform::ParallelFor(size_t(numBlocks), [&](size_t idx)
+    {
+        const long first = long(idx) * BLOCK_NUM_PIXELS;
+        processBlock(first, std::min(numPixels, first + BLOCK_NUM_PIXELS));
+    }, unsigned(numThreads));
+}
+
+void ApplyProcessors(const ConstCPUProcessorVec & processors, float * rgb, long numPixels)
+{
+    PackedImageDesc img(rgb, numPixels, 1, 3);
+    for (const auto & processor : processors)
+    {
+        processor->apply(img);
+    }
+}
+
+} // anon.
+
+void ApplyBakerProcessors(const Baker & baker,
+                          const ConstCPUProcessorVec & processors,
+                          float * rgb,
+                          long numPixels)
+{
+    ParallelBake(baker, numPixels, [&](long first, long last)
+    {
+        ApplyProcessors(processors, rgb + 3 * first, last - first);
+    });
+}
+
+std::vector<float> BakeLut3D(const Baker & baker,
+                             int edgeLen,
+                             Lut3DOrder lut3DOrder,
+                             const ConstCPUProcessorVec & processors)
+{
+    if (lut3DOrder != LUT3DORDER_FAST_RED && lut3DOrder != LUT3DORDER_FAST_BLUE)
+    {
+        throw Exception("Unknown Lut3DOrder.");
+    }
+
+    const long numPixels = long(edgeLen) * edgeLen * edgeLen;
+    std::vector<float> values(3 * numPixels);
+
+    // Same values as GenerateIdentityLut3D().
+    const float c = 1.0f / ((float)edgeLen - 1.0f);
+    const int fastChannel = lut3DOrder == LUT3DORDER_FAST_RED ? 0 : 2;
+
+    ParallelBake(baker, numPixels, [&](long first, long last)
+    {
+        float * rgb = values.data() + 3 * first;
+        for (long i = first; i < last; ++i, rgb += 3)
+        {
+            rgb[fastChannel]     = (float)(i % edgeLen) * c;
+            rgb[1]               = (float)((i / edgeLen) % edgeLen) * c;
+            rgb[2 - fastChannel] = (float)((i / edgeLen / edgeLen) % edgeLen) * c;
+        }
+
+        ApplyProcessors(processors, values.data() + 3 * first, last - first);
+    });
+
+    return values;
+}
+
+std::vector<float> BakeLut1D(const Baker & baker,
+                             int numElements,
+                             const ConstCPUProcessorVec & processors)
+{
+    std::vector<float> values(3 * size_t(numElements));
+
+    // Same values as GenerateIdentityLut1D().
+    const float scale = 1.0f / ((float)numElements - 1.0f);
+
+    ParallelBake(baker, numElements, [&](long first, long last)
+    {
+        float * rgb = values.data() + 3 * first;
+        for (long i = first; i < last; ++i, rgb += 3)
+        {
+            rgb[0] = rgb[1] = rgb[2] = scale * (float)(i);
+        }
+
+        ApplyProcessors(processors, values.data() + 3 * first, last - first);
+    });
+
+    return values;
+}
+
+} // namespace OCIO_NAMESPACE
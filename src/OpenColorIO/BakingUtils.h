@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_BAKINGUTILS_H
+#define INCLUDED_OCIO_BAKINGUTILS_H
+
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut3d/Lut3DOp.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Evaluation stage shared by the LUT bakers. The domains of the baked LUTs (i.e. the shaper
+// and the cube) are split in blocks which are generated and evaluated concurrently by the
+// threads of the baker (see Baker::setNumThreads()), each block going through all the
+// processors while it is in the cache.
+
+typedef std::vector<ConstCPUProcessorRcPtr> ConstCPUProcessorVec;
+
+// Apply the processors, in sequence, to the packed RGB values.
+void ApplyBakerProcessors(const Baker & baker,
+                          const ConstCPUProcessorVec & processors,
+                          float * rgb,
+                          long numPixels);
+
+// Return the identity 3D LUT with three channels (i.e. the cube domain), in the given order,
+// evaluated by the processors.
+std::vector<float> BakeLut3D(const Baker & baker,
+                             int edgeLen,
+                             Lut3DOrder lut3DOrder,
+                             const ConstCPUProcessorVec & processors);
+
+// Return the identity 1D LUT with three channels (i.e. the shaper domain) evaluated by the
+// processors.
+std::vector<float> BakeLut1D(const Baker & baker,
+                             int numElements,
+                             const ConstCPUProcessorVec & processors);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -1,17 +1,20 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "CPUProcessor.h"
+#include "MathUtils.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
 #include "ScanlineHelper.h"
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
@@ -119,6 +122,78 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+namespace
+{
+
+// An op with the range ops fused into its input and output (see OPTIMIZATION_FUSE_RANGE).
+struct RangeFusedOp
+{
+    ConstOpRcPtr m_op;
+    ConstRangeOpDataRcPtr m_preRange;
+    ConstRangeOpDataRcPtr m_postRange;
+
+    bool isFused() const { return m_preRange || m_postRange; }
+
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const
+    {
+        ConstRangeOpDataRcPtr preRange = m_preRange;
+        ConstRangeOpDataRcPtr postRange = m_postRange;
+        return GetRangeFusedRenderer(preRange, m_op->getCPUOp(oFlags), postRange);
+    }
+};
+
+bool IsRangeOp(const ConstOpRcPtr & op)
+{
+    return op->data()->getType() == OpData::RangeType;
+}
+
+// Group the range ops with their neighbouring matrix, 1D LUT or 3D LUT op, the range being
+// preferably fused into the output of the preceding op.
+void FuseRangeOps(const OpRcPtrVec & ops, BitDepth in, BitDepth out,
+                  std::vector<RangeFusedOp> & fusedOps)
+{
+    const size_t maxOps = ops.size();
+
+    // The first and last 1D LUTs keep their specific renderers for the integer bit-depths.
+    auto isTarget = [&](size_t idx) -> bool
+    {
+        ConstOpRcPtr op = ops[idx];
+        const OpData::Type type = op->data()->getType();
+        if (type == OpData::Lut1DType)
+        {
+            return !(idx == 0 && in != BIT_DEPTH_F32)
+                && !(idx == maxOps - 1 && out != BIT_DEPTH_F32);
+        }
+        return type == OpData::MatrixType || type == OpData::Lut3DType;
+    };
+
+    ConstRangeOpDataRcPtr preRange;
+    for (size_t idx = 0; idx < maxOps; ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        if (IsRangeOp(op))
+        {
+            ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(op->data());
+
+            if (!fusedOps.empty() && !fusedOps.back().m_postRange && isTarget(idx - 1))
+            {
+                fusedOps.back().m_postRange = range;
+                continue;
+            }
+            if (idx + 1 < maxOps && !IsRangeOp(ops[idx + 1]) && isTarget(idx + 1))
+            {
+                preRange = range;
+                continue;
+            }
+        }
+
+        fusedOps.push_back({ op, preRange, ConstRangeOpDataRcPtr() });
+        preRange.reset();
+    }
+}
+
+} // anon.
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
@@ -127,29 +202,47 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
                      // The remaining CPU Ops.
                      ConstOpCPURcPtrVec & cpuOps,
                      // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     ConstOpCPURcPtr & outBitDepthOp,
+                     // The optimization flags used to create the CPU Ops.
+                     OptimizationFlags oFlags)
 {
-    const size_t maxOps = ops.size();
+    std::vector<RangeFusedOp> fusedOps;
+    if((oFlags & OPTIMIZATION_FUSE_RANGE) == OPTIMIZATION_FUSE_RANGE)
+    {
+        FuseRangeOps(ops, in, out, fusedOps);
+    }
+    else
+    {
+        for(const auto & op : ops)
+        {
+            fusedOps.push_back({ op, ConstRangeOpDataRcPtr(), ConstRangeOpDataRcPtr() });
+        }
+    }
+
+    const size_t maxOps = fusedOps.size();
     for(size_t idx=0; idx<maxOps; ++idx)
     {
-        ConstOpRcPtr op = ops[idx];
+        const RangeFusedOp & fusedOp = fusedOps[idx];
+        ConstOpRcPtr op = fusedOp.m_op;
         ConstOpDataRcPtr opData = op->data();
 
         if(idx==0)
         {
-            if(opData->getType()==OpData::Lut1DType)
+            if(opData->getType()==OpData::Lut1DType && !fusedOp.isFused())
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
             }
-            else if(in==BIT_DEPTH_F32)
+            // The ops with dynamic properties are applied with the values latched by the
+            // processor so they are never applied by the bit-depth conversions.
+            else if(in==BIT_DEPTH_F32 && !op->isDynamic())
             {
-                inBitDepthOp = op->getCPUOp();
+                inBitDepthOp = fusedOp.getCPUOp(oFlags);
             }
             else
             {
                 inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp());
+                cpuOps.push_back(fusedOp.getCPUOp(oFlags));
             }
 
             if(maxOps==1)
@@ -159,24 +252,24 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
         }
         else if(idx==(maxOps-1))
         {
-            if(opData->getType()==OpData::Lut1DType)
+            if(opData->getType()==OpData::Lut1DType && !fusedOp.isFused())
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
                 outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
             }
-            else if(out==BIT_DEPTH_F32)
+            else if(out==BIT_DEPTH_F32 && !op->isDynamic())
             {
-                outBitDepthOp = op->getCPUOp();
+                outBitDepthOp = fusedOp.getCPUOp(oFlags);
             }
             else
             {
                 outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp());
+                cpuOps.push_back(fusedOp.getCPUOp(oFlags));
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp());
+            cpuOps.push_back(fusedOp.getCPUOp(oFlags));
         }
     }
 }
@@ -237,6 +330,292 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+namespace
+{
+
+// The achromatic pixels are only processed by the neutral axis table when they are part of a
+// run long enough so that the other pixels are still processed by blocks.
+constexpr long NEUTRAL_AXIS_MIN_RUN = 8;
+
+// Only the runs of identical pixels long enough are worth splitting the processing by blocks.
+constexpr long RUN_LENGTH_MIN_RUN = 4;
+
+inline bool IsSamePixel(const float * rgba1, const float * rgba2)
+{
+#ifdef USE_SSE
+    // Compare the bit patterns so that the NaN values are also detected.
+    const __m128i pxl1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgba1));
+    const __m128i pxl2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgba2));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(pxl1, pxl2)) == 0xFFFF;
+#else
+    return memcmp(rgba1, rgba2, 4 * sizeof(float)) == 0;
+#endif
+}
+
+// Get the 32-bit float values of all the integer code values of the input bit-depth.
+template<BitDepth inBD>
+void ComputeCodeValues(const ConstOpCPURcPtr & inBitDepthOp, std::vector<float> & values)
+{
+    typedef typename BitDepthInfo<inBD>::Type InType;
+
+    const size_t numValues = size_t(BitDepthInfo<inBD>::maxValue) + 1;
+
+    std::vector<InType> codes(4 * numValues, InType(0));
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        codes[4 * idx + 0] = InType(idx);
+        codes[4 * idx + 1] = InType(idx);
+        codes[4 * idx + 2] = InType(idx);
+    }
+
+    // Use the same conversion as the one applied to the image.
+    std::vector<float> rgba(4 * numValues);
+    inBitDepthOp->apply(&codes[0], &rgba[0], long(numValues));
+
+    values.resize(numValues);
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        values[idx] = rgba[4 * idx];
+    }
+}
+
+// Process the achromatic pixels of the values with the CPU ops.
+void ComputeNeutralAxis(const ConstOpCPURcPtrVec & cpuOps,
+                        const std::vector<float> & values,
+                        float alpha,
+                        std::vector<float> & rgba)
+{
+    const size_t numValues = values.size();
+
+    rgba.resize(4 * numValues);
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        rgba[4 * idx + 0] = values[idx];
+        rgba[4 * idx + 1] = values[idx];
+        rgba[4 * idx + 2] = values[idx];
+        rgba[4 * idx + 3] = alpha;
+    }
+
+    for (const auto & op : cpuOps)
+    {
+        op->apply(&rgba[0], &rgba[0], long(numValues));
+    }
+}
+
+inline bool IsSameValue(float val1, float val2)
+{
+    return val1 == val2 || (IsNan(val1) && IsNan(val2));
+}
+
+// Half float bit pattern of the value preceding (i.e. smaller than) the one of 'bits'.
+inline size_t PreviousHalf(size_t bits)
+{
+    if (bits == 0x0000 || bits == 0x8000)
+    {
+        return 0x8001;
+    }
+    return (bits & 0x8000) ? bits + 1 : bits - 1;
+}
+
+// Half float bit pattern of the value following (i.e. greater than) the one of 'bits'.
+inline size_t NextHalf(size_t bits)
+{
+    if (bits == 0x0000 || bits == 0x8000)
+    {
+        return 0x0001;
+    }
+    if (bits == 0x8001)
+    {
+        return 0x0000;
+    }
+    return (bits & 0x8000) ? bits - 1 : bits + 1;
+}
+
+inline bool IsHalfFinite(size_t bits)
+{
+    return (bits & 0x7C00) != 0x7C00;
+}
+
+} // anon.
+
+void NeutralAxisTable::clear()
+{
+    m_inValues.clear();
+    m_rgbValues.clear();
+    m_halfDomain    = false;
+    m_interpolation = false;
+    m_maxCodeValue  = 0.0f;
+}
+
+void NeutralAxisTable::build(BitDepth in,
+                             const ConstOpCPURcPtr & inBitDepthOp,
+                             const ConstOpCPURcPtrVec & cpuOps,
+                             bool interpolation)
+{
+    clear();
+
+    switch (in)
+    {
+        case BIT_DEPTH_UINT8:
+            ComputeCodeValues<BIT_DEPTH_UINT8>(inBitDepthOp, m_inValues);
+            break;
+        case BIT_DEPTH_UINT10:
+            ComputeCodeValues<BIT_DEPTH_UINT10>(inBitDepthOp, m_inValues);
+            break;
+        case BIT_DEPTH_UINT12:
+            ComputeCodeValues<BIT_DEPTH_UINT12>(inBitDepthOp, m_inValues);
+            break;
+        case BIT_DEPTH_UINT16:
+            ComputeCodeValues<BIT_DEPTH_UINT16>(inBitDepthOp, m_inValues);
+            break;
+        case BIT_DEPTH_F16:
+        case BIT_DEPTH_F32:
+        {
+            // Sample all the half float values.
+            m_inValues.resize(65536);
+            half val;
+            for (size_t idx = 0; idx < m_inValues.size(); ++idx)
+            {
+                val.setBits((unsigned short)idx);
+                m_inValues[idx] = val;
+            }
+            m_halfDomain = true;
+            break;
+        }
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            throw Exception("Unsupported bit-depth");
+    }
+
+    m_maxCodeValue  = float(m_inValues.size() - 1);
+    m_interpolation = m_halfDomain && interpolation;
+
+    std::vector<float> opaque, translucent;
+    ComputeNeutralAxis(cpuOps, m_inValues, 1.0f,  opaque);
+    ComputeNeutralAxis(cpuOps, m_inValues, 0.25f, translucent);
+
+    // The table only holds the RGB values so the color processing must preserve the alpha,
+    // and ignore it.
+    for (size_t idx = 0; idx < m_inValues.size(); ++idx)
+    {
+        if (m_halfDomain && !IsHalfFinite(idx))
+        {
+            continue;
+        }
+
+        const float * rgba1 = &opaque[4 * idx];
+        const float * rgba2 = &translucent[4 * idx];
+        if (!IsSameValue(rgba1[0], rgba2[0]) || !IsSameValue(rgba1[1], rgba2[1])
+            || !IsSameValue(rgba1[2], rgba2[2]) || rgba1[3] != 1.0f || rgba2[3] != 0.25f)
+        {
+            clear();
+            return;
+        }
+    }
+
+    m_rgbValues.resize(3 * m_inValues.size());
+    for (size_t idx = 0; idx < m_inValues.size(); ++idx)
+    {
+        m_rgbValues[3 * idx + 0] = opaque[4 * idx + 0];
+        m_rgbValues[3 * idx + 1] = opaque[4 * idx + 1];
+        m_rgbValues[3 * idx + 2] = opaque[4 * idx + 2];
+    }
+}
+
+inline bool NeutralAxisTable::find(float value, size_t & idx0, size_t & idx1, float & ratio) const
+{
+    ratio = 0.0f;
+
+    if (m_halfDomain)
+    {
+        idx0 = half(value).bits();
+        idx1 = idx0;
+
+        // The infinite and NaN values are always processed by the ops.
+        if (!IsHalfFinite(idx0))
+        {
+            return false;
+        }
+
+        if (m_inValues[idx0] == value)
+        {
+            return true;
+        }
+
+        if (!m_interpolation)
+        {
+            return false;
+        }
+
+        // Find the samples surrounding the value.
+        if (m_inValues[idx0] > value)
+        {
+            idx0 = PreviousHalf(idx0);
+        }
+        idx1 = NextHalf(idx0);
+
+        if (!IsHalfFinite(idx0) || !IsHalfFinite(idx1))
+        {
+            return false;
+        }
+
+        ratio = (value - m_inValues[idx0]) / (m_inValues[idx1] - m_inValues[idx0]);
+        return true;
+    }
+
+    // Note that the comparisons are false for NaN.
+    const float code = value * m_maxCodeValue + 0.5f;
+    if (!(code >= 0.0f && code < m_maxCodeValue + 1.0f))
+    {
+        return false;
+    }
+
+    idx0 = size_t(code);
+    idx1 = idx0;
+    return m_inValues[idx0] == value;
+}
+
+bool NeutralAxisTable::isProcessed(const float * rgba) const
+{
+    if (rgba[0] != rgba[1] || rgba[0] != rgba[2])
+    {
+        return false;
+    }
+
+    size_t idx0 = 0, idx1 = 0;
+    float ratio = 0.0f;
+    return find(rgba[0], idx0, idx1, ratio);
+}
+
+void NeutralAxisTable::apply(float * rgba, long numPixels) const
+{
+    for (long pxl = 0; pxl < numPixels; ++pxl)
+    {
+        size_t idx0 = 0, idx1 = 0;
+        float ratio = 0.0f;
+        find(rgba[0], idx0, idx1, ratio);
+
+        const float * rgb0 = &m_rgbValues[3 * idx0];
+        if (idx0 == idx1)
+        {
+            rgba[0] = rgb0[0];
+            rgba[1] = rgb0[1];
+            rgba[2] = rgb0[2];
+        }
+        else
+        {
+            const float * rgb1 = &m_rgbValues[3 * idx1];
+            rgba[0] = rgb0[0] + ratio * (rgb1[0] - rgb0[0]);
+            rgba[1] = rgb0[1] + ratio * (rgb1[1] - rgb0[1]);
+            rgba[2] = rgb0[2] + ratio * (rgb1[2] - rgb0[2]);
+        }
+
+        rgba += 4;
+    }
+}
+
 DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType type) const
 {
     if (m_inBitDepthOp->hasDynamicProperty(type))
@@ -262,14 +641,15 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
 
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+                       OptimizationFlags oFlags,
+                       float bakeMaxError)
 {
     ops = rawOps;
 
     if(!ops.empty())
     {
         // Optimize the ops.
-        OptimizeOpVec(ops, in, out, oFlags);
+        OptimizeOpVec(ops, in, out, oFlags, bakeMaxError);
     }
 
     if(ops.empty())
@@ -303,12 +683,13 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
 
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
+                                  OptimizationFlags oFlags,
+                                  float bakeMaxError)
 {
     AutoMutex lock(m_mutex);
 
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags, bakeMaxError);
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -330,7 +711,70 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cpuOps.clear();
     m_inBitDepthOp = nullptr;
     m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    m_neutralAxis.clear();
+    m_runLength = (oFlags & OPTIMIZATION_RUN_LENGTH) == OPTIMIZATION_RUN_LENGTH;
+
+    // The neutral axis table is not usable when dynamic properties could change the color
+    // processing.
+
+    bool neutralAxis
+        = (oFlags & OPTIMIZATION_NEUTRAL_AXIS) == OPTIMIZATION_NEUTRAL_AXIS;
+    for(const auto & op : ops)
+    {
+        if(op->isDynamic())
+        {
+            neutralAxis = false;
+            break;
+        }
+    }
+
+    if(neutralAxis)
+    {
+        // The table holds the response of all the ops, so the input and output bit-depth
+        // conversions must not be done by the first and last ops.
+
+        m_inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
+        for(const auto & op : ops)
+        {
+            m_cpuOps.push_back(op->getCPUOp(oFlags));
+        }
+        m_outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+
+        const bool interpolation
+            = (oFlags & OPTIMIZATION_NEUTRAL_AXIS_INTERPOLATION)
+                == OPTIMIZATION_NEUTRAL_AXIS_INTERPOLATION;
+        m_neutralAxis.build(in, m_inBitDepthOp, m_cpuOps, interpolation);
+    }
+
+    if(m_neutralAxis.isEmpty())
+    {
+        m_cpuOps.clear();
+        CreateCPUEngine(ops, in, out, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp, oFlags);
+    }
+
+    // Collect the dynamic properties (i.e. shared between the ops when unified).
+
+    m_dynamicProperties.clear();
+    for(const auto & op : ops)
+    {
+        if(!op->isDynamic()) continue;
+
+        for(auto type : { DYNAMIC_PROPERTY_EXPOSURE,
+                          DYNAMIC_PROPERTY_CONTRAST,
+                          DYNAMIC_PROPERTY_GAMMA })
+        {
+            if(op->hasDynamicProperty(type))
+            {
+                DynamicPropertyImplRcPtr prop
+                    = OCIO_DYNAMIC_POINTER_CAST<DynamicPropertyImpl>(op->getDynamicProperty(type));
+                if(prop && std::find(m_dynamicProperties.begin(),
+                                     m_dynamicProperties.end(), prop) == m_dynamicProperties.end())
+                {
+                    m_dynamicProperties.push_back(prop);
+                }
+            }
+        }
+    }
 
     // Compute the cache id.
 
@@ -357,6 +801,13 @@ void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
     // Prepare the processing.
     scanlineBuilder->init(imgDesc);
 
+    // Latch the dynamic properties so that all the pixels use the same values.
+    DynamicPropertySnapshot snapshot;
+    for(const auto & prop : m_dynamicProperties)
+    {
+        snapshot.latch(*prop);
+    }
+
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
@@ -365,11 +816,7 @@ void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
         scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
-        {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
-        }
+        applyCPUOps(rgbaBuffer, numPixels, snapshot);
 
         scanlineBuilder->finishRGBAScanline();
     }
@@ -385,6 +832,13 @@ void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgD
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
+    // Latch the dynamic properties so that all the pixels use the same values.
+    DynamicPropertySnapshot snapshot;
+    for(const auto & prop : m_dynamicProperties)
+    {
+        snapshot.latch(*prop);
+    }
+
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
@@ -393,13 +847,118 @@ void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgD
         scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
+        applyCPUOps(rgbaBuffer, numPixels, snapshot);
+
+        scanlineBuilder->finishRGBAScanline();
+    }
+}
+
+void CPUProcessor::Impl::applyCPUOps(float * rgbaBuffer, long numPixels,
+                                     const DynamicPropertySnapshot & snapshot) const
+{
+    const size_t numOps = m_cpuOps.size();
+    const bool neutralAxis = !m_neutralAxis.isEmpty();
+
+    if(!neutralAxis && !m_runLength)
+    {
         for(size_t i = 0; i<numOps; ++i)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            m_cpuOps[i]->applyLatched(rgbaBuffer, rgbaBuffer, numPixels, snapshot);
         }
+        return;
+    }
 
-        scanlineBuilder->finishRGBAScanline();
+    // The runs of achromatic pixels use the neutral axis table, only the first pixel of the
+    // runs of identical pixels is processed, and the other pixels are processed by the CPU ops.
+
+    size_t numNeutralAxisPixels = 0;
+    size_t numSkippedPixels = 0;
+
+    long first = 0; // The first pixel not yet processed.
+    long idx   = 0;
+    while(idx < numPixels)
+    {
+        if(neutralAxis)
+        {
+            long end = idx;
+            while(end < numPixels && m_neutralAxis.isProcessed(rgbaBuffer + 4 * end))
+            {
+                ++end;
+            }
+
+            if(end - idx >= NEUTRAL_AXIS_MIN_RUN)
+            {
+                for(size_t i = 0; i<numOps && first<idx; ++i)
+                {
+                    m_cpuOps[i]->applyLatched(rgbaBuffer + 4 * first,
+                                              rgbaBuffer + 4 * first, idx - first,
+                                              snapshot);
+                }
+
+                m_neutralAxis.apply(rgbaBuffer + 4 * idx, end - idx);
+                numNeutralAxisPixels += size_t(end - idx);
+
+                first = end;
+                idx = end;
+                continue;
+            }
+
+            // The run is too short, and so would be any run of identical pixels starting in it.
+            if(end > idx)
+            {
+                idx = end;
+                continue;
+            }
+        }
+
+        if(m_runLength)
+        {
+            long end = idx + 1;
+            while(end < numPixels && IsSamePixel(rgbaBuffer + 4 * idx, rgbaBuffer + 4 * end))
+            {
+                ++end;
+            }
+
+            if(end - idx >= RUN_LENGTH_MIN_RUN)
+            {
+                // Process the pending pixels up to the first pixel of the run.
+                for(size_t i = 0; i<numOps; ++i)
+                {
+                    m_cpuOps[i]->applyLatched(rgbaBuffer + 4 * first,
+                                              rgbaBuffer + 4 * first, idx + 1 - first,
+                                              snapshot);
+                }
+
+                const float * src = rgbaBuffer + 4 * idx;
+                for(long pxl = idx + 1; pxl < end; ++pxl)
+                {
+                    memcpy(rgbaBuffer + 4 * pxl, src, 4 * sizeof(float));
+                }
+                numSkippedPixels += size_t(end - idx - 1);
+
+                first = end;
+            }
+
+            idx = end;
+            continue;
+        }
+
+        ++idx;
+    }
+
+    for(size_t i = 0; i<numOps && first<numPixels; ++i)
+    {
+        m_cpuOps[i]->applyLatched(rgbaBuffer + 4 * first, rgbaBuffer + 4 * first,
+                                  numPixels - first, snapshot);
+    }
+
+    if(numNeutralAxisPixels > 0)
+    {
+        m_numNeutralAxisPixels += numNeutralAxisPixels;
+    }
+    if(numSkippedPixels > 0)
+    {
+        m_numSkippedPixels += numSkippedPixels;
     }
 }
 
@@ -412,7 +971,7 @@ void CPUProcessor::Impl::applyRGB(float * pixel) const
     const size_t numOps = m_cpuOps.size();
     for(size_t i = 0; i<numOps; ++i)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
+        m_cpuOps[i]->apply(v, v, 1);
     }
 
     m_outBitDepthOp->apply(v, v, 1);
@@ -484,6 +1043,16 @@ DynamicPropertyRcPtr CPUProcessor::getDynamicProperty(DynamicPropertyType type)
     return getImpl()->getDynamicProperty(type);
 }
 
+size_t CPUProcessor::getNumNeutralAxisPixels() const
+{
+    return getImpl()->getNumNeutralAxisPixels();
+}
+
+size_t CPUProcessor::getNumSkippedPixels() const
+{
+    return getImpl()->getNumSkippedPixels();
+}
+
 void CPUProcessor::apply(ImageDesc & imgDesc) const
 {
     getImpl()->apply(imgDesc);
@@ -6,6 +6,9 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <atomic>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
@@ -16,6 +19,44 @@ namespace OCIO_NAMESPACE
 
 class ScanlineHelper;
 
+// The response of the color processing along the neutral axis (i.e. the achromatic pixels
+// where R == G == B) sampled at all the values an input pixel could hold, refer to
+// OPTIMIZATION_NEUTRAL_AXIS.
+class NeutralAxisTable
+{
+public:
+    NeutralAxisTable() = default;
+    NeutralAxisTable(const NeutralAxisTable &) = delete;
+    NeutralAxisTable& operator=(const NeutralAxisTable &) = delete;
+
+    // Sample the CPU ops at all the integer code values of the input bit-depth, or at all the
+    // half float values for float input bit-depths. The table stays empty if the CPU ops
+    // modify or use the alpha channel.
+    void build(BitDepth in,
+               const ConstOpCPURcPtr & inBitDepthOp,
+               const ConstOpCPURcPtrVec & cpuOps,
+               bool interpolation);
+
+    void clear();
+
+    bool isEmpty() const noexcept { return m_rgbValues.empty(); }
+
+    // Is the packed RGBA F32 pixel processed by the table?
+    bool isProcessed(const float * rgba) const;
+
+    // Process packed RGBA F32 pixels all accepted by isProcessed(). The alpha is unchanged.
+    void apply(float * rgba, long numPixels) const;
+
+private:
+    inline bool find(float value, size_t & idx0, size_t & idx1, float & ratio) const;
+
+    std::vector<float> m_inValues;  // The input values of the samples.
+    std::vector<float> m_rgbValues; // The RGB output values of the samples.
+    float m_maxCodeValue = 0.0f;
+    bool m_halfDomain    = false;
+    bool m_interpolation = false;
+};
+
 class CPUProcessor::Impl
 {
 public:
@@ -34,6 +75,9 @@ public:
 
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 
+    size_t getNumNeutralAxisPixels() const noexcept { return m_numNeutralAxisPixels; }
+    size_t getNumSkippedPixels() const noexcept { return m_numSkippedPixels; }
+
     void apply(ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
@@ -45,12 +89,17 @@ public:
     ////////////////////////////////////////////
     //
     // Functions not exposed to the OCIO public API.
-
+
     void finalize(const OpRcPtrVec & rawOps,
                   BitDepth in, BitDepth out,
-                  OptimizationFlags oFlags);
+                  OptimizationFlags oFlags,
+                  float bakeMaxError = DEFAULT_BAKE_MAX_ERROR);
 
 private:
+    // Apply the CPU ops to packed RGBA F32 pixels.
+    void applyCPUOps(float * rgbaBuffer, long numPixels,
+                     const DynamicPropertySnapshot & snapshot) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
@@ -61,6 +110,15 @@ private:
     bool               m_hasChannelCrosstalk = true;
     std::string        m_cacheID;
     Mutex              m_mutex;
+
+    // The dynamic properties are latched once per apply() call.
+    std::vector<DynamicPropertyImplRcPtr> m_dynamicProperties;
+
+    NeutralAxisTable   m_neutralAxis;  // Empty if OPTIMIZATION_NEUTRAL_AXIS is not used.
+    mutable std::atomic<size_t> m_numNeutralAxisPixels{ 0 };
+
+    bool               m_runLength = false; // OPTIMIZATION_RUN_LENGTH
+    mutable std::atomic<size_t> m_numSkippedPixels{ 0 };
 };
 
 } // namespace OCIO_NAMESPACE
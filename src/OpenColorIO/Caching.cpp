@@ -3,8 +3,9 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
-#include "transforms/CDLTransform.h"
+#include "ops/OpArray.h"
 #include "PathUtils.h"
+#include "transforms/CDLTransform.h"
 #include "transforms/FileTransform.h"
 
 namespace OCIO_NAMESPACE
@@ -17,5 +18,6 @@ void ClearAllCaches()
     ClearPathCaches();
     ClearFileTransformCaches();
     ClearCDLTransformFileCache();
+    ClearInternedArrayValues();
 }
 } // namespace OCIO_NAMESPACE
@@ -31,9 +31,11 @@ DynamicPropertyImpl::DynamicPropertyImpl(DynamicPropertyType type, double value,
 DynamicPropertyImpl::DynamicPropertyImpl(DynamicPropertyImpl & rhs)
     :   m_type(rhs.m_type)
     ,   m_valueType(rhs.m_valueType)
-    ,   m_value(rhs.m_value)
     ,   m_isDynamic(rhs.m_isDynamic)
 {   
+    unsigned version = 0;
+    m_value = rhs.getDoubleValue(version);
+    m_version = version & ~1u;
 }
 
 double DynamicPropertyImpl::getDoubleValue() const
@@ -43,7 +45,24 @@ double DynamicPropertyImpl::getDoubleValue() const
         throw Exception("The dynamic property does not hold a double precision value.");
     }
 
-    return m_value;
+    return m_value.load(std::memory_order_acquire);
+}
+
+double DynamicPropertyImpl::getDoubleValue(unsigned & version) const
+{
+    if(m_valueType!=DYNAMIC_PROPERTY_DOUBLE)
+    {
+        throw Exception("The dynamic property does not hold a double precision value.");
+    }
+
+    // The value is always a valid one (i.e. the previous or the new one) so the reader never
+    // waits for the writer, only the version tells if the value could be a stale one.
+    const unsigned before = m_version.load(std::memory_order_acquire);
+    const double value = m_value.load(std::memory_order_acquire);
+    const unsigned after = m_version.load(std::memory_order_relaxed);
+
+    version = (before == after) ? before : (after | 1u);
+    return value;
 }
 
 void DynamicPropertyImpl::setValue(double value)
@@ -53,7 +72,16 @@ void DynamicPropertyImpl::setValue(double value)
         throw Exception("The dynamic property does not hold a double precision value.");
     }
 
-    m_value = value;
+    // Only the concurrent writers wait for each other.
+    unsigned version = m_version.load(std::memory_order_relaxed);
+    do
+    {
+        version &= ~1u;
+    }
+    while(!m_version.compare_exchange_weak(version, version + 1, std::memory_order_acquire));
+
+    m_value.store(value, std::memory_order_release);
+    m_version.store(version + 2, std::memory_order_release);
 }
 
 bool DynamicPropertyImpl::equals(const DynamicPropertyImpl & rhs) const
@@ -64,7 +92,7 @@ bool DynamicPropertyImpl::equals(const DynamicPropertyImpl & rhs) const
     {
         if (!m_isDynamic)
         {
-            if (m_value == rhs.m_value)
+            if (getDoubleValue() == rhs.getDoubleValue())
             {
                 // Both not dynamic, same value.
                 return true;
@@ -86,6 +114,43 @@ bool DynamicPropertyImpl::equals(const DynamicPropertyImpl & rhs) const
     return false;
 }
 
+void DynamicPropertySnapshot::latch(const DynamicPropertyImpl & prop)
+{
+    for (auto & latched : m_values)
+    {
+        if (latched.m_property == &prop)
+        {
+            latched.m_value = prop.getDoubleValue(latched.m_version);
+            return;
+        }
+    }
+
+    LatchedValue latched{ &prop, 0., 0 };
+    latched.m_value = prop.getDoubleValue(latched.m_version);
+    m_values.push_back(latched);
+}
+
+double DynamicPropertySnapshot::getDoubleValue(const DynamicPropertyImpl & prop) const
+{
+    unsigned version = 0;
+    return getDoubleValue(prop, version);
+}
+
+double DynamicPropertySnapshot::getDoubleValue(const DynamicPropertyImpl & prop,
+                                               unsigned & version) const
+{
+    for (const auto & latched : m_values)
+    {
+        if (latched.m_property == &prop)
+        {
+            version = latched.m_version;
+            return latched.m_value;
+        }
+    }
+
+    return prop.getDoubleValue(version);
+}
+
 DynamicProperty::DynamicProperty()
 {
 
@@ -4,6 +4,9 @@
 #ifndef INCLUDED_OCIO_DYNAMICPROPERTY_H
 #define INCLUDED_OCIO_DYNAMICPROPERTY_H
 
+#include <atomic>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 namespace OCIO_NAMESPACE
@@ -23,6 +26,11 @@ public:
     double getDoubleValue() const override;
     void setValue(double value) override;
 
+    // Get the value with its version, the version being incremented each time the value
+    // changes. The read never waits for a concurrent change of the value: an odd version
+    // means that the value was being changed (i.e. the version must not be trusted).
+    double getDoubleValue(unsigned & version) const;
+
     DynamicPropertyType getType() const override
     {
         return m_type;
@@ -65,10 +73,129 @@ private:
     DynamicPropertyType m_type = DYNAMIC_PROPERTY_EXPOSURE;
 
     DynamicPropertyValueType m_valueType = DYNAMIC_PROPERTY_DOUBLE;
-    double m_value = 0;
+    std::atomic<double> m_value{ 0. };
+    // Even when the value is stable, odd while the value is being changed.
+    std::atomic<unsigned> m_version{ 0 };
     bool m_isDynamic = false;
 };
 
+// Holds the values of dynamic properties latched at a given time. For example, a call to
+// CPUProcessor::apply() latches the values once so that all the pixels of the call are
+// processed with the same values, even if the properties are concurrently changed.
+class DynamicPropertySnapshot
+{
+public:
+    DynamicPropertySnapshot() = default;
+
+    void latch(const DynamicPropertyImpl & prop);
+
+    // Get the latched value of the property, or its current value if not latched.
+    double getDoubleValue(const DynamicPropertyImpl & prop) const;
+    double getDoubleValue(const DynamicPropertyImpl & prop, unsigned & version) const;
+
+private:
+    struct LatchedValue
+    {
+        const DynamicPropertyImpl * m_property;
+        double m_value;
+        unsigned m_version;
+    };
+
+    std::vector<LatchedValue> m_values;
+};
+
+// Lock-free cache of values derived from dynamic properties (e.g. the exposure multiplier
+// computed from the exposure value), keyed on the versions of the properties so that the
+// values are only computed again when a property changes. The concurrent readers and writers
+// never wait: a reader missing the cache simply computes the values, and a writer finding
+// the cache already being updated skips its update.
+template<unsigned NumProperties, unsigned NumValues>
+class DynamicPropertyCache
+{
+public:
+    DynamicPropertyCache()
+    {
+        // An odd version never matches (i.e. empty cache).
+        for (unsigned idx = 0; idx < NumProperties; ++idx)
+        {
+            m_versions[idx].store(1u, std::memory_order_relaxed);
+        }
+        for (unsigned idx = 0; idx < NumValues; ++idx)
+        {
+            m_values[idx].store(0.0f, std::memory_order_relaxed);
+        }
+    }
+
+    DynamicPropertyCache(const DynamicPropertyCache &) = delete;
+    DynamicPropertyCache & operator=(const DynamicPropertyCache &) = delete;
+
+    // Get the cached values if they were computed from the same versions of the properties.
+    bool get(const unsigned (&versions)[NumProperties], float (&values)[NumValues]) const
+    {
+        const unsigned before = m_sequence.load(std::memory_order_acquire);
+        if (before & 1u)
+        {
+            return false;
+        }
+
+        bool match = true;
+        for (unsigned idx = 0; idx < NumProperties; ++idx)
+        {
+            // An odd version means that the property was being changed.
+            match = match && !(versions[idx] & 1u)
+                          && m_versions[idx].load(std::memory_order_relaxed) == versions[idx];
+        }
+        for (unsigned idx = 0; idx < NumValues; ++idx)
+        {
+            values[idx] = m_values[idx].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return match && m_sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    // Store the values computed from the versions of the properties.
+    void set(const unsigned (&versions)[NumProperties], const float (&values)[NumValues])
+    {
+        for (unsigned idx = 0; idx < NumProperties; ++idx)
+        {
+            if (versions[idx] & 1u)
+            {
+                return;
+            }
+        }
+
+        unsigned sequence = m_sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1u)
+            || !m_sequence.compare_exchange_strong(sequence, sequence + 1,
+                                                   std::memory_order_acquire))
+        {
+            return;
+        }
+
+        // Order the odd sequence before the data stores (i.e. a reader seeing any of the new
+        // data also sees the odd sequence on its second read).
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (unsigned idx = 0; idx < NumProperties; ++idx)
+        {
+            m_versions[idx].store(versions[idx], std::memory_order_relaxed);
+        }
+        for (unsigned idx = 0; idx < NumValues; ++idx)
+        {
+            m_values[idx].store(values[idx], std::memory_order_relaxed);
+        }
+
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+private:
+    // Odd while the cache is being updated.
+    std::atomic<unsigned> m_sequence{ 0u };
+    std::atomic<unsigned> m_versions[NumProperties];
+    std::atomic<float> m_values[NumValues];
+};
+
 bool operator ==(const DynamicProperty &, const DynamicProperty &);
 
 } // namespace OCIO_NAMESPACE
@@ -113,7 +113,12 @@ void GPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
 
     m_ops = rawOps;
 
-    OptimizeOpVec(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, oFlags);
+    // Fusing ops into a 3D LUT only speeds up the CPU renderers.  The legacy shader would
+    // even have to bake the fused ops into its lattice.
+    const OptimizationFlags gpuFlags
+        = OptimizationFlags(oFlags & ~OPTIMIZATION_FUSE_LUT3D_STAGES);
+
+    OptimizeOpVec(m_ops, BIT_DEPTH_F32, BIT_DEPTH_F32, gpuFlags);
     FinalizeOpVec(m_ops, oFlags);
     UnifyDynamicProperties(m_ops);
 
@@ -184,7 +189,8 @@ void GPUProcessor::Impl::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) c
         gpuOps += gpuLut;
         gpuOps += gpuOpsHwPostProcess;
 
-        OptimizeOpVec(gpuOps, BIT_DEPTH_F32, BIT_DEPTH_F32, OPTIMIZATION_DEFAULT);
+        OptimizeOpVec(gpuOps, BIT_DEPTH_F32, BIT_DEPTH_F32,
+                      OptimizationFlags(OPTIMIZATION_DEFAULT & ~OPTIMIZATION_FUSE_LUT3D_STAGES));
         FinalizeOpVec(gpuOps, OPTIMIZATION_LUT_INV_FAST);
     }
     else
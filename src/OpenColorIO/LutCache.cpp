@@ -0,0 +1,575 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Logging.h"
+#include "LutCache.h"
+#include "Mutex.h"
+#include "ParseUtils.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+#include "transforms/FileTransform.h"
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <sys/utime.h>
+#else
+#include <dirent.h>
+#include <utime.h>
+#endif
+
+namespace OCIO_NAMESPACE
+{
+
+void LutCacheWriter::write(const void * data, size_t size)
+{
+    m_buffer.append(static_cast<const char *>(data), size);
+}
+
+void LutCacheWriter::writeString(const std::string & str)
+{
+    write<uint32_t>(uint32_t(str.size()));
+    write(str.c_str(), str.size());
+}
+
+void LutCacheWriter::writeFloats(const float * values, size_t numValues)
+{
+    write<uint32_t>(uint32_t(numValues));
+    write(values, numValues * sizeof(float));
+}
+
+void LutCacheWriter::writeLut1D(const ConstLut1DOpDataRcPtr & lut)
+{
+    write<uint8_t>(lut ? 1 : 0);
+    if (lut)
+    {
+        const Array & array = lut->getArray();
+
+        write<uint32_t>(uint32_t(lut->getHalfFlags()));
+        write<uint32_t>(uint32_t(array.getLength()));
+        write<uint32_t>(uint32_t(array.getNumColorComponents()));
+        write<uint32_t>(uint32_t(lut->getHueAdjust()));
+        write<uint32_t>(uint32_t(lut->getInterpolation()));
+        write<uint32_t>(uint32_t(lut->getDirection()));
+        write<uint32_t>(uint32_t(lut->getFileOutputBitDepth()));
+        writeFloats(array.getValues().data(), array.getValues().size());
+    }
+}
+
+void LutCacheWriter::writeLut3D(const ConstLut3DOpDataRcPtr & lut)
+{
+    write<uint8_t>(lut ? 1 : 0);
+    if (lut)
+    {
+        const Array & array = lut->getArray();
+
+        write<uint32_t>(uint32_t(array.getLength()));
+        write<uint32_t>(uint32_t(lut->getInterpolation()));
+        write<uint32_t>(uint32_t(lut->getDirection()));
+        write<uint32_t>(uint32_t(lut->getFileOutputBitDepth()));
+        writeFloats(array.getValues().data(), array.getValues().size());
+    }
+}
+
+LutCacheReader::LutCacheReader(const char * data, size_t size)
+    :   m_current(data)
+    ,   m_end(data + size)
+{
+}
+
+void LutCacheReader::read(void * data, size_t size)
+{
+    if (size > size_t(m_end - m_current))
+    {
+        throw Exception("The LUT cache entry is truncated.");
+    }
+
+    memcpy(data, m_current, size);
+    m_current += size;
+}
+
+std::string LutCacheReader::readString()
+{
+    const uint32_t size = read<uint32_t>();
+    if (size > size_t(m_end - m_current))
+    {
+        throw Exception("The LUT cache entry is truncated.");
+    }
+
+    std::string str(m_current, size);
+    m_current += size;
+    return str;
+}
+
+void LutCacheReader::readFloats(float * values, size_t numValues)
+{
+    if (read<uint32_t>() != numValues)
+    {
+        throw Exception("The LUT cache entry has an unexpected number of values.");
+    }
+
+    read(values, numValues * sizeof(float));
+}
+
+Lut1DOpDataRcPtr LutCacheReader::readLut1D()
+{
+    if (!read<uint8_t>())
+    {
+        return Lut1DOpDataRcPtr();
+    }
+
+    const auto halfFlags          = Lut1DOpData::HalfFlags(read<uint32_t>());
+    const uint32_t length         = read<uint32_t>();
+    const uint32_t numComponents  = read<uint32_t>();
+    const auto hueAdjust          = Lut1DHueAdjust(read<uint32_t>());
+    const auto interpolation      = Interpolation(read<uint32_t>());
+    const auto direction          = TransformDirection(read<uint32_t>());
+    const auto fileOutBitDepth    = BitDepth(read<uint32_t>());
+
+    // Avoid a huge allocation from a corrupted entry.
+    if ((numComponents != 1 && numComponents != 3)
+        || size_t(length) * 3 * sizeof(float) > size_t(m_end - m_current))
+    {
+        throw Exception("The LUT cache entry has an invalid 1D LUT.");
+    }
+
+    auto lut = std::make_shared<Lut1DOpData>(halfFlags, length);
+    lut->setHueAdjust(hueAdjust);
+    lut->setInterpolation(interpolation);
+    lut->setDirection(direction);
+    lut->setFileOutputBitDepth(fileOutBitDepth);
+
+    Array & array = lut->getArray();
+    readFloats(array.getValues().data(), array.getValues().size());
+    array.setNumColorComponents(numComponents);
+
+    return lut;
+}
+
+Lut3DOpDataRcPtr LutCacheReader::readLut3D()
+{
+    if (!read<uint8_t>())
+    {
+        return Lut3DOpDataRcPtr();
+    }
+
+    const uint32_t gridSize       = read<uint32_t>();
+    const auto interpolation      = Interpolation(read<uint32_t>());
+    const auto direction          = TransformDirection(read<uint32_t>());
+    const auto fileOutBitDepth    = BitDepth(read<uint32_t>());
+
+    // Note that the grid size is validated by the 3D LUT.
+    auto lut = std::make_shared<Lut3DOpData>(interpolation, gridSize);
+    lut->setDirection(direction);
+    lut->setFileOutputBitDepth(fileOutBitDepth);
+
+    Array & array = lut->getArray();
+    readFloats(array.getValues().data(), array.getValues().size());
+
+    return lut;
+}
+
+namespace
+{
+
+constexpr char OCIO_LUT_CACHE_DIR_ENVVAR[]      = "OCIO_LUT_CACHE_DIR";
+constexpr char OCIO_LUT_CACHE_MAX_SIZE_ENVVAR[] = "OCIO_LUT_CACHE_MAX_SIZE";
+
+// Identify the cache entries and their layout.
+constexpr char LUT_CACHE_MAGIC[8] = { 'O', 'C', 'I', 'O', 'L', 'U', 'T', 'C' };
+constexpr uint32_t LUT_CACHE_VERSION = 1;
+constexpr char LUT_CACHE_EXTENSION[] = ".ociolutcache";
+
+constexpr unsigned long long DEFAULT_LUT_CACHE_MAX_SIZE = 512ULL * 1024ULL * 1024ULL;
+
+Mutex g_lutCacheMutex;
+bool g_lutCacheInitialized = false;
+std::string g_lutCacheDirectory;
+unsigned long long g_lutCacheMaxSize = DEFAULT_LUT_CACHE_MAX_SIZE;
+
+// You must manually acquire the cache mutex before calling this.
+void InitLutCache()
+{
+    if (g_lutCacheInitialized) return;
+
+    g_lutCacheInitialized = true;
+
+    Platform::Getenv(OCIO_LUT_CACHE_DIR_ENVVAR, g_lutCacheDirectory);
+
+    std::string maxSize;
+    Platform::Getenv(OCIO_LUT_CACHE_MAX_SIZE_ENVVAR, maxSize);
+    if (!maxSize.empty())
+    {
+        int sizeInMB = 0;
+        if (StringToInt(&sizeInMB, maxSize.c_str(), true) && sizeInMB >= 0)
+        {
+            g_lutCacheMaxSize = (unsigned long long)sizeInMB * 1024ULL * 1024ULL;
+        }
+        else
+        {
+            std::ostringstream os;
+            os << "Invalid $" << OCIO_LUT_CACHE_MAX_SIZE_ENVVAR << " specified: '"
+               << maxSize << "'. A size in megabytes is expected.";
+            LogWarning(os.str());
+        }
+    }
+}
+
+void GetLutCacheSettings(std::string & directory, unsigned long long & maxSize)
+{
+    AutoMutex lock(g_lutCacheMutex);
+    InitLutCache();
+
+    directory = g_lutCacheDirectory;
+    maxSize   = g_lutCacheMaxSize;
+}
+
+// The key identifies the content of the file for this version of the library.
+bool GetLutCacheEntry(const std::string & directory,
+                      const std::string & filepath,
+                      std::string & key,
+                      std::string & entryPath)
+{
+    const std::string fileHash = GetFastFileHash(filepath);
+    if (fileHash.empty())
+    {
+        return false;
+    }
+
+    key = filepath + "\n" + fileHash + "\n" + OCIO_VERSION;
+
+    // Remove the '$' prefix of the printable hash.
+    const std::string keyHash = CacheIDHash(key.c_str(), int(key.size())).substr(1);
+    entryPath = pystring::os::path::join(directory, keyHash + LUT_CACHE_EXTENSION);
+
+    return true;
+}
+
+bool ReadBinaryFile(const std::string & path, std::string & content)
+{
+    std::ifstream file(path.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.seekg(0, std::ios_base::end);
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios_base::beg);
+    if (size <= 0)
+    {
+        return false;
+    }
+
+    content.resize(size_t(size));
+    file.read(&content[0], std::streamsize(size));
+
+    return file.gcount() == std::streamsize(size);
+}
+
+// Update the modification time so that the least recently used entries are removed first.
+void TouchFile(const std::string & path)
+{
+#if defined(_WIN32)
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+std::string GetUniqueSuffix()
+{
+    std::ostringstream oss;
+    const auto seed = std::chrono::high_resolution_clock::now().time_since_epoch().count()
+                      ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+    std::mt19937 generator(static_cast<unsigned>(seed));
+    oss << "." << generator() << ".tmp";
+    return oss.str();
+}
+
+void MakeDirectory(const std::string & directory)
+{
+#if defined(_WIN32)
+    _mkdir(directory.c_str());
+#else
+    mkdir(directory.c_str(), 0777);
+#endif
+}
+
+struct LutCacheFile
+{
+    std::string path;
+    unsigned long long size;
+    time_t mtime;
+};
+
+void ListLutCacheFiles(const std::string & directory, std::vector<LutCacheFile> & files)
+{
+    const size_t extLength = strlen(LUT_CACHE_EXTENSION);
+
+    auto addFile = [&](const std::string & name)
+    {
+        if (name.size() > extLength
+            && name.compare(name.size() - extLength, extLength, LUT_CACHE_EXTENSION) == 0)
+        {
+            const std::string path = pystring::os::path::join(directory, name);
+
+            struct stat results;
+            if (stat(path.c_str(), &results) == 0)
+            {
+                files.push_back({ path, (unsigned long long)results.st_size, results.st_mtime });
+            }
+        }
+    };
+
+#if defined(_WIN32)
+    WIN32_FIND_DATAA data;
+    const std::string pattern = pystring::os::path::join(directory, "*");
+    HANDLE handle = FindFirstFileA(pattern.c_str(), &data);
+    if (handle != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            addFile(data.cFileName);
+        }
+        while (FindNextFileA(handle, &data));
+        FindClose(handle);
+    }
+#else
+    DIR * dir = opendir(directory.c_str());
+    if (dir)
+    {
+        while (struct dirent * entry = readdir(dir))
+        {
+            addFile(entry->d_name);
+        }
+        closedir(dir);
+    }
+#endif
+}
+
+// Remove the least recently used entries until the cache size fits the maximum size.
+void TrimLutCache(const std::string & directory, unsigned long long maxSize)
+{
+    std::vector<LutCacheFile> files;
+    ListLutCacheFiles(directory, files);
+
+    unsigned long long totalSize = 0;
+    for (const auto & file : files)
+    {
+        totalSize += file.size;
+    }
+
+    if (totalSize <= maxSize)
+    {
+        return;
+    }
+
+    std::sort(files.begin(), files.end(),
+              [](const LutCacheFile & a, const LutCacheFile & b) { return a.mtime < b.mtime; });
+
+    for (const auto & file : files)
+    {
+        if (totalSize <= maxSize)
+        {
+            break;
+        }
+
+        // Another process could have already removed the file.
+        std::remove(file.path.c_str());
+        totalSize -= file.size;
+    }
+}
+
+} // anon.
+
+void SetLutCacheDirectory(const char * directory)
+{
+    AutoMutex lock(g_lutCacheMutex);
+    InitLutCache();
+
+    g_lutCacheDirectory = directory ? directory : "";
+}
+
+const char * GetLutCacheDirectory()
+{
+    AutoMutex lock(g_lutCacheMutex);
+    InitLutCache();
+
+    return g_lutCacheDirectory.c_str();
+}
+
+void SetLutCacheMaxSize(unsigned long long maxSize)
+{
+    AutoMutex lock(g_lutCacheMutex);
+    InitLutCache();
+
+    g_lutCacheMaxSize = maxSize;
+}
+
+unsigned long long GetLutCacheMaxSize()
+{
+    AutoMutex lock(g_lutCacheMutex);
+    InitLutCache();
+
+    return g_lutCacheMaxSize;
+}
+
+bool LoadFromLutCache(FileFormat * & format,
+                      CachedFileRcPtr & cachedFile,
+                      const std::string & filepath)
+{
+    std::string directory;
+    unsigned long long maxSize = 0;
+    GetLutCacheSettings(directory, maxSize);
+
+    std::string key, entryPath;
+    if (directory.empty() || !GetLutCacheEntry(directory, filepath, key, entryPath))
+    {
+        return false;
+    }
+
+    // Read the whole entry at once.
+    std::string content;
+    if (!ReadBinaryFile(entryPath, content))
+    {
+        return false;
+    }
+
+    try
+    {
+        LutCacheReader reader(content.c_str(), content.size());
+
+        char magic[sizeof(LUT_CACHE_MAGIC)];
+        reader.read(magic, sizeof(magic));
+        if (memcmp(magic, LUT_CACHE_MAGIC, sizeof(magic)) != 0
+            || reader.read<uint32_t>() != LUT_CACHE_VERSION
+            || reader.readString() != key)
+        {
+            return false;
+        }
+
+        FileFormat * cachedFormat
+            = FormatRegistry::GetInstance().getFileFormatByName(reader.readString());
+        if (!cachedFormat)
+        {
+            return false;
+        }
+
+        CachedFileRcPtr file = cachedFormat->deserializeCachedFile(reader);
+        if (!file || !reader.atEnd())
+        {
+            return false;
+        }
+
+        format     = cachedFormat;
+        cachedFile = file;
+    }
+    catch (std::exception & e)
+    {
+        std::ostringstream os;
+        os << "Ignoring the LUT cache entry '" << entryPath << "' of '" << filepath
+           << "': " << e.what();
+        LogDebug(os.str());
+        return false;
+    }
+
+    TouchFile(entryPath);
+
+    if (IsDebugLoggingEnabled())
+    {
+        std::ostringstream os;
+        os << "Loaded '" << filepath << "' from the LUT cache entry '" << entryPath << "'.";
+        LogDebug(os.str());
+    }
+
+    return true;
+}
+
+void SaveToLutCache(const FileFormat * format,
+                    const CachedFileRcPtr & cachedFile,
+                    const std::string & filepath)
+{
+    std::string directory;
+    unsigned long long maxSize = 0;
+    GetLutCacheSettings(directory, maxSize);
+
+    std::string key, entryPath;
+    if (!format || !cachedFile || directory.empty()
+        || !GetLutCacheEntry(directory, filepath, key, entryPath))
+    {
+        return;
+    }
+
+    // The cache is only an optimization so the errors are never propagated.
+    try
+    {
+        LutCacheWriter writer;
+        writer.write(LUT_CACHE_MAGIC, sizeof(LUT_CACHE_MAGIC));
+        writer.write<uint32_t>(LUT_CACHE_VERSION);
+        writer.writeString(key);
+        writer.writeString(format->getName());
+
+        if (!format->serializeCachedFile(writer, cachedFile)
+            || writer.getBuffer().size() > maxSize)
+        {
+            return;
+        }
+
+        MakeDirectory(directory);
+
+        // Write a temporary file and rename it so that the other processes never read a
+        // partial entry.
+        const std::string tmpPath = entryPath + GetUniqueSuffix();
+        {
+            std::ofstream file(tmpPath.c_str(), std::ios_base::binary | std::ios_base::trunc);
+            file.write(writer.getBuffer().c_str(), std::streamsize(writer.getBuffer().size()));
+            file.close();
+
+            if (!file)
+            {
+                std::remove(tmpPath.c_str());
+
+                std::ostringstream os;
+                os << "Could not write the LUT cache entry '" << entryPath << "' of '"
+                   << filepath << "'.";
+                LogDebug(os.str());
+                return;
+            }
+        }
+
+        // Rename fails on Windows if another process has just created the same entry.
+        if (std::rename(tmpPath.c_str(), entryPath.c_str()) != 0)
+        {
+            std::remove(tmpPath.c_str());
+            return;
+        }
+
+        TrimLutCache(directory, maxSize);
+    }
+    catch (std::exception & e)
+    {
+        std::ostringstream os;
+        os << "Could not save '" << filepath << "' in the LUT cache: " << e.what();
+        LogDebug(os.str());
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LUTCACHE_H
+#define INCLUDED_OCIO_LUTCACHE_H
+
+#include <string>
+#include <type_traits>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+
+namespace OCIO_NAMESPACE
+{
+class FileFormat;
+class CachedFile;
+typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
+
+// The on-disk LUT cache stores the parsed content of the LUT files (i.e. the cached file
+// produced by the file format) in a compact binary form, so that other processes loading
+// the same LUT files do not have to parse them again.
+//
+// A cache entry is keyed by the file path, its fast file hash (i.e. inode and mtime) and
+// the library version. The entries are written to a temporary file first and then renamed
+// so concurrent writers never expose a partial entry, and the oldest entries are removed
+// when the size of the cache directory exceeds the maximum size.
+//
+// Only the file formats implementing FileFormat::serializeCachedFile() are stored.
+
+// Binary writer used to serialize the cached files.
+class LutCacheWriter
+{
+public:
+    LutCacheWriter() = default;
+    LutCacheWriter(const LutCacheWriter &) = delete;
+    LutCacheWriter & operator=(const LutCacheWriter &) = delete;
+
+    void write(const void * data, size_t size);
+
+    template<typename T>
+    void write(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported");
+        write(&value, sizeof(T));
+    }
+
+    void writeString(const std::string & str);
+
+    void writeFloats(const float * values, size_t numValues);
+
+    // A null LUT is allowed.
+    void writeLut1D(const ConstLut1DOpDataRcPtr & lut);
+    void writeLut3D(const ConstLut3DOpDataRcPtr & lut);
+
+    const std::string & getBuffer() const { return m_buffer; }
+
+private:
+    std::string m_buffer;
+};
+
+// Binary reader used to deserialize the cached files. An exception is thrown if the data
+// is truncated or invalid.
+class LutCacheReader
+{
+public:
+    LutCacheReader() = delete;
+    LutCacheReader(const char * data, size_t size);
+    LutCacheReader(const LutCacheReader &) = delete;
+    LutCacheReader & operator=(const LutCacheReader &) = delete;
+
+    void read(void * data, size_t size);
+
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are supported");
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    std::string readString();
+
+    void readFloats(float * values, size_t numValues);
+
+    Lut1DOpDataRcPtr readLut1D();
+    Lut3DOpDataRcPtr readLut3D();
+
+    bool atEnd() const { return m_current == m_end; }
+
+private:
+    const char * m_current;
+    const char * m_end;
+};
+
+// Load the cached file of the LUT file from the on-disk cache. Return false if the cache
+// is disabled or if there is no valid entry for the file.
+bool LoadFromLutCache(FileFormat * & format,
+                      CachedFileRcPtr & cachedFile,
+                      const std::string & filepath);
+
+// Store the cached file of the LUT file in the on-disk cache, if enabled and supported by
+// the file format. Errors are only logged.
+void SaveToLutCache(const FileFormat * format,
+                    const CachedFileRcPtr & cachedFile,
+                    const std::string & filepath);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -180,6 +181,83 @@ inline float IntAsFloat(const unsigned x)
     return v.f;
 }
 
+// Scalar versions of the fast tier of the SSE log2, exp2 and power functions (refer to
+//   sseLog2(), sseExp2() and ssePower() in SSE.h) i.e. the same polynomials with about 15 bits
+//   of mantissa. The renderers use them when SSE is not available and the
+//   OPTIMIZATION_FAST_LOG_EXP_POW flag is set, the accurate tier being the standard functions.
+
+inline float FastLog2(const float x)
+{
+    // log2( x ) = exposant + log2( mantissa ) with the mantissa in [1, 2[.
+    const float mantissa = IntAsFloat((FloatAsInt(x) & ~0x7F800000u) | 0x3F800000u);
+
+    float log2 = (float)+4.487361286440374006195e-2;
+    log2 = log2 * mantissa + (float)-4.165637071209677112635e-1;
+    log2 = log2 * mantissa + (float)+1.631148826119436277100;
+    log2 = log2 * mantissa + (float)-3.550793018041176193407;
+    log2 = log2 * mantissa + (float)+5.091710879305474367557;
+    log2 = log2 * mantissa + (float)-2.800364054395965731506;
+
+    const int exponent = (int)((FloatAsInt(x) & 0x7F800000u) >> 23) - 127;
+
+    return log2 + (float)exponent;
+}
+
+inline float FastExp2(const float x)
+{
+    // Overflow (and NaN, as sseExp2() does).
+    if (!(x < 128.0f))
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    // Underflow.
+    if (x < -127.0f)
+    {
+        return 0.0f;
+    }
+
+    // exp2( x ) = exp2( floor(x) ) * exp2( fraction ), the truncation minus one for the
+    // negative values.
+    const int floor_x = (int)x - (x < 0.0f ? 1 : 0);
+    if (floor_x < -126)
+    {
+        return 0.0f;
+    }
+
+    const float fraction = x - (float)floor_x;
+
+    float mexp = (float)1.353416792833547468620e-2;
+    mexp = mexp * fraction + (float)5.201146058412685018921e-2;
+    mexp = mexp * fraction + (float)2.414427569091865207710e-1;
+    mexp = mexp * fraction + (float)6.930038344665415134202e-1;
+    mexp = mexp * fraction + (float)1.000002593370603213644;
+
+    return IntAsFloat((unsigned)(floor_x + 127) << 23) * mexp;
+}
+
+// Results from base values smaller than or equal to zero are mapped to zero.
+inline float FastPower(const float x, const float exp)
+{
+    return (x > 0.0f) ? FastExp2(exp * FastLog2(x)) : 0.0f;
+}
+
+// The functions of the requested tier.
+
+inline float Log2(const float x, bool fast)
+{
+    return fast ? FastLog2(x) : std::log2(x);
+}
+
+inline float Exp2(const float x, bool fast)
+{
+    return fast ? FastExp2(x) : std::exp2(x);
+}
+
+inline float Power(const float x, const float exp, bool fast)
+{
+    return fast ? FastPower(x, exp) : powf(x, exp);
+}
+
 // Add a number of ULPs (Unit of Least Precision) to a given
 //   floating-point number.
 //
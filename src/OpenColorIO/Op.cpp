@@ -20,6 +20,12 @@
 
 namespace OCIO_NAMESPACE
 {
+void OpCPU::applyLatched(const void * inImg, void * outImg, long numPixels,
+                         const DynamicPropertySnapshot & /*snapshot*/) const
+{
+    apply(inImg, outImg, numPixels);
+}
+
 bool OpCPU::hasDynamicProperty(DynamicPropertyType type) const
 {
     return false;
@@ -56,6 +56,11 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Same as apply() but the dynamic properties use the values latched in the snapshot
+    // instead of their current values. Only the ops having dynamic properties override it.
+    virtual void applyLatched(const void * inImg, void * outImg, long numPixels,
+                              const DynamicPropertySnapshot & snapshot) const;
+
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 
@@ -184,11 +189,21 @@ bool IsOpVecNoOp(const OpRcPtrVec & ops);
 
 void FinalizeOpVec(OpRcPtrVec & opVec, OptimizationFlags oFlags);
 
+// Default maximum error of the OPTIMIZATION_BAKE_LUT3D optimization.
+constexpr float DEFAULT_BAKE_MAX_ERROR = 1e-3f;
+
 void OptimizeOpVec(OpRcPtrVec & result,
                     const BitDepth & inBitDepth,
                     const BitDepth & outBitDepth,
                     OptimizationFlags oFlags);
 
+// Same as above but with the maximum error allowed by the OPTIMIZATION_BAKE_LUT3D optimization.
+void OptimizeOpVec(OpRcPtrVec & result,
+                    const BitDepth & inBitDepth,
+                    const BitDepth & outBitDepth,
+                    OptimizationFlags oFlags,
+                    float bakeMaxError);
+
 void UnifyDynamicProperties(OpRcPtrVec & ops);
 
 void CreateOpVecFromOpData(OpRcPtrVec & ops,
@@ -256,12 +271,15 @@ class Op
         // This must be safe to call in a multi-threaded context.
         // Ops that have mutable data internally, or rely on external
         // caching, must thus be appropriately mutexed.
+        //
+        // The ops are applied with the accurate log, exp and pow functions as these calls
+        // are the internal evaluations (e.g. LUT composition, optimizer checks).
 
         virtual void apply(void * img, long numPixels) const
-        { getCPUOp()->apply(img, img, numPixels); }
+        { getCPUOp(OPTIMIZATION_NONE)->apply(img, img, numPixels); }
 
         virtual void apply(const void * inImg, void * outImg, long numPixels) const
-        { getCPUOp()->apply(inImg, outImg, numPixels); }
+        { getCPUOp(OPTIMIZATION_NONE)->apply(inImg, outImg, numPixels); }
 
 
         // Is this op supported by the legacy shader text generator?
@@ -278,8 +296,9 @@ class Op
         // Make dynamic properties non-dynamic.
         virtual void removeDynamicProperties() {}
 
-        // On-demand creation of the OpCPU instance.
-        virtual ConstOpCPURcPtr getCPUOp() const = 0;
+        // On-demand creation of the OpCPU instance. The fast approximations of the log, exp
+        // and pow functions are only used when oFlags contains OPTIMIZATION_FAST_LOG_EXP_POW.
+        virtual ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const = 0;
 
         ConstOpDataRcPtr data() const { return std::const_pointer_cast<const OpData>(m_data); }
 
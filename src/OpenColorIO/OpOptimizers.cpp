@@ -2,8 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -12,6 +16,10 @@
 #include "Op.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
 
 namespace OCIO_NAMESPACE
@@ -448,12 +456,538 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+// Maximum error allowed when a run of separable ops is collapsed into a single 1D LUT.
+// The error is absolute for values within [-1, 1] and relative above, i.e. it is well
+// below the step of a 16-bit integer code.
+const float SEPARABLE_LUT1D_MAX_ERROR = 1e-5f;
+
+bool IsSeparableLut1DCandidate(const ConstOpRcPtr & op)
+{
+    // Note: The alpha channel is validated by the error measurement below.
+    return !op->isDynamic() && !op->hasChannelCrosstalk();
+}
+
+// Build the RGBA values used to measure the error of a collapsed run.  The values are
+// deliberately off the usual LUT grids and cover the extended range.  The alpha sweeps
+// [0,1] so that any op modifying alpha is detected (ignoring the clamping of alpha values
+// out of that range that some ops do).
+void BuildSeparableLut1DSamples(std::vector<float> & samples)
+{
+    std::vector<float> values;
+
+    static constexpr int numLinear = 4096;
+    for (int i = 0; i < numLinear; ++i)
+    {
+        values.push_back(-0.25f + 1.5f * (float(i) + 0.37f) / float(numLinear));
+    }
+
+    static constexpr int stepsPerStop = 16;
+    for (int stop = -14; stop < 15; ++stop)
+    {
+        for (int i = 0; i < stepsPerStop; ++i)
+        {
+            const float val = std::pow(2.0f, float(stop) + (float(i) + 0.37f) / stepsPerStop);
+            values.push_back(val);
+            values.push_back(-val);
+        }
+    }
+
+    samples.resize(values.size() * 4);
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        samples[4 * idx + 0] = values[idx];
+        samples[4 * idx + 1] = values[idx];
+        samples[4 * idx + 2] = values[idx];
+        samples[4 * idx + 3] = float(idx % 1001) / 1000.0f;
+    }
+}
+
+void EvalSamples(const OpRcPtrVec & ops, std::vector<float> & samples)
+{
+    OpRcPtrVec evalOps;
+    for (const auto & op : ops)
+    {
+        evalOps.push_back(op->clone());
+    }
+    FinalizeOpVec(evalOps, OPTIMIZATION_NONE);
+
+    // The reference of the error budgets must not include the error of the fast
+    // approximations of the log, exp and pow functions.
+    const long numPixels = static_cast<long>(samples.size() / 4);
+    for (const auto & op : evalOps)
+    {
+        op->getCPUOp(OPTIMIZATION_NONE)->apply(&samples[0], &samples[0], numPixels);
+    }
+}
+
+float ComputeMaxError(const std::vector<float> & ref, const std::vector<float> & res)
+{
+    float maxError = 0.0f;
+    for (size_t idx = 0; idx < ref.size(); ++idx)
+    {
+        const float r = ref[idx];
+        const float v = res[idx];
+        if (std::isnan(r) || std::isnan(v) || std::isinf(r) || std::isinf(v))
+        {
+            if (!(r == v || (std::isnan(r) && std::isnan(v))))
+            {
+                return std::numeric_limits<float>::infinity();
+            }
+            continue;
+        }
+        maxError = std::max(maxError, std::fabs(r - v) / std::max(1.0f, std::fabs(r)));
+    }
+    return maxError;
+}
+
+// Collapse the run of ops into a single 1D LUT.  The smallest domain meeting
+// the error budget is used.  Returns a null pointer if no domain meets it.
+Lut1DOpDataRcPtr CollapseSeparableRun(const OpRcPtrVec & runOps,
+                                      const std::vector<float> & samples,
+                                      const std::vector<float> & ref)
+{
+    struct Domain
+    {
+        Lut1DOpData::HalfFlags m_halfFlags;
+        unsigned long m_length;
+    };
+
+    // Note: A standard domain clamps the input to [0,1] so it only meets the budget when
+    // the run already does that (e.g. it starts with a 1D LUT), whereas the half domain
+    // preserves the extended range.
+    std::vector<Domain> domains;
+
+    ConstOpRcPtr firstOp = runOps.front();
+    auto firstLut = DynamicPtrCast<const Lut1DOpData>(firstOp->data());
+    if (firstLut && firstLut->getDirection() == TRANSFORM_DIR_FORWARD
+        && !firstLut->isInputHalfDomain() && firstLut->getArray().getLength() > 1)
+    {
+        // Keep the entries of the leading LUT on the grid so that its breakpoints are
+        // not smoothed out by the resampling.
+        const unsigned long numSteps = firstLut->getArray().getLength() - 1;
+        for (unsigned long scale = 1; numSteps * scale < 65536; scale *= 4)
+        {
+            domains.push_back({ Lut1DOpData::LUT_STANDARD, numSteps * scale + 1 });
+        }
+    }
+    else
+    {
+        domains.push_back({ Lut1DOpData::LUT_STANDARD, 1024 });
+        domains.push_back({ Lut1DOpData::LUT_STANDARD, 4096 });
+        domains.push_back({ Lut1DOpData::LUT_STANDARD, 65536 });
+    }
+    domains.push_back({ Lut1DOpData::LUT_INPUT_HALF_CODE, 65536 });
+
+    std::ostringstream oss;
+    oss << "Collapsing " << runOps.size() << " separable ops into a 1D LUT, max error:";
+
+    for (const auto & domain : domains)
+    {
+        Lut1DOpDataRcPtr lut = std::make_shared<Lut1DOpData>(domain.m_halfFlags,
+                                                             domain.m_length);
+
+        OpRcPtrVec composeOps;
+        for (const auto & op : runOps)
+        {
+            composeOps.push_back(op->clone());
+        }
+        Lut1DOpData::ComposeVec(lut, composeOps);
+
+        OpRcPtrVec lutOps;
+        CreateLut1DOp(lutOps, lut, TRANSFORM_DIR_FORWARD);
+
+        std::vector<float> res(samples);
+        EvalSamples(lutOps, res);
+
+        const float error = ComputeMaxError(ref, res);
+        oss << " " << error << " (" << domain.m_length
+            << (lut->isInputHalfDomain() ? " half" : "") << ")";
+
+        if (error <= SEPARABLE_LUT1D_MAX_ERROR)
+        {
+            LogDebug(oss.str());
+            return lut;
+        }
+    }
+
+    oss << ", ops are kept.";
+    LogDebug(oss.str());
+    return Lut1DOpDataRcPtr();
+}
+
+// Use functional composition to replace any maximal run of separable ops that contains
+// a 1D LUT by a single 1D LUT.  The LUT domain is selected using an error budget.
+int OptimizeSeparableLut1DRuns(OpRcPtrVec & ops)
+{
+    int count = 0;
+
+    std::vector<float> samples;
+
+    size_t first = 0;
+    while (first < ops.size())
+    {
+        size_t last = first;
+        bool hasLut1D = false;
+        while (last < ops.size() && IsSeparableLut1DCandidate(ops[last]))
+        {
+            ConstOpRcPtr op = ops[last];
+            hasLut1D = hasLut1D || op->data()->getType() == OpData::Lut1DType;
+            ++last;
+        }
+
+        if (hasLut1D && (last - first) > 1)
+        {
+            if (samples.empty())
+            {
+                BuildSeparableLut1DSamples(samples);
+            }
+
+            OpRcPtrVec runOps;
+            runOps.insert(runOps.end(), ops.begin() + first, ops.begin() + last);
+
+            std::vector<float> ref(samples);
+            EvalSamples(runOps, ref);
+
+            Lut1DOpDataRcPtr lut = CollapseSeparableRun(runOps, samples, ref);
+            if (lut)
+            {
+                OpRcPtrVec lutOps;
+                CreateLut1DOp(lutOps, lut, TRANSFORM_DIR_FORWARD);
+
+                ops.erase(ops.begin() + first, ops.begin() + last);
+                ops.insert(ops.begin() + first, lutOps.begin(), lutOps.end());
+
+                last = first + lutOps.size();
+                ++count;
+            }
+        }
+
+        first = last + 1;
+    }
+
+    return count;
+}
+
+// The 3D LUT baking uses a shaper that is symmetrical around zero, close to linear
+// near zero and logarithmic above, so that values within [-BAKE_SHAPER_MAX_VALUE,
+// BAKE_SHAPER_MAX_VALUE] are covered by the grid.
+const float BAKE_SHAPER_MAX_VALUE = 64.0f;
+const float BAKE_SHAPER_LINEAR_VALUE = 1.0f / 64.0f;
+
+float BakeShaperFwd(float val)
+{
+    static const float maxStops = std::log2(1.0f + BAKE_SHAPER_MAX_VALUE / BAKE_SHAPER_LINEAR_VALUE);
+
+    const float absVal = std::min(std::fabs(val), BAKE_SHAPER_MAX_VALUE);
+    const float stops = std::log2(1.0f + absVal / BAKE_SHAPER_LINEAR_VALUE) / maxStops;
+    return val < 0.0f ? 0.5f - 0.5f * stops : 0.5f + 0.5f * stops;
+}
+
+float BakeShaperInv(float val)
+{
+    static const float maxStops = std::log2(1.0f + BAKE_SHAPER_MAX_VALUE / BAKE_SHAPER_LINEAR_VALUE);
+
+    const float stops = std::fabs(2.0f * val - 1.0f) * maxStops;
+    const float absVal = BAKE_SHAPER_LINEAR_VALUE * (std::exp2(stops) - 1.0f);
+    return val < 0.5f ? -absVal : absVal;
+}
+
+bool IsBakeCandidate(const ConstOpRcPtr & op)
+{
+    return !op->isDynamic();
+}
+
+// Only a run having channel crosstalk and at least one op that is more expensive than
+// a matrix or a LUT is worth the baking.
+bool IsWorthBaking(const OpRcPtrVec & runOps)
+{
+    bool hasCrosstalk = false;
+    bool hasExpensiveOp = false;
+    for (const auto & op : runOps)
+    {
+        ConstOpRcPtr constOp = op;
+        const auto type = constOp->data()->getType();
+
+        hasCrosstalk = hasCrosstalk || constOp->hasChannelCrosstalk();
+        hasExpensiveOp = hasExpensiveOp || (type != OpData::MatrixType
+                                            && type != OpData::RangeType
+                                            && type != OpData::Lut1DType
+                                            && type != OpData::Lut3DType);
+    }
+    return hasCrosstalk && hasExpensiveOp;
+}
+
+// Build the RGBA values used to measure the error of a baked run.  It is a mix of a grid
+// covering the shaper range, and of pseudo-random colors in [0,1] and in the shaper range.
+// The alpha sweeps [0,1] so that any op modifying alpha is detected.
+void BuildBakeSamples(std::vector<float> & samples)
+{
+    std::vector<float> values{ 0.0f };
+    for (int stop = -8; stop <= 5; ++stop)
+    {
+        const float val = std::pow(2.0f, float(stop) + 0.37f);
+        values.push_back(val);
+        values.push_back(-val);
+    }
+
+    std::vector<float> rgb;
+    for (const auto r : values)
+    {
+        for (const auto g : values)
+        {
+            for (const auto b : values)
+            {
+                rgb.push_back(r);
+                rgb.push_back(g);
+                rgb.push_back(b);
+            }
+        }
+    }
+
+    // A basic linear congruential generator keeps the samples deterministic.
+    uint32_t seed = 1u;
+    auto random = [&seed]()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return float(seed >> 8) / float(1u << 24);
+    };
+
+    static constexpr int numRandom = 8192;
+    for (int i = 0; i < 3 * numRandom; ++i)
+    {
+        rgb.push_back(random());
+    }
+    for (int i = 0; i < 3 * numRandom; ++i)
+    {
+        rgb.push_back(BakeShaperInv(random()));
+    }
+
+    const size_t numPixels = rgb.size() / 3;
+    samples.resize(numPixels * 4);
+    for (size_t idx = 0; idx < numPixels; ++idx)
+    {
+        samples[4 * idx + 0] = rgb[3 * idx + 0];
+        samples[4 * idx + 1] = rgb[3 * idx + 1];
+        samples[4 * idx + 2] = rgb[3 * idx + 2];
+        samples[4 * idx + 3] = float(idx % 1001) / 1000.0f;
+    }
+}
+
+// Bake the run of ops into an optional shaper 1D LUT followed by a 3D LUT.  The smallest
+// 3D LUT meeting the error bound is used.  Returns false if no size meets it.
+bool BakeRun(OpRcPtrVec & bakedOps,
+             const OpRcPtrVec & runOps,
+             const std::vector<float> & samples,
+             const std::vector<float> & ref,
+             float maxError)
+{
+    std::ostringstream oss;
+    oss << "Baking " << runOps.size() << " ops into a 3D LUT, max error:";
+
+    for (const unsigned long gridSize : { 17ul, 33ul, 65ul })
+    {
+        // Without a shaper, the 3D LUT only covers [0,1] so it only meets the bound when
+        // the run already clamps to that.
+        for (const bool useShaper : { false, true })
+        {
+            OpRcPtrVec candidateOps;
+
+            if (useShaper)
+            {
+                Lut1DOpDataRcPtr shaper
+                    = std::make_shared<Lut1DOpData>(Lut1DOpData::LUT_INPUT_HALF_CODE, 65536);
+                for (auto & val : shaper->getArray().getValues())
+                {
+                    val = std::isnan(val) ? 0.0f : BakeShaperFwd(val);
+                }
+                CreateLut1DOp(candidateOps, shaper, TRANSFORM_DIR_FORWARD);
+            }
+
+            Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, gridSize);
+            Array::Values & lutValues = lut->getArray().getValues();
+            if (useShaper)
+            {
+                for (auto & val : lutValues)
+                {
+                    val = BakeShaperInv(val);
+                }
+            }
+
+            OpRcPtrVec evalOps;
+            for (const auto & op : runOps)
+            {
+                evalOps.push_back(op->clone());
+            }
+            EvalTransform(&lutValues[0], &lutValues[0],
+                          static_cast<long>(gridSize * gridSize * gridSize),
+                          evalOps);
+
+            CreateLut3DOp(candidateOps, lut, TRANSFORM_DIR_FORWARD);
+
+            std::vector<float> res(samples);
+            EvalSamples(candidateOps, res);
+
+            const float error = ComputeMaxError(ref, res);
+            oss << " " << error << " (" << gridSize << (useShaper ? " shaper" : "") << ")";
+
+            if (error <= maxError)
+            {
+                LogDebug(oss.str());
+                bakedOps = candidateOps;
+                return true;
+            }
+        }
+    }
+
+    oss << ", ops are kept.";
+    LogDebug(oss.str());
+    return false;
+}
+
+// Replace any maximal run of non-dynamic ops that is expensive to evaluate by a shaper
+// 1D LUT and a 3D LUT, i.e. a baked version of the run.  The 3D LUT size is selected
+// to meet the error bound.
+int BakeRuns(OpRcPtrVec & ops, float maxError)
+{
+    int count = 0;
+
+    std::vector<float> samples;
+
+    size_t first = 0;
+    while (first < ops.size())
+    {
+        size_t last = first;
+        while (last < ops.size() && IsBakeCandidate(ops[last]))
+        {
+            ++last;
+        }
+
+        OpRcPtrVec runOps;
+        runOps.insert(runOps.end(), ops.begin() + first, ops.begin() + last);
+
+        if (IsWorthBaking(runOps))
+        {
+            if (samples.empty())
+            {
+                BuildBakeSamples(samples);
+            }
+
+            std::vector<float> ref(samples);
+            EvalSamples(runOps, ref);
+
+            OpRcPtrVec bakedOps;
+            if (BakeRun(bakedOps, runOps, samples, ref, maxError))
+            {
+                ops.erase(ops.begin() + first, ops.begin() + last);
+                ops.insert(ops.begin() + first, bakedOps.begin(), bakedOps.end());
+
+                last = first + bakedOps.size();
+                ++count;
+            }
+        }
+
+        first = last + 1;
+    }
+
+    return count;
+}
+
+bool IsFusableMatrix(const ConstOpRcPtr & op)
+{
+    if (op->data()->getType() != OpData::MatrixType)
+    {
+        return false;
+    }
+
+    ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(op->data());
+    return !mat->hasAlpha();
+}
+
+bool IsFusableRange(const ConstOpRcPtr & op)
+{
+    return op->data()->getType() == OpData::RangeType;
+}
+
+// Fuse the matrix and range ops surrounding each forward 3D LUT into the input and output
+// stages of the LUT op, i.e. the CPU renderer then processes them in a single pass.  Each
+// stage takes any number of matrices (not modifying alpha) followed by at most one range.
+int FuseLut3DStages(OpRcPtrVec & ops)
+{
+    int count = 0;
+
+    for (size_t idx = 0; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        if (op->data()->getType() != OpData::Lut3DType || HasFusedLut3DOps(op))
+        {
+            continue;
+        }
+
+        ConstLut3DOpDataRcPtr lut = DynamicPtrCast<const Lut3DOpData>(op->data());
+        if (lut->getDirection() != TRANSFORM_DIR_FORWARD)
+        {
+            continue;
+        }
+
+        size_t first = idx;
+        if (first > 0 && IsFusableRange(ops[first - 1]))
+        {
+            --first;
+        }
+        while (first > 0 && IsFusableMatrix(ops[first - 1]))
+        {
+            --first;
+        }
+
+        size_t last = idx + 1;
+        while (last < ops.size() && IsFusableMatrix(ops[last]))
+        {
+            ++last;
+        }
+        if (last < ops.size() && IsFusableRange(ops[last]))
+        {
+            ++last;
+        }
+
+        if (first == idx && last == idx + 1)
+        {
+            continue;
+        }
+
+        OpRcPtrVec preOps;
+        preOps.insert(preOps.end(), ops.begin() + first, ops.begin() + idx);
+        OpRcPtrVec postOps;
+        postOps.insert(postOps.end(), ops.begin() + idx + 1, ops.begin() + last);
+
+        OpRcPtrVec fusedOps;
+        CreateFusedLut3DOp(fusedOps, op, preOps, postOps);
+
+        ops.erase(ops.begin() + first, ops.begin() + last);
+        ops.insert(ops.begin() + first, fusedOps.begin(), fusedOps.end());
+
+        count += static_cast<int>(last - first - 1);
+        idx = first;
+    }
+
+    return count;
+}
+
 } // namespace
 
 void OptimizeOpVec(OpRcPtrVec & ops,
                     const BitDepth & inBitDepth,
                     const BitDepth & outBitDepth,
                     OptimizationFlags oFlags)
+{
+    OptimizeOpVec(ops, inBitDepth, outBitDepth, oFlags, DEFAULT_BAKE_MAX_ERROR);
+}
+
+void OptimizeOpVec(OpRcPtrVec & ops,
+                    const BitDepth & inBitDepth,
+                    const BitDepth & outBitDepth,
+                    OptimizationFlags oFlags,
+                    float bakeMaxError)
 {
     if (ops.empty())
         return;
@@ -489,6 +1023,9 @@ void OptimizeOpVec(OpRcPtrVec & ops,
     int total_identityops   = 0;
     int total_inverseops    = 0;
     int total_combines      = 0;
+    int total_lut1druns     = 0;
+    int total_bakedruns     = 0;
+    int total_fusedops      = 0;
     int passes              = 0;
 
     const bool optimizeIdentity = HasFlag(oFlags, OPTIMIZATION_IDENTITY);
@@ -525,10 +1062,27 @@ void OptimizeOpVec(OpRcPtrVec & ops,
             RemoveTrailingClampIdentity(ops);
         }
 
+        if (HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_LUT1D))
+        {
+            total_lut1druns = OptimizeSeparableLut1DRuns(ops);
+        }
+
+        if (HasFlag(oFlags, OPTIMIZATION_BAKE_LUT3D))
+        {
+            total_bakedruns = BakeRuns(ops, bakeMaxError);
+        }
+
         if(HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
         {
             OptimizeSeparablePrefix(ops, inBitDepth);
         }
+
+        // Done last as the ops fused into a 3D LUT are no longer visible to the other
+        // optimizations.
+        if (HasFlag(oFlags, OPTIMIZATION_FUSE_LUT3D_STAGES))
+        {
+            total_fusedops = FuseLut3DStages(ops);
+        }
     }
 
     OpRcPtrVec::size_type finalSize = ops.size();
@@ -554,6 +1108,9 @@ void OptimizeOpVec(OpRcPtrVec & ops,
         os << total_identityops << " identity ops replaced, ";
         os << total_inverseops << " inverse ops removed\n";
         os << total_combines << " ops combines\n";
+        os << total_lut1druns << " separable runs collapsed into a 1D LUT\n";
+        os << total_bakedruns << " runs baked into a 3D LUT\n";
+        os << total_fusedops << " ops fused into a 3D LUT\n";
         os << SerializeOpVec(ops, 4);
         LogDebug(os.str());
     }
@@ -1,13 +1,22 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <locale>
 #include <set>
 #include <sstream>
+#include <stdint.h>
+#include <thread>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ParseUtils.h"
+#include "Platform.h"
 #include "pystring/pystring.h"
 
 namespace OCIO_NAMESPACE
@@ -393,13 +402,681 @@ std::string FloatVecToString(const float * fval, unsigned int size)
     return pretty.str();
 }
 
+namespace
+{
+
+inline bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline const char * SkipSpaces(const char * first, const char * last)
+{
+    while (first != last && IsSpace(*first))
+    {
+        ++first;
+    }
+    return first;
+}
+
+// The powers of ten exactly represented by a double.
+static const double Pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+// Parse the number using the standard library when it cannot be exactly computed (i.e. too
+// many digits or a too large exponent), which is rare in practice.
+template<typename T>
+const char * ParseRealSlow(const char * first, const char * last, T & value)
+{
+    std::istringstream inputStringstream(std::string(first, last));
+    inputStringstream.imbue(std::locale::classic());
+
+    T x;
+    if (!(inputStringstream >> x))
+    {
+        return nullptr;
+    }
+
+    value = x;
+    return last;
+}
+
+// Converting the correctly rounded double to a float rounds a second time, which is only
+// wrong when the double lies exactly halfway between two floats (i.e. the tie is broken
+// without the digits lost by the first rounding).
+inline bool IsDoubleRoundingTie(double, double)
+{
+    return false;
+}
+
+inline bool IsDoubleRoundingTie(double val, float)
+{
+    const float fval = float(val);
+    if (double(fval) == val || std::isinf(fval))
+    {
+        return false;
+    }
+
+    const float next = std::nextafter(fval, double(fval) < val ? std::numeric_limits<float>::max()
+                                                               : -std::numeric_limits<float>::max());
+    return 0.5 * (double(fval) + double(next)) == val;
+}
+
+template<typename T>
+const char * ParseRealNumber(const char * first, const char * last, T & value)
+{
+    const char * str = SkipSpaces(first, last);
+    const char * start = str;
+
+    bool negative = false;
+    if (str != last && (*str == '-' || *str == '+'))
+    {
+        negative = (*str == '-');
+        ++str;
+    }
+
+    // Accumulate up to 19 significant digits (i.e. the value fits in 64 bits), the value
+    // being mantissa * 10^exponent.
+    static constexpr int MAX_DIGITS = 19;
+
+    uint64_t mantissa = 0;
+    int numDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    bool exact = true;
+
+    for (; str != last && IsDigit(*str); ++str)
+    {
+        hasDigits = true;
+        if (numDigits < MAX_DIGITS)
+        {
+            mantissa = mantissa * 10 + uint64_t(*str - '0');
+            if (mantissa != 0) ++numDigits;
+        }
+        else
+        {
+            ++exponent;
+            exact = exact && *str == '0';
+        }
+    }
+
+    if (str != last && *str == '.')
+    {
+        for (++str; str != last && IsDigit(*str); ++str)
+        {
+            hasDigits = true;
+            if (numDigits < MAX_DIGITS)
+            {
+                mantissa = mantissa * 10 + uint64_t(*str - '0');
+                if (mantissa != 0) ++numDigits;
+                --exponent;
+            }
+            else
+            {
+                exact = exact && *str == '0';
+            }
+        }
+    }
+
+    if (!hasDigits)
+    {
+        return nullptr;
+    }
+
+    if (str != last && (*str == 'e' || *str == 'E'))
+    {
+        const char * exp = str + 1;
+
+        bool negativeExp = false;
+        if (exp != last && (*exp == '-' || *exp == '+'))
+        {
+            negativeExp = (*exp == '-');
+            ++exp;
+        }
+
+        if (exp != last && IsDigit(*exp))
+        {
+            int val = 0;
+            for (; exp != last && IsDigit(*exp); ++exp)
+            {
+                if (val < 100000) val = val * 10 + (*exp - '0');
+            }
+
+            exponent += negativeExp ? -val : val;
+            str = exp;
+        }
+    }
+
+    // When the mantissa and the power of ten are exact doubles, the division or the
+    // multiplication is correctly rounded.
+    if (exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double val = double(mantissa);
+        val = exponent < 0 ? val / Pow10[-exponent] : val * Pow10[exponent];
+
+        if (IsDoubleRoundingTie(val, T()))
+        {
+            return ParseRealSlow(start, str, value);
+        }
+
+        const T fval = T(negative ? -val : val);
+        if (std::isinf(fval))
+        {
+            // Out of range like the standard library.
+            return nullptr;
+        }
+
+        value = fval;
+        return str;
+    }
+
+    return ParseRealSlow(start, str, value);
+}
+
+template<typename T>
+size_t ParseNumbersT(const char * first, const char * last, T * values, size_t maxValues)
+{
+    size_t numValues = 0;
+
+    const char * str = SkipSpaces(first, last);
+    while (str != last)
+    {
+        if (numValues == maxValues)
+        {
+            return 0;
+        }
+
+        str = ParseNumber(str, last, values[numValues]);
+        if (!str || (str != last && !IsSpace(*str)))
+        {
+            return 0;
+        }
+
+        ++numValues;
+        str = SkipSpaces(str, last);
+    }
+
+    return numValues;
+}
+
+// Parse the lines of numbers from a part of the text.
+bool ParseNumberLinesPart(const char * first, const char * last,
+                          size_t numValuesPerLine, bool allowComments,
+                          std::vector<float> & values)
+{
+    static constexpr size_t MAX_VALUES_PER_LINE = 16;
+    if (numValuesPerLine == 0 || numValuesPerLine > MAX_VALUES_PER_LINE)
+    {
+        return false;
+    }
+
+    float lineValues[MAX_VALUES_PER_LINE];
+
+    while (first != last)
+    {
+        const char * endOfLine = std::find(first, last, '\n');
+
+        if (!(allowComments && *first == '#'))
+        {
+            const size_t numValues
+                = ParseNumbers(first, endOfLine, lineValues, numValuesPerLine);
+
+            if (numValues == numValuesPerLine)
+            {
+                values.insert(values.end(), lineValues, lineValues + numValues);
+            }
+            else if (numValues != 0 || SkipSpaces(first, endOfLine) != endOfLine)
+            {
+                return false;
+            }
+        }
+
+        first = (endOfLine == last) ? last : endOfLine + 1;
+    }
+
+    return true;
+}
+
+} // anon.
+
+bool ParseNumberLines(const char * first, const char * last,
+                      size_t numValuesPerLine, bool allowComments,
+                      std::vector<float> & values)
+{
+    // Only split the text in parts large enough to benefit from the threads.
+    static constexpr size_t MIN_PART_SIZE = 256 * 1024;
+
+    const size_t size = size_t(last - first);
+    const size_t numParts
+        = std::min(size_t(std::max(1u, std::thread::hardware_concurrency())),
+                   std::max(size_t(1), size / MIN_PART_SIZE));
+
+    if (numParts == 1)
+    {
+        return ParseNumberLinesPart(first, last, numValuesPerLine, allowComments, values);
+    }
+
+    // Split the text at line boundaries.
+    std::vector<const char *> bounds{ first };
+    for (size_t idx = 1; idx < numParts; ++idx)
+    {
+        const char * bound = std::max(first + size * idx / numParts, bounds.back());
+        bound = std::find(bound, last, '\n');
+        bounds.push_back(bound == last ? last : bound + 1);
+    }
+    bounds.push_back(last);
+
+    std::vector<std::vector<float>> partValues(numParts);
+    std::vector<char> partSuccess(numParts, 0);
+
+    Platform::ParallelFor(numParts, [&](size_t idx)
+    {
+        partSuccess[idx] = ParseNumberLinesPart(bounds[idx], bounds[idx + 1],
+                                                numValuesPerLine, allowComments,
+                                                partValues[idx]) ? 1 : 0;
+    });
+
+    size_t numValues = values.size();
+    for (size_t idx = 0; idx < numParts; ++idx)
+    {
+        if (!partSuccess[idx])
+        {
+            return false;
+        }
+        numValues += partValues[idx].size();
+    }
+
+    values.reserve(numValues);
+    for (const auto & part : partValues)
+    {
+        values.insert(values.end(), part.begin(), part.end());
+    }
+
+    return true;
+}
+
+std::string ReadRemainingText(std::istream & istream)
+{
+    std::string text;
+
+    // Read all the characters at once when the stream size is known.
+    const std::streampos pos = istream.tellg();
+    if (pos != std::streampos(-1))
+    {
+        istream.seekg(0, std::ios_base::end);
+        const std::streampos end = istream.tellg();
+        istream.seekg(pos);
+
+        if (istream.good() && end >= pos)
+        {
+            text.resize(size_t(end - pos));
+            istream.read(&text[0], std::streamsize(text.size()));
+            text.resize(size_t(istream.gcount()));
+            return text;
+        }
+
+        istream.clear();
+        istream.seekg(pos);
+    }
+
+    std::ostringstream oss;
+    oss << istream.rdbuf();
+    return oss.str();
+}
+
+const char * ParseNumber(const char * first, const char * last, float & value)
+{
+    return ParseRealNumber(first, last, value);
+}
+
+const char * ParseNumber(const char * first, const char * last, double & value)
+{
+    return ParseRealNumber(first, last, value);
+}
+
+const char * ParseNumber(const char * first, const char * last, int & value)
+{
+    const char * str = SkipSpaces(first, last);
+
+    bool negative = false;
+    if (str != last && (*str == '-' || *str == '+'))
+    {
+        negative = (*str == '-');
+        ++str;
+    }
+
+    if (str == last || !IsDigit(*str))
+    {
+        return nullptr;
+    }
+
+    static constexpr int64_t MAX_VALUE = int64_t(std::numeric_limits<int>::max()) + 1;
+
+    int64_t val = 0;
+    for (; str != last && IsDigit(*str); ++str)
+    {
+        val = val * 10 + (*str - '0');
+        if (val > MAX_VALUE)
+        {
+            return nullptr;
+        }
+    }
+
+    val = negative ? -val : val;
+    if (val > std::numeric_limits<int>::max())
+    {
+        return nullptr;
+    }
+
+    value = int(val);
+    return str;
+}
+
+size_t ParseNumbers(const char * first, const char * last, float * values, size_t maxValues)
+{
+    return ParseNumbersT(first, last, values, maxValues);
+}
+
+size_t ParseNumbers(const char * first, const char * last, int * values, size_t maxValues)
+{
+    return ParseNumbersT(first, last, values, maxValues);
+}
+
+namespace
+{
+
+// The powers of ten exactly represented by a 64 bits integer.
+static const uint64_t IntPow10[] = { 1ULL,
+                                     10ULL,
+                                     100ULL,
+                                     1000ULL,
+                                     10000ULL,
+                                     100000ULL,
+                                     1000000ULL,
+                                     10000000ULL,
+                                     100000000ULL,
+                                     1000000000ULL,
+                                     10000000000ULL,
+                                     100000000000ULL,
+                                     1000000000000ULL,
+                                     10000000000000ULL,
+                                     100000000000000ULL,
+                                     1000000000000000ULL,
+                                     10000000000000000ULL };
+
+// Write the numDigits last digits of the value, padded with zeros.
+inline char * WriteDigits(char * buffer, uint64_t value, int numDigits)
+{
+    for (int i = numDigits - 1; i >= 0; --i)
+    {
+        buffer[i] = char('0' + value % 10);
+        value /= 10;
+    }
+    return buffer + numDigits;
+}
+
+inline int NumDigits(uint64_t value)
+{
+    int numDigits = 1;
+    while (numDigits < 17 && value >= IntPow10[numDigits])
+    {
+        ++numDigits;
+    }
+    return numDigits;
+}
+
+// Round the positive value multiplied by 10^exponent to the nearest integer. As the value and
+// the power of ten are exact doubles, the result of the multiplication (or of the division)
+// is only off by half an ulp so the rounding is exact unless the result is too close to a
+// half integer. Returns false in that case, or if the result does not fit in a double
+// mantissa.
+inline bool RoundScaled(double value, int exponent, uint64_t & result)
+{
+    if (exponent < -22 || exponent > 22)
+    {
+        return false;
+    }
+
+    const double scaled = exponent >= 0 ? value * Pow10[exponent] : value / Pow10[-exponent];
+    if (!(scaled < 9007199254740992.0))
+    {
+        return false;
+    }
+
+    const double integer = std::floor(scaled);
+    const double fraction = scaled - integer;
+    if (std::fabs(fraction - 0.5) <= scaled * 2.3e-16)
+    {
+        return false;
+    }
+
+    result = uint64_t(integer) + (fraction > 0.5 ? 1 : 0);
+    return true;
+}
+
+// Format the positive value like "%.*f" and return the end of the number, or nullptr if the
+// value cannot be exactly formatted.
+char * FormatFixed(char * buffer, double value, int precision)
+{
+    uint64_t digits = 0;
+    if (precision < 0 || precision > 16 || !RoundScaled(value, precision, digits))
+    {
+        return nullptr;
+    }
+
+    const uint64_t integer = digits / IntPow10[precision];
+    buffer = WriteDigits(buffer, integer, NumDigits(integer));
+
+    if (precision > 0)
+    {
+        *buffer++ = '.';
+        buffer = WriteDigits(buffer, digits % IntPow10[precision], precision);
+    }
+
+    return buffer;
+}
+
+// Format the positive value like "%.*g" and return the end of the number, or nullptr if the
+// value cannot be exactly formatted.
+char * FormatGeneral(char * buffer, double value, int precision)
+{
+    if (precision < 0 || precision > 15)
+    {
+        return nullptr;
+    }
+
+    if (value == 0.0)
+    {
+        *buffer++ = '0';
+        return buffer;
+    }
+
+    // Like printf, a zero precision means one significant digit.
+    precision = std::max(precision, 1);
+
+    // Find the decimal exponent of the value once rounded to the precision.
+    int exponent = int(std::floor(std::log10(value)));
+    uint64_t digits = 0;
+    for (int attempt = 0; ; ++attempt)
+    {
+        if (attempt == 3 || !RoundScaled(value, precision - 1 - exponent, digits))
+        {
+            return nullptr;
+        }
+
+        if (digits >= IntPow10[precision])
+        {
+            ++exponent;
+        }
+        else if (digits < IntPow10[precision - 1])
+        {
+            --exponent;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Remove the trailing zeros.
+    int numDigits = precision;
+    while (numDigits > 1 && digits % 10 == 0)
+    {
+        digits /= 10;
+        --numDigits;
+    }
+
+    if (exponent < -4 || exponent >= precision)
+    {
+        // Scientific notation i.e. d.ddde+XX.
+        const uint64_t fraction = digits % IntPow10[numDigits - 1];
+        *buffer++ = char('0' + digits / IntPow10[numDigits - 1]);
+        if (numDigits > 1)
+        {
+            *buffer++ = '.';
+            buffer = WriteDigits(buffer, fraction, numDigits - 1);
+        }
+
+        *buffer++ = 'e';
+        *buffer++ = exponent < 0 ? '-' : '+';
+        const int absExponent = std::abs(exponent);
+        buffer = WriteDigits(buffer, uint64_t(absExponent), absExponent < 100 ? 2 : 3);
+    }
+    else if (exponent >= 0)
+    {
+        if (numDigits > exponent + 1)
+        {
+            const int numDecimals = numDigits - exponent - 1;
+            buffer = WriteDigits(buffer, digits / IntPow10[numDecimals], exponent + 1);
+            *buffer++ = '.';
+            buffer = WriteDigits(buffer, digits % IntPow10[numDecimals], numDecimals);
+        }
+        else
+        {
+            buffer = WriteDigits(buffer, digits, numDigits);
+            for (int i = numDigits; i <= exponent; ++i)
+            {
+                *buffer++ = '0';
+            }
+        }
+    }
+    else
+    {
+        *buffer++ = '0';
+        *buffer++ = '.';
+        for (int i = 1; i < -exponent; ++i)
+        {
+            *buffer++ = '0';
+        }
+        buffer = WriteDigits(buffer, digits, numDigits);
+    }
+
+    return buffer;
+}
+
+} // anon.
+
+NumberFormatter::NumberFormatter(const std::ostream & os)
+    : m_precision(int(os.precision()))
+    , m_fixed((os.flags() & std::ios_base::floatfield) == std::ios_base::fixed)
+{
+    // The fast formatting is only equivalent to the stream one for the default flags, the
+    // general or the fixed notation, and the classic number punctuation.
+    const std::ios_base::fmtflags flags = os.flags();
+    const std::ios_base::fmtflags floatField = flags & std::ios_base::floatfield;
+
+    const auto & punct = std::use_facet<std::numpunct<char>>(os.getloc());
+
+    m_standard = (floatField == std::ios_base::fmtflags(0) || floatField == std::ios_base::fixed)
+                 && !(flags & (std::ios_base::showpos | std::ios_base::showpoint
+                               | std::ios_base::uppercase | std::ios_base::left
+                               | std::ios_base::internal))
+                 && os.fill() == ' '
+                 && punct.decimal_point() == '.'
+                 && punct.grouping().empty();
+
+    m_stream.copyfmt(os);
+}
+
+void NumberFormatter::append(std::string & str, double value, unsigned width) const
+{
+    char buffer[64];
+    char * end = nullptr;
+
+    if (m_standard && std::isfinite(value))
+    {
+        char * start = buffer;
+        if (std::signbit(value))
+        {
+            *start++ = '-';
+        }
+
+        end = m_fixed ? FormatFixed(start, std::fabs(value), m_precision)
+                      : FormatGeneral(start, std::fabs(value), m_precision);
+    }
+
+    if (!end)
+    {
+        // Rare values (e.g. nan, inf, very large numbers or too close to a rounding limit).
+        m_stream.str("");
+        m_stream.width(width);
+        m_stream << value;
+        str += m_stream.str();
+        return;
+    }
+
+    const size_t length = size_t(end - buffer);
+    if (length < width)
+    {
+        str.append(width - length, ' ');
+    }
+    str.append(buffer, length);
+}
+
+void WriteNumberLines(std::ostream & os,
+                      const float * values, size_t numLines, size_t numValuesPerLine,
+                      const char * linePrefix)
+{
+    // Write the lines by blocks to limit the memory usage.
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    const NumberFormatter formatter(os);
+
+    std::string buffer;
+    buffer.reserve(BLOCK_SIZE + 256);
+
+    for (size_t line = 0; line < numLines; ++line)
+    {
+        buffer += linePrefix;
+        for (size_t i = 0; i < numValuesPerLine; ++i)
+        {
+            if (i != 0) buffer += ' ';
+            formatter.append(buffer, *values++);
+        }
+        buffer += '\n';
+
+        if (buffer.size() >= BLOCK_SIZE)
+        {
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    os.write(buffer.data(), buffer.size());
+}
+
 bool StringToFloat(float * fval, const char * str)
 {
     if(!str) return false;
 
-    std::istringstream inputStringstream(str);
     float x;
-    if(!(inputStringstream >> x))
+    if(!ParseNumber(str, str + strlen(str), x))
     {
         return false;
     }
@@ -413,9 +1090,9 @@ bool StringToInt(int * ival, const char * str, bool failIfLeftoverChars)
     if(!str) return false;
     if(!ival) return false;
 
-    std::istringstream i(str);
-    char c=0;
-    if (!(i >> *ival) || (failIfLeftoverChars && i.get(c))) return false;
+    const char * last = str + strlen(str);
+    const char * end = ParseNumber(str, last, *ival);
+    if (!end || (failIfLeftoverChars && end != last)) return false;
     return true;
 }
 
@@ -449,13 +1126,11 @@ bool StringVecToFloatVec(std::vector<float> &floatArray,
 
     for(unsigned int i=0; i<lineParts.size(); i++)
     {
-        std::istringstream inputStringstream(lineParts[i]);
-        float x;
-        if(!(inputStringstream >> x))
+        const std::string & str = lineParts[i];
+        if(!ParseNumber(str.c_str(), str.c_str() + str.size(), floatArray[i]))
         {
             return false;
         }
-        floatArray[i] = x;
     }
 
     return true;
@@ -509,6 +1184,96 @@ bool nextline(std::istream &istream, std::string &line)
     return false;
 }
 
+namespace
+{
+constexpr char BASE64_CHARS[]
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Return the 6-bit value of a base64 character, or -1 if not valid.
+inline int Base64Value(char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+} // anon.
+
+std::string EncodeBase64(const char * data, size_t size)
+{
+    const unsigned char * bytes = reinterpret_cast<const unsigned char *>(data);
+
+    std::string str;
+    str.reserve((size + 2) / 3 * 4);
+
+    size_t idx = 0;
+    for (; idx + 2 < size; idx += 3)
+    {
+        const unsigned value = (bytes[idx] << 16) | (bytes[idx + 1] << 8) | bytes[idx + 2];
+        str += BASE64_CHARS[(value >> 18) & 0x3F];
+        str += BASE64_CHARS[(value >> 12) & 0x3F];
+        str += BASE64_CHARS[(value >> 6) & 0x3F];
+        str += BASE64_CHARS[value & 0x3F];
+    }
+
+    if (idx < size)
+    {
+        const bool twoBytes = idx + 1 < size;
+        const unsigned value = (bytes[idx] << 16) | (twoBytes ? (bytes[idx + 1] << 8) : 0);
+        str += BASE64_CHARS[(value >> 18) & 0x3F];
+        str += BASE64_CHARS[(value >> 12) & 0x3F];
+        str += twoBytes ? BASE64_CHARS[(value >> 6) & 0x3F] : '=';
+        str += '=';
+    }
+
+    return str;
+}
+
+bool DecodeBase64(const char * first, const char * last, std::string & data)
+{
+    data.clear();
+    data.reserve(size_t(last - first) / 4 * 3);
+
+    unsigned value = 0;
+    int numBits = 0;
+    int numPadding = 0;
+
+    for (const char * c = first; c != last; ++c)
+    {
+        if (IsSpace(*c))
+        {
+            continue;
+        }
+
+        if (*c == '=')
+        {
+            ++numPadding;
+            continue;
+        }
+
+        const int bits = Base64Value(*c);
+        if (bits < 0 || numPadding > 0)
+        {
+            // Invalid character, or data after the padding.
+            return false;
+        }
+
+        value = (value << 6) | unsigned(bits);
+        numBits += 6;
+
+        if (numBits >= 8)
+        {
+            numBits -= 8;
+            data += char((value >> numBits) & 0xFF);
+        }
+    }
+
+    // The remaining bits (i.e. less than a byte) must be completed by the padding.
+    return numPadding <= 2 && (numBits == 0 || numPadding > 0);
+}
+
 bool StrEqualsCaseIgnore(const std::string & a, const std::string & b)
 {
     return (pystring::lower(a) == pystring::lower(b));
@@ -25,6 +25,65 @@ std::string FloatVecToString(const float * fval, unsigned int size);
 std::string DoubleToString(double value);
 std::string DoubleVecToString(const double * fval, unsigned int size);
 
+// Base64 encoding (RFC 4648) of binary data. The decoding skips the white spaces and returns
+// false if the text is not valid base64.
+std::string EncodeBase64(const char * data, size_t size);
+bool DecodeBase64(const char * first, const char * last, std::string & data);
+
+// Locale independent and allocation free parsing of a number. The leading white spaces are
+// skipped and the parsing stops at the first character which is not part of the number, or
+// at 'last'. Returns the pointer past the number, or nullptr if there is no valid number.
+const char * ParseNumber(const char * first, const char * last, float & value);
+const char * ParseNumber(const char * first, const char * last, double & value);
+const char * ParseNumber(const char * first, const char * last, int & value);
+
+// Parse a line only made of numbers separated by white spaces, without any memory
+// allocation. Returns the number of values, or 0 if the line contains anything else or
+// more than maxValues numbers.
+size_t ParseNumbers(const char * first, const char * last, float * values, size_t maxValues);
+size_t ParseNumbers(const char * first, const char * last, int * values, size_t maxValues);
+
+// Parse a text made of lines of numbers (i.e. the body of most of the text LUT formats) where
+// each line contains exactly numValuesPerLine floats separated by white spaces, the empty
+// lines and, if allowed, the comment lines (i.e. starting with '#') being skipped. The values
+// are appended to 'values'. A large text is split at line boundaries and the parts are parsed
+// concurrently. Returns false if the text contains anything else, the caller then needs to
+// parse it line by line to report the error.
+bool ParseNumberLines(const char * first, const char * last,
+                      size_t numValuesPerLine, bool allowComments,
+                      std::vector<float> & values);
+
+// Read all the remaining characters of the stream.
+std::string ReadRemainingText(std::istream & istream);
+
+// Format the floating point numbers like a given stream (i.e. using its precision, notation
+// and number punctuation) but without the overhead of the standard streams. The output is
+// identical to the stream one.
+class NumberFormatter
+{
+public:
+    NumberFormatter() = delete;
+    explicit NumberFormatter(const std::ostream & os);
+
+    // Append the number to the string, padded with spaces to the width.
+    void append(std::string & str, double value, unsigned width = 0) const;
+
+private:
+    int m_precision;
+    bool m_fixed;
+    // True if the stream uses the default flags and the classic number punctuation.
+    bool m_standard;
+    // Only used for the values which cannot be formatted by the fast path.
+    mutable std::ostringstream m_stream;
+};
+
+// Write the values (i.e. the body of most of the text LUT formats) with numValuesPerLine values
+// per line separated by a space, each line starting with the prefix. The values are formatted
+// like the stream would do (see NumberFormatter).
+void WriteNumberLines(std::ostream & os,
+                      const float * values, size_t numLines, size_t numValuesPerLine,
+                      const char * linePrefix = "");
+
 bool StringToFloat(float * fval, const char * str);
 bool StringToInt(int * ival, const char * str, bool failIfLeftoverChars=false);
 
@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <sstream>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -13,6 +18,14 @@
 #include <random>
 #endif
 
+#ifdef USE_SSE
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 namespace OCIO_NAMESPACE
 {
 
@@ -131,6 +144,163 @@ void CreateTempFilename(std::string & filename, const std::string & filenameExt)
     filename += filenameExt;
 }
 
+namespace
+{
+
+#ifdef USE_SSE
+
+void CpuId(int leaf, int subLeaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex(r, leaf, subLeaf);
+    for (int i = 0; i < 4; ++i) regs[i] = (unsigned int)r[i];
+#else
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// Read the extended control register 0 i.e. the register states saved by the OS.
+unsigned long long GetXCR0()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+#endif // USE_SSE
+
+CPUInfo DetectCPUInfo()
+{
+    CPUInfo info;
+
+#ifdef USE_SSE
+    unsigned int regs[4] = { 0, 0, 0, 0 };
+
+    CpuId(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+
+    if (maxLeaf >= 1)
+    {
+        CpuId(1, 0, regs);
+
+        const bool hasOSXSAVE = (regs[2] & (1u << 27)) != 0;
+        const bool hasAVX     = (regs[2] & (1u << 28)) != 0;
+
+        // The OS must save the SSE and AVX register states.
+        if (hasOSXSAVE && hasAVX && (GetXCR0() & 0x6) == 0x6)
+        {
+            info.hasAVX  = true;
+            info.hasF16C = (regs[2] & (1u << 29)) != 0;
+            info.hasFMA  = (regs[2] & (1u << 12)) != 0;
+
+            if (maxLeaf >= 7)
+            {
+                CpuId(7, 0, regs);
+                info.hasAVX2 = (regs[1] & (1u << 5)) != 0;
+            }
+        }
+    }
+#endif
+
+    return info;
+}
+
+}
+
+const CPUInfo & GetCPUInfo()
+{
+    static const CPUInfo info = DetectCPUInfo();
+    return info;
+}
+
+namespace
+{
+// Number of worker threads currently running the ParallelFor() tasks.
+std::atomic<unsigned> g_numWorkerThreads{ 0 };
+
+// Reserve up to numThreads worker threads, returns the number of threads reserved.
+unsigned ReserveWorkerThreads(unsigned numThreads)
+{
+    // The calling threads are not part of the budget.
+    static const unsigned maxWorkerThreads = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+    unsigned numRunning = g_numWorkerThreads.load();
+    unsigned numReserved = 0;
+    do
+    {
+        numReserved = std::min(numThreads, maxWorkerThreads - std::min(maxWorkerThreads, numRunning));
+    }
+    while (numReserved > 0
+           && !g_numWorkerThreads.compare_exchange_weak(numRunning, numRunning + numReserved));
+
+    return numReserved;
+}
+} // anon.
+
+void ParallelFor(size_t numTasks, const std::function<void(size_t)> & task,
+                 unsigned maxThreads)
+{
+    std::atomic<size_t> next{ 0 };
+    std::vector<std::exception_ptr> errors(numTasks);
+
+    auto runTasks = [&]()
+    {
+        for (size_t idx = next++; idx < numTasks; idx = next++)
+        {
+            try
+            {
+                task(idx);
+            }
+            catch (...)
+            {
+                errors[idx] = std::current_exception();
+            }
+        }
+    };
+
+    const size_t maxWorkerThreads = maxThreads > 0 ? size_t(maxThreads - 1) : size_t(0xFFFF);
+    const size_t numWorkerThreads = numTasks > 1 ? std::min(numTasks - 1, maxWorkerThreads) : 0;
+
+    const unsigned numReserved
+        = numWorkerThreads > 0 ? ReserveWorkerThreads(unsigned(numWorkerThreads)) : 0;
+
+    std::vector<std::thread> threads;
+    for (unsigned idx = 0; idx < numReserved; ++idx)
+    {
+        try
+        {
+            threads.emplace_back(runTasks);
+        }
+        catch (const std::system_error &)
+        {
+            // No more threads available, the remaining tasks are run by the other threads.
+            break;
+        }
+    }
+
+    runTasks();
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    g_numWorkerThreads -= numReserved;
+
+    for (const auto & error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 
 } // Platform
 
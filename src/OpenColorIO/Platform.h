@@ -37,6 +37,7 @@
 #endif // defined(_WIN32)
 
 // general includes
+#include <functional>
 #include <stdio.h>
 #include <math.h>
 #include <assert.h>
@@ -90,6 +91,29 @@ void AlignedFree(void* memBlock);
 // Create a temporary filename where filenameExt could be empty.
 void CreateTempFilename(std::string & filename, const std::string & filenameExt);
 
+// Instruction set extensions supported by the CPU (and the OS) at runtime.
+// Note: All the flags are false when the library is built without SSE support.
+struct CPUInfo
+{
+    bool hasAVX  = false;
+    bool hasAVX2 = false;
+    bool hasF16C = false;
+    bool hasFMA  = false;
+};
+
+// Detect the instruction set extensions once and return the result.
+const CPUInfo & GetCPUInfo();
+
+// Run task(0) to task(numTasks - 1) concurrently, the calling thread included. The worker
+// threads are taken from a budget (i.e. the number of hardware threads) shared by all the
+// concurrent loops of the library so that the nested loops (e.g. the file readers called by
+// the concurrent file loading) do not multiply the threads. Once the budget is exhausted,
+// the tasks are run by the calling thread. The first exception thrown by a task is rethrown.
+// When maxThreads is not 0, at most maxThreads threads (the calling thread included) run the
+// tasks i.e. a value of 1 runs all the tasks on the calling thread.
+void ParallelFor(size_t numTasks, const std::function<void(size_t)> & task,
+                 unsigned maxThreads = 0);
+
 }
 
 } // namespace OCIO_NAMESPACE
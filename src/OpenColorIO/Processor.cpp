@@ -217,6 +217,14 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth, 
+                                                            BitDepth outBitDepth,
+                                                            OptimizationFlags oFlags,
+                                                            float bakeMaxError) const
+{
+    return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags, bakeMaxError);
+}
+
 
 Processor::Impl::Impl():
     m_metadata(ProcessorMetadata::Create())
@@ -226,14 +234,50 @@ Processor::Impl::Impl():
 Processor::Impl::~Impl()
 { }
 
+namespace
+{
+std::string ComputeCacheID(const OpRcPtrVec & ops)
+{
+    if (ops.empty())
+    {
+        return "<NOOP>";
+    }
+
+    std::ostringstream cacheid;
+    for (const auto & op : ops)
+    {
+        cacheid << op->getCacheID() << " ";
+    }
+    const std::string fullstr = cacheid.str();
+
+    return CacheIDHash(fullstr.c_str(), (int)fullstr.size());
+}
+} // anon.
+
+const OpRcPtrVec & Processor::Impl::getOps() const
+{
+    AutoMutex lock(m_opsMutex);
+
+    if (m_hasLazyFileOps)
+    {
+        m_lazyOpsCacheID = ComputeCacheID(m_ops);
+        LoadLazyFileOps(m_ops);
+        m_hasLazyFileOps = false;
+    }
+
+    return m_ops;
+}
+
 bool Processor::Impl::isNoOp() const
 {
+    // The ops of the files not loaded yet are never no-ops.
+    AutoMutex lock(m_opsMutex);
     return IsOpVecNoOp(m_ops);
 }
 
 bool Processor::Impl::hasChannelCrosstalk() const
 {
-    for(const auto & op : m_ops)
+    for(const auto & op : getOps())
     {
         if(op->hasChannelCrosstalk()) return true;
     }
@@ -249,17 +293,17 @@ ConstProcessorMetadataRcPtr Processor::Impl::getProcessorMetadata() const
 
 const FormatMetadata & Processor::Impl::getFormatMetadata() const
 {
-    return m_ops.getFormatMetadata();
+    return getOps().getFormatMetadata();
 }
 
 int Processor::Impl::getNumTransforms() const
 {
-    return (int)m_ops.size();
+    return (int)getOps().size();
 }
 
 const FormatMetadata & Processor::Impl::getTransformFormatMetadata(int index) const
 {
-    auto op = OCIO_DYNAMIC_POINTER_CAST<const Op>(m_ops[index]);
+    auto op = OCIO_DYNAMIC_POINTER_CAST<const Op>(getOps()[index]);
     return op->data()->getFormatMetadata();
 }
 
@@ -271,7 +315,7 @@ GroupTransformRcPtr Processor::Impl::createGroupTransform() const
     group->getFormatMetadata() = getFormatMetadata();
 
     // Build transforms from ops.
-    for (ConstOpRcPtr op : m_ops)
+    for (ConstOpRcPtr op : getOps())
     {
         CreateTransform(group, op);
     }
@@ -294,7 +338,7 @@ void Processor::Impl::write(const char * formatName, std::ostream & os) const
     try
     {
         std::string fName{ formatName };
-        fmt->write(m_ops, getFormatMetadata(), fName, os);
+        fmt->write(getOps(), getFormatMetadata(), fName, os);
     }
     catch (std::exception & e)
     {
@@ -307,7 +351,7 @@ void Processor::Impl::write(const char * formatName, std::ostream & os) const
 
 bool Processor::Impl::hasDynamicProperty(DynamicPropertyType type) const
 {
-    for (const auto & op : m_ops)
+    for (const auto & op : getOps())
     {
         if (op->hasDynamicProperty(type))
         {
@@ -319,7 +363,7 @@ bool Processor::Impl::hasDynamicProperty(DynamicPropertyType type) const
 
 DynamicPropertyRcPtr Processor::Impl::getDynamicProperty(DynamicPropertyType type) const
 {
-    for(const auto & op : m_ops)
+    for(const auto & op : getOps())
     {
         if(op->hasDynamicProperty(type))
         {
@@ -336,21 +380,11 @@ const char * Processor::Impl::getCacheID() const
 
     if(!m_cpuCacheID.empty()) return m_cpuCacheID.c_str();
 
-    if(m_ops.empty())
-    {
-        m_cpuCacheID = "<NOOP>";
-    }
-    else
-    {
-        std::ostringstream cacheid;
-        for(const auto & op : m_ops)
-        {
-            cacheid << op->getCacheID() << " ";
-        }
-        std::string fullstr = cacheid.str();
+    // The ops of the files not loaded yet are identified by the file paths and hashes, even
+    // once the files are loaded.
+    AutoMutex opsLock(m_opsMutex);
 
-        m_cpuCacheID = CacheIDHash(fullstr.c_str(), (int)fullstr.size());
-    }
+    m_cpuCacheID = m_lazyOpsCacheID.empty() ? ComputeCacheID(m_ops) : m_lazyOpsCacheID;
 
     return m_cpuCacheID.c_str();
 }
@@ -361,7 +395,7 @@ ConstGPUProcessorRcPtr Processor::Impl::getDefaultGPUProcessor() const
 {
     GPUProcessorRcPtr gpu = GPUProcessorRcPtr(new GPUProcessor(), &GPUProcessor::deleter);
 
-    gpu->getImpl()->finalize(m_ops, OPTIMIZATION_DEFAULT);
+    gpu->getImpl()->finalize(getOps(), OPTIMIZATION_DEFAULT);
 
     return gpu;
 }
@@ -370,7 +404,7 @@ ConstGPUProcessorRcPtr Processor::Impl::getOptimizedGPUProcessor(OptimizationFla
 {
     GPUProcessorRcPtr gpu = GPUProcessorRcPtr(new GPUProcessor(), &GPUProcessor::deleter);
 
-    gpu->getImpl()->finalize(m_ops, oFlags);
+    gpu->getImpl()->finalize(getOps(), oFlags);
 
     return gpu;
 }
@@ -381,7 +415,7 @@ ConstCPUProcessorRcPtr Processor::Impl::getDefaultCPUProcessor() const
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops, 
+    cpu->getImpl()->finalize(getOps(),
                                 BIT_DEPTH_F32, BIT_DEPTH_F32, 
                                 OPTIMIZATION_DEFAULT);
 
@@ -392,7 +426,7 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(OptimizationFla
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops,
+    cpu->getImpl()->finalize(getOps(),
                                 BIT_DEPTH_F32, BIT_DEPTH_F32,
                                 oFlags);
 
@@ -405,7 +439,19 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
 {
     CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
 
-    cpu->getImpl()->finalize(m_ops, inBitDepth, outBitDepth, oFlags);
+    cpu->getImpl()->finalize(getOps(), inBitDepth, outBitDepth, oFlags);
+
+    return cpu;
+}
+
+ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitDepth, 
+                                                                    BitDepth outBitDepth,
+                                                                    OptimizationFlags oFlags,
+                                                                    float bakeMaxError) const
+{
+    CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
+
+    cpu->getImpl()->finalize(getOps(), inBitDepth, outBitDepth, oFlags, bakeMaxError);
 
     return cpu;
 }
@@ -426,6 +472,7 @@ void Processor::Impl::setColorSpaceConversion(const Config & config,
     BuildColorSpaceOps(m_ops, config, context, srcColorSpace, dstColorSpace);
     FinalizeOpVec(m_ops, OPTIMIZATION_NONE);
     UnifyDynamicProperties(m_ops);
+    m_hasLazyFileOps = HasLazyFileOps(m_ops);
 }
 
 void Processor::Impl::setTransform(const Config & config,
@@ -441,6 +488,7 @@ void Processor::Impl::setTransform(const Config & config,
     BuildOps(m_ops, config, context, transform, direction);
     FinalizeOpVec(m_ops, OPTIMIZATION_NONE);
     UnifyDynamicProperties(m_ops);
+    m_hasLazyFileOps = HasLazyFileOps(m_ops);
 }
 
 void Processor::Impl::computeMetadata()
@@ -18,13 +18,22 @@ class Processor::Impl
 private:
     ProcessorMetadataRcPtr m_metadata;
 
-    // Vector of ops for the processor.
-    OpRcPtrVec m_ops;
+    // Vector of ops for the processor. The file ops are loaded on demand when the lazy
+    // file loading is enabled (refer to getOps()).
+    mutable OpRcPtrVec m_ops;
+    mutable bool m_hasLazyFileOps = false;
+    mutable Mutex m_opsMutex;
+    // The cache id of the ops of the files not loaded yet, kept once the files are loaded so
+    // that the cache id does not depend on when the files are loaded.
+    mutable std::string m_lazyOpsCacheID;
 
     mutable std::string m_cpuCacheID;
 
     mutable Mutex m_resultsCacheMutex;
 
+    // Get the ops, loading the pending files first.
+    const OpRcPtrVec & getOps() const;
+
 public:
     Impl();
     ~Impl();
@@ -67,6 +76,12 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    // Same as above with the maximum error allowed when baking ops into a 3D LUT.
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    float bakeMaxError) const;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -10,6 +10,7 @@
 
 
 #include <emmintrin.h>
+#include <immintrin.h>
 #include <stdio.h>
 
 
@@ -32,6 +33,16 @@ namespace OCIO_NAMESPACE
 #endif
 
 
+// Functions using AVX2 and F16C instructions are compiled for these instruction
+// sets only, the rest of the library does not require them. Such functions must
+// only be called when Platform::GetCPUInfo() reports the support at runtime.
+#if defined( _MSC_VER )
+#define OCIO_TARGET_AVX2
+#else
+#define OCIO_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#endif
+
+
 #include <limits>
 
 static constexpr int EXP_MASK   = 0x7F800000;
@@ -271,6 +282,477 @@ inline __m128 ssePower(__m128 x, __m128 exp)
     return values;
 }
 
+// Accurate versions of the log2, exp2 and power functions
+//
+// The functions above are the fast tier: they have about 15 bits of mantissa (i.e. a relative
+// error below 1e-4 for pow). The functions below are the accurate tier: the computations are
+// done in double precision so the float results are faithfully rounded (i.e. within 1 ulp of
+// the exact result, as powf() is), at about three times the cost of the fast tier. The
+// OPTIMIZATION_FAST_LOG_EXP_POW optimization flag selects the tier used by the CPU renderers
+// (refer to FastPower() & co. in MathUtils.h for the scalar version of the fast tier).
+
+// Coefficients of the series ln(m) = 2 * (t + t^3/3 + t^5/5 + ...) with t = (m-1)/(m+1).
+static const __m128d PDLOG6 = _mm_set1_pd(1. / 13.);
+static const __m128d PDLOG5 = _mm_set1_pd(1. / 11.);
+static const __m128d PDLOG4 = _mm_set1_pd(1. /  9.);
+static const __m128d PDLOG3 = _mm_set1_pd(1. /  7.);
+static const __m128d PDLOG2 = _mm_set1_pd(1. /  5.);
+static const __m128d PDLOG1 = _mm_set1_pd(1. /  3.);
+
+// Coefficients of the Taylor series of exp(z) i.e. 1/k!.
+static const __m128d PDEXP10 = _mm_set1_pd(1. / 3628800.);
+static const __m128d PDEXP9  = _mm_set1_pd(1. / 362880.);
+static const __m128d PDEXP8  = _mm_set1_pd(1. / 40320.);
+static const __m128d PDEXP7  = _mm_set1_pd(1. / 5040.);
+static const __m128d PDEXP6  = _mm_set1_pd(1. / 720.);
+static const __m128d PDEXP5  = _mm_set1_pd(1. / 120.);
+static const __m128d PDEXP4  = _mm_set1_pd(1. / 24.);
+static const __m128d PDEXP3  = _mm_set1_pd(1. / 6.);
+static const __m128d PDEXP2  = _mm_set1_pd(1. / 2.);
+
+static const __m128d EDONE = _mm_set1_pd(1.);
+
+// log2 of two positive and finite double values.
+//
+// log2( x ) = exposant + log2( mantissa ) with the mantissa in [sqrt(0.5), sqrt(2)[ so that
+// the series converges quickly.
+inline __m128d sseLog2Double(__m128d x)
+{
+    const __m128d mantMask = _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+
+    __m128d mantissa = _mm_or_pd(_mm_and_pd(x, mantMask), EDONE);
+
+    // Extract the biased exponents and move them to the two lower 32-bit integers.
+    const __m128i expBits = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+    __m128d exponent
+        = _mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(expBits, _MM_SHUFFLE(3, 3, 2, 0))),
+                     _mm_set1_pd(1023.));
+
+    const __m128d isAbove = _mm_cmpgt_pd(mantissa, _mm_set1_pd(1.4142135623730951));
+    mantissa = _mm_sub_pd(mantissa, _mm_and_pd(isAbove, _mm_mul_pd(mantissa, _mm_set1_pd(0.5))));
+    exponent = _mm_add_pd(exponent, _mm_and_pd(isAbove, EDONE));
+
+    const __m128d t  = _mm_div_pd(_mm_sub_pd(mantissa, EDONE), _mm_add_pd(mantissa, EDONE));
+    const __m128d t2 = _mm_mul_pd(t, t);
+
+    __m128d poly = _mm_add_pd(_mm_mul_pd(PDLOG6, t2), PDLOG5);
+    poly = _mm_add_pd(_mm_mul_pd(poly, t2), PDLOG4);
+    poly = _mm_add_pd(_mm_mul_pd(poly, t2), PDLOG3);
+    poly = _mm_add_pd(_mm_mul_pd(poly, t2), PDLOG2);
+    poly = _mm_add_pd(_mm_mul_pd(poly, t2), PDLOG1);
+    poly = _mm_add_pd(_mm_mul_pd(poly, t2), EDONE);
+
+    // 2 / ln(2) converts 2 * t * poly (i.e. ln(mantissa)) to log2(mantissa).
+    const __m128d log2Mantissa = _mm_mul_pd(_mm_mul_pd(t, poly), _mm_set1_pd(2.8853900817779268));
+
+    return _mm_add_pd(exponent, log2Mantissa);
+}
+
+// exp2 of two double values, the result being only accurate enough for a float.
+//
+// exp2( x ) = exp2( integer ) * exp( fraction * ln(2) ) with the fraction in [-0.5, 0.5].
+inline __m128d sseExp2Double(__m128d x)
+{
+    // Clamp to the range producing a finite non-zero float result (with some margin) so
+    // that the exponent of the double stays valid. Note that a NaN becomes the lower limit.
+    x = _mm_min_pd(_mm_max_pd(x, _mm_set1_pd(-160.)), _mm_set1_pd(130.));
+
+    const __m128i integer = _mm_cvtpd_epi32(x);
+    const __m128d z = _mm_mul_pd(_mm_sub_pd(x, _mm_cvtepi32_pd(integer)),
+                                 _mm_set1_pd(0.69314718055994531));
+
+    __m128d poly = _mm_add_pd(_mm_mul_pd(PDEXP10, z), PDEXP9);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP8);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP7);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP6);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP5);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP4);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP3);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), PDEXP2);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), EDONE);
+    poly = _mm_add_pd(_mm_mul_pd(poly, z), EDONE);
+
+    // Compute exp2(integer) by moving the biased integers to the exponent bits of the doubles.
+    const __m128i biased = _mm_add_epi32(integer, _mm_set1_epi32(1023));
+    const __m128d scale
+        = _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(biased, _mm_setzero_si128()), 52));
+
+    return _mm_mul_pd(poly, scale);
+}
+
+// Accurate log2 function in SSE version 2.
+//
+// Zero gives -inf, +inf gives +inf and negative values give NaN.
+inline __m128 sseLog2Accurate(__m128 x)
+{
+    const __m128d lo = sseLog2Double(_mm_cvtps_pd(x));
+    const __m128d hi = sseLog2Double(_mm_cvtps_pd(_mm_movehl_ps(x, x)));
+
+    __m128 log2 = _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+
+    log2 = sseSelect(_mm_cmpeq_ps(x, EPOSINF), EPOSINF, log2);
+    log2 = sseSelect(_mm_cmpeq_ps(x, EZERO), _mm_set1_ps(-std::numeric_limits<float>::infinity()), log2);
+    log2 = sseSelect(_mm_cmpnge_ps(x, EZERO), _mm_set1_ps(std::numeric_limits<float>::quiet_NaN()), log2);
+
+    return log2;
+}
+
+// Accurate exp2 function in SSE version 2.
+//
+// Large values give +inf and small values give zero (including the denormalized floats).
+inline __m128 sseExp2Accurate(__m128 x)
+{
+    const __m128d lo = sseExp2Double(_mm_cvtps_pd(x));
+    const __m128d hi = sseExp2Double(_mm_cvtps_pd(_mm_movehl_ps(x, x)));
+
+    const __m128 exp2 = _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+
+    // Preserve the NaNs.
+    return sseSelect(_mm_cmpunord_ps(x, x), x, exp2);
+}
+
+// Accurate power function in SSE version 2.
+//
+// Same as ssePower() i.e. results from base values smaller than or equal to zero are mapped
+// to zero, but the intermediate log2 value is kept in double precision.
+inline __m128 ssePowerAccurate(__m128 x, __m128 exp)
+{
+    // Avoid the garbage values of the bases smaller or equal than zero, and the infinity.
+    const __m128 isPositive = _mm_cmpgt_ps(x, EZERO);
+    const __m128 isInf = _mm_cmpeq_ps(x, EPOSINF);
+    const __m128 base = sseSelect(_mm_andnot_ps(isInf, isPositive), x, EONE);
+
+    const __m128d lo = sseExp2Double(_mm_mul_pd(_mm_cvtps_pd(exp),
+                                                sseLog2Double(_mm_cvtps_pd(base))));
+    const __m128d hi = sseExp2Double(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(exp, exp)),
+                                                sseLog2Double(_mm_cvtps_pd(_mm_movehl_ps(base, base)))));
+
+    __m128 values = _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+
+    // The power of +inf is +inf, 1 or 0 for positive, zero or negative exponents.
+    const __m128 powInf = _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(exp, EZERO), EPOSINF),
+                                    _mm_and_ps(_mm_cmpeq_ps(exp, EZERO), EONE));
+    values = sseSelect(isInf, powInf, values);
+
+    // Handle values where base is smaller or equal than zero
+    values = _mm_and_ps(values, isPositive);
+
+    return values;
+}
+
+// The power function of the requested tier.
+inline __m128 ssePower(__m128 x, __m128 exp, bool fast)
+{
+    return fast ? ssePower(x, exp) : ssePowerAccurate(x, exp);
+}
+
+// The log2 function of the requested tier.
+inline __m128 sseLog2(__m128 x, bool fast)
+{
+    return fast ? sseLog2(x) : sseLog2Accurate(x);
+}
+
+// The exp2 function of the requested tier.
+inline __m128 sseExp2(__m128 x, bool fast)
+{
+    return fast ? sseExp2(x) : sseExp2Accurate(x);
+}
+
+// AVX2 versions of the log2, exp2 and power functions of both tiers i.e. the same computations
+// on eight values, so the results are identical to the SSE ones. The constants are local to the
+// functions so that no AVX instruction is executed at the static initialization.
+
+// The fast log2 function (see sseLog2()).
+OCIO_TARGET_AVX2 inline __m256 avx2Log2(__m256 x)
+{
+    const __m256i emask = _mm256_set1_epi32(EXP_MASK);
+
+    const __m256 mantissa
+        = _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(emask), x), _mm256_set1_ps(1.0f));
+
+    __m256 log2 = _mm256_set1_ps((float)+4.487361286440374006195e-2);
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)-4.165637071209677112635e-1));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)+1.631148826119436277100));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)-3.550793018041176193407));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)+5.091710879305474367557));
+    log2 = _mm256_add_ps(_mm256_mul_ps(log2, mantissa),
+                         _mm256_set1_ps((float)-2.800364054395965731506));
+
+    const __m256i exponent
+        = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(x), emask),
+                                             EXP_SHIFT),
+                           _mm256_set1_epi32(EXP_BIAS));
+
+    return _mm256_add_ps(log2, _mm256_cvtepi32_ps(exponent));
+}
+
+// The fast exp2 function (see sseExp2()).
+OCIO_TARGET_AVX2 inline __m256 avx2Exp2(__m256 x)
+{
+    // floor(x) i.e. the truncation minus one for the negative values.
+    const __m256i floor_x
+        = _mm256_add_epi32(_mm256_cvttps_epi32(x),
+                           _mm256_castps_si256(_mm256_cmp_ps(_mm256_setzero_ps(), x,
+                                                             _CMP_NLE_UQ)));
+
+    const __m256 zf
+        = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(floor_x, _mm256_set1_epi32(EXP_BIAS)),
+                              EXP_SHIFT));
+
+    const __m256 iexp = _mm256_cvtepi32_ps(floor_x);
+    const __m256 fraction = _mm256_sub_ps(x, iexp);
+
+    __m256 mexp = _mm256_set1_ps((float)1.353416792833547468620e-2);
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)5.201146058412685018921e-2));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)2.414427569091865207710e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)6.930038344665415134202e-1));
+    mexp = _mm256_add_ps(_mm256_mul_ps(mexp, fraction),
+                         _mm256_set1_ps((float)1.000002593370603213644));
+
+    __m256 exp2 = _mm256_mul_ps(zf, mexp);
+
+    // Handle the underflow and overflow.
+    exp2 = _mm256_andnot_ps(_mm256_cmp_ps(iexp, _mm256_set1_ps(-126.0f), _CMP_LT_OQ), exp2);
+    exp2 = _mm256_blendv_ps(exp2,
+                            _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(iexp, _mm256_set1_ps(127.0f), _CMP_GT_OQ));
+
+    return exp2;
+}
+
+// The fast power function (see ssePower()).
+OCIO_TARGET_AVX2 inline __m256 avx2Power(__m256 x, __m256 exp)
+{
+    const __m256 values = avx2Exp2(_mm256_mul_ps(exp, avx2Log2(x)));
+
+    // Handle values where base is smaller or equal than zero
+    return _mm256_and_ps(values, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+
+// log2 of four positive and finite double values (see sseLog2Double()).
+OCIO_TARGET_AVX2 inline __m256d avx2Log2Double(__m256d x)
+{
+    const __m256d one = _mm256_set1_pd(1.);
+    const __m256d mantMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+
+    __m256d mantissa = _mm256_or_pd(_mm256_and_pd(x, mantMask), one);
+
+    // Extract the biased exponents and move them to the four lower 32-bit integers.
+    const __m256i expBits = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(_mm256_castpd_si256(x), 52),
+                                                        _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0));
+    __m256d exponent = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(expBits)),
+                                     _mm256_set1_pd(1023.));
+
+    const __m256d isAbove = _mm256_cmp_pd(mantissa, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    mantissa = _mm256_sub_pd(mantissa,
+                             _mm256_and_pd(isAbove, _mm256_mul_pd(mantissa, _mm256_set1_pd(0.5))));
+    exponent = _mm256_add_pd(exponent, _mm256_and_pd(isAbove, one));
+
+    const __m256d t  = _mm256_div_pd(_mm256_sub_pd(mantissa, one), _mm256_add_pd(mantissa, one));
+    const __m256d t2 = _mm256_mul_pd(t, t);
+
+    __m256d poly = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1. / 13.), t2), _mm256_set1_pd(1. / 11.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, t2), _mm256_set1_pd(1. / 9.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, t2), _mm256_set1_pd(1. / 7.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, t2), _mm256_set1_pd(1. / 5.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, t2), _mm256_set1_pd(1. / 3.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, t2), one);
+
+    const __m256d log2Mantissa
+        = _mm256_mul_pd(_mm256_mul_pd(t, poly), _mm256_set1_pd(2.8853900817779268));
+
+    return _mm256_add_pd(exponent, log2Mantissa);
+}
+
+// exp2 of four double values, the result being only accurate enough for a float (see
+// sseExp2Double()).
+OCIO_TARGET_AVX2 inline __m256d avx2Exp2Double(__m256d x)
+{
+    const __m256d one = _mm256_set1_pd(1.);
+
+    x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-160.)), _mm256_set1_pd(130.));
+
+    const __m128i integer = _mm256_cvtpd_epi32(x);
+    const __m256d z = _mm256_mul_pd(_mm256_sub_pd(x, _mm256_cvtepi32_pd(integer)),
+                                    _mm256_set1_pd(0.69314718055994531));
+
+    __m256d poly = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1. / 3628800.), z),
+                                 _mm256_set1_pd(1. / 362880.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 40320.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 5040.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 720.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 120.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 24.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 6.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), _mm256_set1_pd(1. / 2.));
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), one);
+    poly = _mm256_add_pd(_mm256_mul_pd(poly, z), one);
+
+    // Compute exp2(integer) by moving the biased integers to the exponent bits of the doubles.
+    const __m256i biased = _mm256_cvtepi32_epi64(_mm_add_epi32(integer, _mm_set1_epi32(1023)));
+    const __m256d scale = _mm256_castsi256_pd(_mm256_slli_epi64(biased, 52));
+
+    return _mm256_mul_pd(poly, scale);
+}
+
+// The accurate log2 function (see sseLog2Accurate()).
+OCIO_TARGET_AVX2 inline __m256 avx2Log2Accurate(__m256 x)
+{
+    const __m256d lo = avx2Log2Double(_mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+    const __m256d hi = avx2Log2Double(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+
+    __m256 log2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)),
+                                       _mm256_cvtpd_ps(hi), 1);
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 inf  = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+
+    log2 = _mm256_blendv_ps(log2, inf, _mm256_cmp_ps(x, inf, _CMP_EQ_OQ));
+    log2 = _mm256_blendv_ps(log2, _mm256_set1_ps(-std::numeric_limits<float>::infinity()),
+                            _mm256_cmp_ps(x, zero, _CMP_EQ_OQ));
+    log2 = _mm256_blendv_ps(log2, _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN()),
+                            _mm256_cmp_ps(x, zero, _CMP_NGE_UQ));
+
+    return log2;
+}
+
+// The accurate exp2 function (see sseExp2Accurate()).
+OCIO_TARGET_AVX2 inline __m256 avx2Exp2Accurate(__m256 x)
+{
+    const __m256d lo = avx2Exp2Double(_mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+    const __m256d hi = avx2Exp2Double(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+
+    const __m256 exp2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)),
+                                             _mm256_cvtpd_ps(hi), 1);
+
+    // Preserve the NaNs.
+    return _mm256_blendv_ps(exp2, x, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+}
+
+// The accurate power function (see ssePowerAccurate()).
+OCIO_TARGET_AVX2 inline __m256 avx2PowerAccurate(__m256 x, __m256 exp)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps(1.0f);
+    const __m256 inf  = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+
+    // Avoid the garbage values of the bases smaller or equal than zero, and the infinity.
+    const __m256 isPositive = _mm256_cmp_ps(x, zero, _CMP_GT_OQ);
+    const __m256 isInf = _mm256_cmp_ps(x, inf, _CMP_EQ_OQ);
+    const __m256 base = _mm256_blendv_ps(one, x, _mm256_andnot_ps(isInf, isPositive));
+
+    const __m256d lo
+        = avx2Exp2Double(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(exp)),
+                                       avx2Log2Double(_mm256_cvtps_pd(_mm256_castps256_ps128(base)))));
+    const __m256d hi
+        = avx2Exp2Double(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(exp, 1)),
+                                       avx2Log2Double(_mm256_cvtps_pd(_mm256_extractf128_ps(base, 1)))));
+
+    __m256 values = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)),
+                                         _mm256_cvtpd_ps(hi), 1);
+
+    // The power of +inf is +inf, 1 or 0 for positive, zero or negative exponents.
+    const __m256 powInf = _mm256_or_ps(_mm256_and_ps(_mm256_cmp_ps(exp, zero, _CMP_GT_OQ), inf),
+                                       _mm256_and_ps(_mm256_cmp_ps(exp, zero, _CMP_EQ_OQ), one));
+    values = _mm256_blendv_ps(values, powInf, isInf);
+
+    // Handle values where base is smaller or equal than zero
+    return _mm256_and_ps(values, isPositive);
+}
+
+// The power function of the requested tier.
+OCIO_TARGET_AVX2 inline __m256 avx2Power(__m256 x, __m256 exp, bool fast)
+{
+    return fast ? avx2Power(x, exp) : avx2PowerAccurate(x, exp);
+}
+
+// The log2 function of the requested tier.
+OCIO_TARGET_AVX2 inline __m256 avx2Log2(__m256 x, bool fast)
+{
+    return fast ? avx2Log2(x) : avx2Log2Accurate(x);
+}
+
+// The exp2 function of the requested tier.
+OCIO_TARGET_AVX2 inline __m256 avx2Exp2(__m256 x, bool fast)
+{
+    return fast ? avx2Exp2(x) : avx2Exp2Accurate(x);
+}
+
+// Load 4 RGBA pixels so that each register holds one channel.
+inline void sseLoadRGBA(const float * in, __m128 & red, __m128 & grn, __m128 & blu, __m128 & alpha)
+{
+    red   = _mm_loadu_ps(in);
+    grn   = _mm_loadu_ps(in + 4);
+    blu   = _mm_loadu_ps(in + 8);
+    alpha = _mm_loadu_ps(in + 12);
+    _MM_TRANSPOSE4_PS(red, grn, blu, alpha);
+}
+
+// Store 4 RGBA pixels from the channel registers.
+inline void sseStoreRGBA(float * out, __m128 red, __m128 grn, __m128 blu, __m128 alpha)
+{
+    _MM_TRANSPOSE4_PS(red, grn, blu, alpha);
+    _mm_storeu_ps(out,      red);
+    _mm_storeu_ps(out + 4,  grn);
+    _mm_storeu_ps(out + 8,  blu);
+    _mm_storeu_ps(out + 12, alpha);
+}
+
+// Load 8 RGBA pixels so that each register holds one channel.
+OCIO_TARGET_AVX2
+inline void avx2LoadRGBA(const float * in, __m256 & red, __m256 & grn, __m256 & blu, __m256 & alpha)
+{
+    const __m256 p01 = _mm256_loadu_ps(in);
+    const __m256 p23 = _mm256_loadu_ps(in + 8);
+    const __m256 p45 = _mm256_loadu_ps(in + 16);
+    const __m256 p67 = _mm256_loadu_ps(in + 24);
+
+    // The lower lane holds the pixels 0 to 3 and the upper lane the pixels 4 to 7.
+    const __m256 p04 = _mm256_permute2f128_ps(p01, p45, 0x20);
+    const __m256 p15 = _mm256_permute2f128_ps(p01, p45, 0x31);
+    const __m256 p26 = _mm256_permute2f128_ps(p23, p67, 0x20);
+    const __m256 p37 = _mm256_permute2f128_ps(p23, p67, 0x31);
+
+    // Transpose each lane.
+    const __m256 tmp0 = _mm256_unpacklo_ps(p04, p15);
+    const __m256 tmp1 = _mm256_unpackhi_ps(p04, p15);
+    const __m256 tmp2 = _mm256_unpacklo_ps(p26, p37);
+    const __m256 tmp3 = _mm256_unpackhi_ps(p26, p37);
+
+    red   = _mm256_shuffle_ps(tmp0, tmp2, 0x44);
+    grn   = _mm256_shuffle_ps(tmp0, tmp2, 0xEE);
+    blu   = _mm256_shuffle_ps(tmp1, tmp3, 0x44);
+    alpha = _mm256_shuffle_ps(tmp1, tmp3, 0xEE);
+}
+
+// Store 8 RGBA pixels from the channel registers.
+OCIO_TARGET_AVX2
+inline void avx2StoreRGBA(float * out, __m256 red, __m256 grn, __m256 blu, __m256 alpha)
+{
+    const __m256 tmp0 = _mm256_unpacklo_ps(red, grn);
+    const __m256 tmp1 = _mm256_unpackhi_ps(red, grn);
+    const __m256 tmp2 = _mm256_unpacklo_ps(blu, alpha);
+    const __m256 tmp3 = _mm256_unpackhi_ps(blu, alpha);
+
+    const __m256 p04 = _mm256_shuffle_ps(tmp0, tmp2, 0x44);
+    const __m256 p15 = _mm256_shuffle_ps(tmp0, tmp2, 0xEE);
+    const __m256 p26 = _mm256_shuffle_ps(tmp1, tmp3, 0x44);
+    const __m256 p37 = _mm256_shuffle_ps(tmp1, tmp3, 0xEE);
+
+    _mm256_storeu_ps(out,      _mm256_permute2f128_ps(p04, p15, 0x20));
+    _mm256_storeu_ps(out + 8,  _mm256_permute2f128_ps(p26, p37, 0x20));
+    _mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(p04, p15, 0x31));
+    _mm256_storeu_ps(out + 24, _mm256_permute2f128_ps(p26, p37, 0x31));
+}
+
 static const __m128 ESIGN_MASK = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
 static const __m128 EABS_MASK  = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
 
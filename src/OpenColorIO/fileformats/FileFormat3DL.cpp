@@ -4,10 +4,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
@@ -112,6 +114,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
 };
 
 
@@ -253,6 +260,19 @@ CachedFileRcPtr LocalFileFormat::read(
             istream.getline(lineBuffer, MAX_LINE_SIZE);
             ++lineNumber;
 
+            // Most of the lines are the 3D LUT entries so parse them first without any
+            // string manipulation.
+            int rgb[3];
+            if (ParseNumbers(lineBuffer, lineBuffer + strlen(lineBuffer), rgb, 3) == 3)
+            {
+                raw3d.insert(raw3d.end(), rgb, rgb + 3);
+                // Find the maximum shaper LUT value to infer bit-depth.
+                lut3dmax = std::max(lut3dmax, rgb[0]);
+                lut3dmax = std::max(lut3dmax, rgb[1]);
+                lut3dmax = std::max(lut3dmax, rgb[2]);
+                continue;
+            }
+
             // Strip and split the line.
             pystring::split(pystring::strip(lineBuffer), lineParts);
 
@@ -512,11 +532,6 @@ void LocalFileFormat::bake(const Baker & baker,
     int shaperSize = baker.getShaperSize();
     if(shaperSize==-1) shaperSize = cubeSize;
 
-    std::vector<float> cubeData;
-    cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-    GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
     // Apply our conversion from the input space to the output space.
     ConstProcessorRcPtr inputToTarget;
     std::string looks = baker.getLooks();
@@ -534,8 +549,9 @@ void LocalFileFormat::bake(const Baker & baker,
         inputToTarget = config->getProcessor(baker.getInputSpace(),
             baker.getTargetSpace());
     }
-    ConstCPUProcessorRcPtr cpu = inputToTarget->getDefaultCPUProcessor();
-    cpu->apply(cubeImg);
+    const std::vector<float> cubeData
+        = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_BLUE,
+                    { inputToTarget->getDefaultCPUProcessor() });
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -585,6 +601,31 @@ void LocalFileFormat::bake(const Baker & baker,
     }
 }
 
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.writeLut3D(cachedFile->lut3D);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->lut3D = reader.readLut3D();
+
+    return cachedFile;
+}
+
 void
 LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                 const Config & /*config*/,
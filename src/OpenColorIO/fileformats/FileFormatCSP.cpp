@@ -13,6 +13,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -699,9 +700,6 @@ void LocalFileFormat::bake(const Baker & baker,
     if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
     cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
     std::vector<float> cubeData;
-    cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-    GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
 
     std::string looks = baker.getLooks();
 
@@ -741,8 +739,7 @@ void LocalFileFormat::bake(const Baker & baker,
             os << "Please select an alternate shaper space or omit this option.";
             throw Exception(os.str().c_str());
         }
-        PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
-        shaperToInput->apply(shaperInImg);
+        ApplyBakerProcessors(baker, { shaperToInput }, shaperInData.data(), shaperSize);
 
         ConstCPUProcessorRcPtr shaperToTarget;
         if (!looks.empty())
@@ -761,7 +758,7 @@ void LocalFileFormat::bake(const Baker & baker,
                 = config->getProcessor(baker.getShaperSpace(), 
                                         baker.getTargetSpace())->getDefaultCPUProcessor();
         }
-        shaperToTarget->apply(cubeImg);
+        cubeData = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED, { shaperToTarget });
     }
     else
     {
@@ -813,9 +810,7 @@ void LocalFileFormat::bake(const Baker & baker,
         ConstCPUProcessorRcPtr shaperToInput
             = config->getProcessor(allocationTransform, TRANSFORM_DIR_INVERSE)->getDefaultCPUProcessor();
 
-        PackedImageDesc shaperInImg(&shaperInData[0], shaperSize, 1, 3);
-        shaperToInput->apply(shaperInImg);
-        shaperToInput->apply(cubeImg);
+        ApplyBakerProcessors(baker, { shaperToInput }, shaperInData.data(), shaperSize);
 
         // Apply the 3D LUT to the remainder (from the input to the output).
         ConstProcessorRcPtr inputToTarget;
@@ -832,8 +827,9 @@ void LocalFileFormat::bake(const Baker & baker,
         {
             inputToTarget = config->getProcessor(baker.getInputSpace(), baker.getTargetSpace());
         }
-        ConstCPUProcessorRcPtr cpu = inputToTarget->getDefaultCPUProcessor();
-        cpu->apply(cubeImg);
+        // Both processors are applied to each block of the cube.
+        cubeData = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED,
+                             { shaperToInput, inputToTarget->getDefaultCPUProcessor() });
     }
 
     // Write out the file.
@@ -888,10 +884,7 @@ void LocalFileFormat::bake(const Baker & baker,
         throw Exception("Internal cube size exception.");
     }
     ostream << cubeSize << " " << cubeSize << " " << cubeSize << "\n";
-    for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-    {
-        ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
-    }
+    WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3);
     ostream << "\n";
 }
 
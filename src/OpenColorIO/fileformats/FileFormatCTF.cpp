@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdio>
 #include <iostream>
 #include <fstream>
@@ -8,6 +9,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "expat.h"
 #include "fileformats/ctf/CTFTransform.h"
 #include "fileformats/ctf/CTFReaderHelper.h"
@@ -20,6 +22,7 @@
 #include "ops/range/RangeOp.h"
 #include "OpBuilders.h"
 #include "ops/noop/NoOps.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "pystring/pystring.h"
 #include "transforms/FileTransform.h"
@@ -154,6 +157,12 @@ void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
                          FORMAT_CAPABILITY_BAKE |
                          FORMAT_CAPABILITY_WRITE;
     formatInfoVec.push_back(info2);
+
+    FormatInfo info3;
+    info3.name = FILEFORMAT_CTF_BASE64;
+    info3.extension = "ctf";
+    info3.capabilities = FORMAT_CAPABILITY_WRITE;
+    formatInfoVec.push_back(info3);
 }
 
 class XMLParserHelper
@@ -182,22 +191,46 @@ public:
 
     void Parse(std::istream & istream)
     {
-        std::string line;
-        m_lineNumber = 0;
-        while (istream.good())
+        // Read the whole file and feed the parser with large blocks (rather than line by
+        // line) to limit the overhead of the parser calls.
+        m_buffer = ReadRemainingText(istream);
+        m_countedOffset = 0;
+        m_countedLines  = 0;
+
+        // The end of file errors are reported after the last line.
+        const unsigned int endLineNumber
+            = (unsigned int)std::count(m_buffer.begin(), m_buffer.end(), '\n') + 1;
+
+        // Our code is called back to parse the buffer into numbers using strtod, so the
+        // buffer has to be delimited to not access it after its length.
+        if (m_buffer.empty() || m_buffer.back() != '\n')
         {
-            std::getline(istream, line);
-            // Add back the newline character. Parsing will copy the line in a
-            // buffer up to the length of the line without the null termination.
-            // Our code will be called back to parse the buffer into a number.
-            // Code uses strtod. The buffer has to be delimited so that strtod
-            // does not access it after its length.
-            line.push_back('\n');
-            ++m_lineNumber;
-
-            Parse(line, !istream.good());
+            m_buffer.push_back('\n');
         }
 
+        // The blocks end at a line boundary so that a number is never split between two
+        // character data callbacks.
+        static constexpr size_t BLOCK_SIZE = 1024 * 1024;
+
+        const char * first = m_buffer.c_str();
+        const char * last  = first + m_buffer.size();
+
+        m_parsing = true;
+        while (first != last)
+        {
+            const char * blockEnd = last;
+            if (size_t(last - first) > BLOCK_SIZE)
+            {
+                blockEnd = std::find(first + BLOCK_SIZE - 1, last, '\n') + 1;
+            }
+
+            Parse(first, size_t(blockEnd - first), blockEnd == last);
+            first = blockEnd;
+        }
+        m_parsing = false;
+
+        m_lineNumber = endLineNumber;
+
         if (!m_elms.empty())
         {
             std::string error("CTF/CLF parsing error (no closing tag for '");
@@ -222,13 +255,13 @@ public:
         }
     }
 
-    void Parse(const std::string & buffer, bool lastLine)
+    void Parse(const char * buffer, size_t size, bool lastBlock)
     {
-        const int done = lastLine?1:0;
+        const int done = lastBlock?1:0;
 
         if (XML_STATUS_ERROR == XML_Parse(m_parser,
-                                          buffer.c_str(),
-                                          (int)buffer.size(), done))
+                                          buffer,
+                                          (int)size, done))
         {
             XML_Error eXpatErrorCode = XML_GetErrorCode(m_parser);
             if (eXpatErrorCode == XML_ERROR_TAG_MISMATCH)
@@ -312,7 +345,7 @@ private:
         os << "Error parsing CTF/CLF file (";
         os << m_fileName.c_str() << "). ";
         os << "Error is: " << error.c_str();
-        os << ". At line (" << m_lineNumber << ")";
+        os << ". At line (" << getXmLineNumber() << ")";
         throw Exception(os.str().c_str());
     }
 
@@ -420,7 +453,7 @@ private:
                     std::make_shared<CTFReaderMetadataElt>(
                         name,
                         pMD,
-                        pImpl->m_lineNumber,
+                        pImpl->getXmLineNumber(),
                         pImpl->m_fileName));
 
                 pImpl->m_elms.back()->start(atts);
@@ -990,7 +1023,36 @@ private:
 
     unsigned int getXmLineNumber() const
     {
-        return m_lineNumber;
+        if (!m_parsing)
+        {
+            return m_lineNumber;
+        }
+
+        // Report the line of the last character of the current event (or of the error) i.e.
+        // the line being parsed when the file was parsed line by line.
+        const XML_Index index = XML_GetCurrentByteIndex(m_parser);
+        if (index < 0)
+        {
+            return m_lineNumber;
+        }
+
+        const int count = XML_GetCurrentByteCount(m_parser);
+        const size_t offset
+            = std::min(m_buffer.size(), size_t(index) + size_t(count > 0 ? count - 1 : 0));
+
+        // The events are in the file order so only count the new lines since the last call.
+        if (offset < m_countedOffset)
+        {
+            m_countedOffset = 0;
+            m_countedLines  = 0;
+        }
+
+        m_countedLines += (unsigned int)std::count(m_buffer.c_str() + m_countedOffset,
+                                                   m_buffer.c_str() + offset,
+                                                   '\n');
+        m_countedOffset = offset;
+
+        return m_countedLines + 1;
     }
 
     const std::string & getXmlFilename() const
@@ -1004,7 +1066,12 @@ private:
     }
 
     XML_Parser m_parser;
-    unsigned int m_lineNumber;
+    std::string m_buffer;
+    bool m_parsing = false;
+    unsigned int m_lineNumber = 0;
+    // Incremental count of the new lines before m_countedOffset in the buffer.
+    mutable size_t m_countedOffset = 0;
+    mutable unsigned int m_countedLines = 0;
     std::string m_fileName;
     bool m_isCLF;
     XmlReaderElementStack m_elms; // Parsing stack
@@ -1321,10 +1388,8 @@ void LocalFileFormat::bake(const Baker & baker,
             }
         }
         const auto shaperSize = shaperLut->getArray().getLength();
-        PackedImageDesc shaperImg(shaperLut->getArray().getValues().data(),
-                                  shaperSize, 1, 3);
-        ConstCPUProcessorRcPtr cpu = inputToShaperProc->getDefaultCPUProcessor();
-        cpu->apply(shaperImg);
+        ApplyBakerProcessors(baker, { inputToShaperProc->getDefaultCPUProcessor() },
+                             shaperLut->getArray().getValues().data(), shaperSize);
     }
 
     //
@@ -1334,10 +1399,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     if (required_lut == CTF_3D || required_lut == CTF_1D_3D)
     {
-        cubeData.resize(cubeSize*cubeSize*cubeSize * 3);
-        GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_BLUE);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
         ConstProcessorRcPtr cubeProc;
         if (required_lut == CTF_1D_3D)
         {
@@ -1362,8 +1423,8 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTargetProc;
         }
 
-        ConstCPUProcessorRcPtr cpu = cubeProc->getDefaultCPUProcessor();
-        cpu->apply(cubeImg);
+        cubeData = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_BLUE,
+                             { cubeProc->getDefaultCPUProcessor() });
     }
 
     //
@@ -1373,12 +1434,7 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> onedData;
     if (required_lut == CTF_1D)
     {
-        onedData.resize(onedSize * 3);
-        GenerateIdentityLut1D(&onedData[0], onedSize, 3);
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-
-        ConstCPUProcessorRcPtr cpu = inputToTargetProc->getDefaultCPUProcessor();
-        cpu->apply(onedImg);
+        onedData = BakeLut1D(baker, onedSize, { inputToTargetProc->getDefaultCPUProcessor() });
     }
 
     //
@@ -1420,10 +1476,15 @@ void LocalFileFormat::write(const OpRcPtrVec & ops,
                             std::ostream & ostream) const
 {
     bool isCLF = false;
+    bool base64Arrays = false;
     if (Platform::Strcasecmp(formatName.c_str(), FILEFORMAT_CLF) == 0)
     {
         isCLF = true;
     }
+    else if (Platform::Strcasecmp(formatName.c_str(), FILEFORMAT_CTF_BASE64) == 0)
+    {
+        base64Arrays = true;
+    }
     else if (Platform::Strcasecmp(formatName.c_str(), FILEFORMAT_CTF) != 0)
     {
         // Neither a clf nor a ctf.
@@ -1438,7 +1499,7 @@ void LocalFileFormat::write(const OpRcPtrVec & ops,
     ostream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
     XmlFormatter fmt(ostream);
 
-    TransformWriter writer(fmt, transform, isCLF);
+    TransformWriter writer(fmt, transform, isCLF, base64Arrays);
     writer.write();
 }
 
@@ -29,6 +29,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -181,11 +182,18 @@ readLuts(std::istream& istream,
         }
         else if(inlut)
         {
-            // StringToFloat was far slower, for 787456 values:
-            // - StringToFloat took 3879 (avg nanoseconds per value)
-            // - stdtod took 169 nanoseconds
-            char* endptr = 0;
-            float v = static_cast<float>(strtod(word.c_str(), &endptr));
+            // Each word should contain a single float value. Fall back to strtod() for the
+            // unusual syntaxes (e.g. hexadecimal floats).
+            const char * last = word.c_str() + word.size();
+            float v = 0.0f;
+            const char * endptr = ParseNumber(word.c_str(), last, v);
+
+            if(endptr != last)
+            {
+                char * strtodEnd = nullptr;
+                v = static_cast<float>(strtod(word.c_str(), &strtodEnd));
+                endptr = strtodEnd;
+            }
 
             if(!*endptr)
             {
@@ -735,10 +743,8 @@ void LocalFileFormat::bake(const Baker & baker,
             prelutData[3*i+2] = cur_value;
         }
 
-        PackedImageDesc prelutImg(&prelutData[0], shaperSize, 1, 3);
-
-        ConstCPUProcessorRcPtr cpu = inputToShaperProc->getDefaultCPUProcessor();
-        cpu->apply(prelutImg);
+        ApplyBakerProcessors(baker, { inputToShaperProc->getDefaultCPUProcessor() },
+                             prelutData.data(), shaperSize);
     }
 
     // TODO: Do same "auto prelut" input-space allocation as FileFormatCSP?
@@ -747,11 +753,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     if(required_lut == HDL_3D || required_lut == HDL_3D1D)
     {
-        cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-
-        GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
         ConstProcessorRcPtr cubeProc;
         if(required_lut == HDL_3D1D)
         {
@@ -777,8 +778,8 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTargetProc;
         }
 
-        ConstCPUProcessorRcPtr cpu = cubeProc->getDefaultCPUProcessor();
-        cpu->apply(cubeImg);
+        cubeData = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED,
+                             { cubeProc->getDefaultCPUProcessor() });
     }
 
 
@@ -786,12 +787,7 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> onedData;
     if(required_lut == HDL_1D)
     {
-        onedData.resize(onedSize * 3);
-
-        GenerateIdentityLut1D(&onedData[0], onedSize, 3);
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-        ConstCPUProcessorRcPtr cpu = inputToTargetProc->getDefaultCPUProcessor();
-        cpu->apply(onedImg);
+        onedData = BakeLut1D(baker, onedSize, { inputToTargetProc->getDefaultCPUProcessor() });
     }
 
 
@@ -849,15 +845,9 @@ void LocalFileFormat::bake(const Baker & baker,
     // Write the cube data after the "{"
     if(required_lut == HDL_3D || required_lut == HDL_3D1D)
     {
-        for(int i=0; i < cubeSize*cubeSize*cubeSize; ++i)
-        {
-            // TODO: Original baker code clamped values to
-            // 1.0, was this necessary/desirable?
-
-            ostream << "\t" << cubeData[3*i+0];
-            ostream << " "  << cubeData[3*i+1];
-            ostream << " "  << cubeData[3*i+2] << "\n";
-        }
+        // TODO: Original baker code clamped values to
+        // 1.0, was this necessary/desirable?
+        WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3, "\t");
 
         // Write closing "}"
         ostream << " }\n";
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/matrix/MatrixOp.h"
@@ -106,6 +107,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
 							  
 private:
     static void ThrowErrorMessage(const std::string & error,
@@ -171,21 +177,48 @@ LocalFileFormat::read(
         std::vector<float> tmpfloats;
         int lineNumber = 0;
 
-        while(nextline(istream, line))
+        // The lines following the first color triple of a 3D LUT are parsed at once, and
+        // then line by line from this stream if they are not only color triples.
+        std::istream * stream = &istream;
+        std::istringstream bodyStream;
+
+        while(nextline(*stream, line))
         {
             ++lineNumber;
             // All lines starting with '#' are comments
             if(pystring::startswith(line,"#")) continue;
 
+            // Most of the lines are color triples so parse them first without any string
+            // manipulation.
+            float rgb[3];
+            if(ParseNumbers(line.c_str(), line.c_str() + line.size(), rgb, 3) == 3)
+            {
+                raw.insert(raw.end(), rgb, rgb + 3);
+
+                // The rest of the file is usually only made of color triples so parse it at
+                // once (concurrently for the large LUTs).
+                if(in3d && !in1d && raw.size() == 3 && stream == &istream)
+                {
+                    const std::string body = ReadRemainingText(istream);
+                    if(!ParseNumberLines(body.c_str(), body.c_str() + body.size(), 3, true, raw))
+                    {
+                        raw.resize(3);
+                        bodyStream.str(body);
+                        stream = &bodyStream;
+                    }
+                }
+                continue;
+            }
+
             // Strip, lowercase, and split the line
             pystring::split(pystring::lower(pystring::strip(line)), parts);
             if(parts.empty()) continue;
 
-            if(pystring::lower(parts[0]) == "title")
+            if(parts[0] == "title")
             {
                 // Optional, and currently unhandled
             }
-            else if(pystring::lower(parts[0]) == "lut_1d_size")
+            else if(parts[0] == "lut_1d_size")
             {
                 if(parts.size() != 2
                     || !StringToInt( &size1d, parts[1].c_str()))
@@ -200,7 +233,7 @@ LocalFileFormat::read(
                 raw.reserve(3*size1d);
                 in1d = true;
             }
-            else if(pystring::lower(parts[0]) == "lut_2d_size")
+            else if(parts[0] == "lut_2d_size")
             {
                 ThrowErrorMessage(
                     "Unsupported tag: 'LUT_2D_SIZE'.",
@@ -208,7 +241,7 @@ LocalFileFormat::read(
                     lineNumber,
                     line);
             }
-            else if(pystring::lower(parts[0]) == "lut_3d_size")
+            else if(parts[0] == "lut_3d_size")
             {
                 int size = 0;
 
@@ -226,7 +259,7 @@ LocalFileFormat::read(
                 raw.reserve(3*size3d*size3d*size3d);
                 in3d = true;
             }
-            else if(pystring::lower(parts[0]) == "domain_min")
+            else if(parts[0] == "domain_min")
             {
                 if(parts.size() != 4 ||
                     !StringToFloat( &domain_min[0], parts[1].c_str()) ||
@@ -240,7 +273,7 @@ LocalFileFormat::read(
                         line);
                 }
             }
-            else if(pystring::lower(parts[0]) == "domain_max")
+            else if(parts[0] == "domain_max")
             {
                 if(parts.size() != 4 ||
                     !StringToFloat( &domain_max[0], parts[1].c_str()) ||
@@ -364,11 +397,6 @@ void LocalFileFormat::bake(const Baker & baker,
     if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
     cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
 
-    std::vector<float> cubeData;
-    cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-    GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
     // Apply our conversion from the input space to the output space.
     ConstProcessorRcPtr inputToTarget;
     std::string looks = baker.getLooks();
@@ -384,8 +412,9 @@ void LocalFileFormat::bake(const Baker & baker,
     {
         inputToTarget = config->getProcessor(baker.getInputSpace(), baker.getTargetSpace());
     }
-    ConstCPUProcessorRcPtr cpu = inputToTarget->getDefaultCPUProcessor();
-    cpu->apply(cubeImg);
+    const std::vector<float> cubeData
+        = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED,
+                    { inputToTarget->getDefaultCPUProcessor() });
 
     const auto & metadata = baker.getFormatMetadata();
     const auto nb = metadata.getNumChildrenElements();
@@ -408,12 +437,36 @@ void LocalFileFormat::bake(const Baker & baker,
     // Set to a fixed 6 decimal precision
     ostream.setf(std::ios::fixed, std::ios::floatfield);
     ostream.precision(6);
-    for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
+    WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3);
+}
+
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
     {
-        ostream << cubeData[3*i+0] << " "
-                << cubeData[3*i+1] << " "
-                << cubeData[3*i+2] << "\n";
+        return false;
     }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.writeLut3D(cachedFile->lut3D);
+    writer.writeFloats(cachedFile->domain_min, 3);
+    writer.writeFloats(cachedFile->domain_max, 3);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->lut3D = reader.readLut3D();
+    reader.readFloats(cachedFile->domain_min, 3);
+    reader.readFloats(cachedFile->domain_max, 3);
+
+    return cachedFile;
 }
 
 void
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ParseUtils.h"
@@ -81,6 +82,11 @@ public:
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
 
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
+
 private:
     static void ThrowErrorMessage(const std::string & error,
         const std::string & fileName,
@@ -145,11 +151,20 @@ LocalFileFormat::read(
             // All lines starting with '#' are comments
             if(pystring::startswith(line,"#")) continue;
 
+            // Most of the lines are color triples so parse them first without any string
+            // manipulation.
+            float rgb[3];
+            if(in3d && ParseNumbers(line.c_str(), line.c_str() + line.size(), rgb, 3) == 3)
+            {
+                raw.insert(raw.end(), rgb, rgb + 3);
+                continue;
+            }
+
             // Strip, lowercase, and split the line
             pystring::split(pystring::lower(pystring::strip(line)), parts);
             if(parts.empty()) continue;
 
-            if(pystring::lower(parts[0]) == "lut_3d_size")
+            if(parts[0] == "lut_3d_size")
             {
                 int size = 0;
 
@@ -242,11 +257,6 @@ void LocalFileFormat::bake(const Baker & baker,
     if(cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
     cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
 
-    std::vector<float> cubeData;
-    cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-    GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
     // Apply our conversion from the input space to the output space.
     ConstProcessorRcPtr inputToTarget;
     std::string looks = baker.getLooks();
@@ -264,8 +274,9 @@ void LocalFileFormat::bake(const Baker & baker,
         inputToTarget = config->getProcessor(baker.getInputSpace(),
             baker.getTargetSpace());
     }
-    ConstCPUProcessorRcPtr cpu = inputToTarget->getDefaultCPUProcessor();
-    cpu->apply(cubeImg);
+    const std::vector<float> cubeData
+        = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED,
+                    { inputToTarget->getDefaultCPUProcessor() });
 
     // Write out the file.
     // For for maximum compatibility with other apps, we will
@@ -280,16 +291,33 @@ void LocalFileFormat::bake(const Baker & baker,
     // Set to a fixed 6 decimal precision
     ostream.setf(std::ios::fixed, std::ios::floatfield);
     ostream.precision(6);
-    for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
+    WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3);
+    ostream << "\n";
+}
+
+
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
     {
-        float r = cubeData[3*i+0];
-        float g = cubeData[3*i+1];
-        float b = cubeData[3*i+2];
-        ostream << r << " " << g << " " << b << "\n";
+        return false;
     }
-    ostream << "\n";
+
+    writer.writeLut3D(cachedFile->lut3D);
+
+    return true;
 }
 
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut3D = reader.readLut3D();
+
+    return cachedFile;
+}
 
 void
 LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ops/matrix/MatrixOp.h"
@@ -215,6 +216,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
 private:
     static void ThrowErrorMessage(const std::string & error,
         const std::string & fileName,
@@ -285,7 +291,33 @@ CachedFileRcPtr LocalFileFormat::read(
         bool headerComplete = false;
         int tripletNumber = 0;
 
-        while(nextline(istream, line))
+        // The first triples are the 1D LUT entries (if any) and the next ones are the 3D LUT
+        // entries.
+        auto addTriple = [&](const float * rgb)
+        {
+            headerComplete = true;
+
+            for(int i=0; i<3; ++i)
+            {
+                if(has1d && tripletNumber < size1d)
+                {
+                    raw1d.push_back(rgb[i]);
+                }
+                else
+                {
+                    raw3d.push_back(rgb[i]);
+                }
+            }
+
+            ++tripletNumber;
+        };
+
+        // The lines following the first color triple of the 3D LUT are parsed at once, and
+        // then line by line from this stream if they are not only color triples.
+        std::istream * stream = &istream;
+        std::istringstream bodyStream;
+
+        while(nextline(*stream, line))
         {
             ++lineNumber;
 
@@ -306,11 +338,33 @@ CachedFileRcPtr LocalFileFormat::read(
                 }
             }
 
+            // Most of the lines are color triples so parse them first without any string
+            // manipulation.
+            float rgb[3];
+            if(ParseNumbers(line.c_str(), line.c_str() + line.size(), rgb, 3) == 3)
+            {
+                addTriple(rgb);
+
+                // The rest of the file is usually only made of color triples so parse it at
+                // once (concurrently for the large LUTs).
+                if(has3d && raw3d.size() == 3 && stream == &istream)
+                {
+                    const std::string body = ReadRemainingText(istream);
+                    if(!ParseNumberLines(body.c_str(), body.c_str() + body.size(), 3, false, raw3d))
+                    {
+                        raw3d.resize(3);
+                        bodyStream.str(body);
+                        stream = &bodyStream;
+                    }
+                }
+                continue;
+            }
+
             // Strip, lowercase, and split the line
             pystring::split(pystring::lower(pystring::strip(line)), parts);
             if(parts.empty()) continue;
 
-            if(pystring::lower(parts[0]) == "title")
+            if(parts[0] == "title")
             {
                 ThrowErrorMessage(
                     "Unsupported tag: 'TITLE'.",
@@ -318,7 +372,7 @@ CachedFileRcPtr LocalFileFormat::read(
                     lineNumber,
                     line);
             }
-            else if(pystring::lower(parts[0]) == "lut_1d_size")
+            else if(parts[0] == "lut_1d_size")
             {
                 if(parts.size() != 2
                     || !StringToInt( &size1d, parts[1].c_str()))
@@ -333,7 +387,7 @@ CachedFileRcPtr LocalFileFormat::read(
                 raw1d.reserve(3*size1d);
                 has1d = true;
             }
-            else if(pystring::lower(parts[0]) == "lut_2d_size")
+            else if(parts[0] == "lut_2d_size")
             {
                 ThrowErrorMessage(
                     "Unsupported tag: 'LUT_2D_SIZE'.",
@@ -341,7 +395,7 @@ CachedFileRcPtr LocalFileFormat::read(
                     lineNumber,
                     line);
             }
-            else if(pystring::lower(parts[0]) == "lut_3d_size")
+            else if(parts[0] == "lut_3d_size")
             {
                 if(parts.size() != 2
                     || !StringToInt( &size3d, parts[1].c_str()))
@@ -356,7 +410,7 @@ CachedFileRcPtr LocalFileFormat::read(
                 raw3d.reserve(3*size3d*size3d*size3d);
                 has3d = true;
             }
-            else if(pystring::lower(parts[0]) == "lut_1d_input_range")
+            else if(parts[0] == "lut_1d_input_range")
             {
                 if(parts.size() != 3 || 
                     !StringToFloat( &range1d_min, parts[1].c_str()) ||
@@ -369,7 +423,7 @@ CachedFileRcPtr LocalFileFormat::read(
                         line);
                 }
             }
-            else if(pystring::lower(parts[0]) == "lut_3d_input_range")
+            else if(parts[0] == "lut_3d_input_range")
             {
                 if(parts.size() != 3 || 
                     !StringToFloat( &range3d_min, parts[1].c_str()) ||
@@ -384,8 +438,6 @@ CachedFileRcPtr LocalFileFormat::read(
             }
             else
             {
-                headerComplete = true;
-
                 // It must be a float triple!
                 if(!StringVecToFloatVec(tmpfloats, parts) || tmpfloats.size() != 3)
                 {
@@ -396,19 +448,7 @@ CachedFileRcPtr LocalFileFormat::read(
                         line);
                 }
 
-                for(int i=0; i<3; ++i)
-                {
-                    if(has1d && tripletNumber < size1d)
-                    {
-                        raw1d.push_back(tmpfloats[i]);
-                    }
-                    else
-                    {
-                        raw3d.push_back(tmpfloats[i]);
-                    }
-                }
-
-                ++tripletNumber;
+                addTriple(tmpfloats.data());
             }
         }
     }
@@ -650,9 +690,8 @@ void LocalFileFormat::bake(const Baker & baker,
             shaperData[3*i+2] = cur_value;
         }
 
-        PackedImageDesc shaperImg(&shaperData[0], shaperSize, 1, 3);
-        ConstCPUProcessorRcPtr cpu = inputToShaperProc->getDefaultCPUProcessor();
-        cpu->apply(shaperImg);
+        ApplyBakerProcessors(baker, { inputToShaperProc->getDefaultCPUProcessor() },
+                             shaperData.data(), shaperSize);
     }
 
     //
@@ -662,10 +701,6 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> cubeData;
     if(required_lut == CUBE_3D || required_lut == CUBE_1D_3D)
     {
-        cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-        GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-        PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
         ConstProcessorRcPtr cubeProc;
         if(required_lut == CUBE_1D_3D)
         {
@@ -691,8 +726,8 @@ void LocalFileFormat::bake(const Baker & baker,
             cubeProc = inputToTargetProc;
         }
 
-        ConstCPUProcessorRcPtr cpu = cubeProc->getDefaultCPUProcessor();
-        cpu->apply(cubeImg);
+        cubeData = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED,
+                             { cubeProc->getDefaultCPUProcessor() });
     }
 
     //
@@ -702,12 +737,7 @@ void LocalFileFormat::bake(const Baker & baker,
     std::vector<float> onedData;
     if(required_lut == CUBE_1D)
     {
-        onedData.resize(onedSize * 3);
-        GenerateIdentityLut1D(&onedData[0], onedSize, 3);
-        PackedImageDesc onedImg(&onedData[0], onedSize, 1, 3);
-
-        ConstCPUProcessorRcPtr cpu = inputToTargetProc->getDefaultCPUProcessor();
-        cpu->apply(onedImg);
+        onedData = BakeLut1D(baker, onedSize, { inputToTargetProc->getDefaultCPUProcessor() });
     }
 
     //
@@ -755,33 +785,51 @@ void LocalFileFormat::bake(const Baker & baker,
     // Write 1D data
     if(required_lut == CUBE_1D)
     {
-        for(int i=0; i<onedSize; ++i)
-        {
-            ostream << onedData[3*i+0] << " "
-                    << onedData[3*i+1] << " "
-                    << onedData[3*i+2] << "\n";
-        }
+        WriteNumberLines(ostream, onedData.data(), onedSize, 3);
     }
     else if(required_lut == CUBE_1D_3D)
     {
-        for(int i=0; i<shaperSize; ++i)
-        {
-            ostream << shaperData[3*i+0] << " "
-                    << shaperData[3*i+1] << " "
-                    << shaperData[3*i+2] << "\n";
-        }
+        WriteNumberLines(ostream, shaperData.data(), shaperSize, 3);
     }
 
     // Write 3D data
     if(required_lut == CUBE_3D || required_lut == CUBE_1D_3D)
     {
-        for(int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-        {
-            ostream << cubeData[3*i+0] << " "
-                    << cubeData[3*i+1] << " "
-                    << cubeData[3*i+2] << "\n";
-        }
+        WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3);
+    }
+}
+
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
+    {
+        return false;
     }
+
+    writer.writeLut1D(cachedFile->lut1D);
+    writer.write<float>(cachedFile->range1d_min);
+    writer.write<float>(cachedFile->range1d_max);
+    writer.writeLut3D(cachedFile->lut3D);
+    writer.write<float>(cachedFile->range3d_min);
+    writer.write<float>(cachedFile->range3d_max);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut1D = reader.readLut1D();
+    cachedFile->range1d_min = reader.read<float>();
+    cachedFile->range1d_max = reader.read<float>();
+    cachedFile->lut3D = reader.readLut3D();
+    cachedFile->range3d_min = reader.read<float>();
+    cachedFile->range3d_max = reader.read<float>();
+
+    return cachedFile;
 }
 
 void
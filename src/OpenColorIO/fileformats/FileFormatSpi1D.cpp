@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -64,6 +66,11 @@ public:
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
 
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
+
 private:
     static void ThrowErrorMessage(const std::string & error,
                                     const std::string & fileName,
@@ -183,31 +190,48 @@ CachedFileRcPtr LocalFileFormat::read(
         int lineCount=0;
 
         std::vector<std::string> inputLUT;
-        std::vector<float> values;
+        std::vector<float> tmpValues;
 
         while (istream.good())
         {
-            const std::string line = pystring::strip(std::string(lineBuffer));
-            if (Platform::Strcasecmp(line.c_str(), "}") == 0)
-            {
-                break;
-            }
+            // Most of the lines only contain the values so parse them first without any
+            // string manipulation.
+            float values[3];
+            size_t numValues
+                = ParseNumbers(lineBuffer, lineBuffer + strlen(lineBuffer), values, 3);
 
-            if (line.length() != 0)
+            if (numValues == 0)
             {
-                pystring::split(pystring::strip(lineBuffer), inputLUT);
-                values.clear();
-                if (!StringVecToFloatVec(values, inputLUT)
-                    || components != (int)values.size())
+                const std::string line = pystring::strip(std::string(lineBuffer));
+                if (Platform::Strcasecmp(line.c_str(), "}") == 0)
                 {
-                    std::ostringstream os;
-                    os << "Malformed LUT line. Expecting a ";
-                    os << components << " components entry.";
+                    break;
+                }
 
-                    ThrowErrorMessage("Malformed LUT line.",
-                                        fileName, currentLine, line);
+                if (line.length() != 0)
+                {
+                    pystring::split(line, inputLUT);
+                    tmpValues.clear();
+                    if (!StringVecToFloatVec(tmpValues, inputLUT)
+                        || components != (int)tmpValues.size())
+                    {
+                        ThrowErrorMessage("Malformed LUT line.",
+                                            fileName, currentLine, line);
+                    }
+
+                    numValues = tmpValues.size();
+                    std::copy(tmpValues.begin(), tmpValues.end(), values);
                 }
+            }
+            else if (components != (int)numValues)
+            {
+                ThrowErrorMessage("Malformed LUT line.",
+                                    fileName, currentLine,
+                                    pystring::strip(std::string(lineBuffer)));
+            }
 
+            if (numValues != 0)
+            {
                 // If 1 component is specified, use x1 x1 x1.
                 if (components == 1)
                 {
@@ -256,6 +280,33 @@ CachedFileRcPtr LocalFileFormat::read(
     return cachedFile;
 }
 
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
+    {
+        return false;
+    }
+
+    writer.writeLut1D(cachedFile->lut);
+    writer.write<float>(cachedFile->from_min);
+    writer.write<float>(cachedFile->from_max);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut = reader.readLut1D();
+    cachedFile->from_min = reader.read<float>();
+    cachedFile->from_max = reader.read<float>();
+
+    return cachedFile;
+}
+
 void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                     const Config & /*config*/,
                                     const ConstContextRcPtr & /*context*/,
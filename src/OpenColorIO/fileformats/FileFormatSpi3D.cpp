@@ -1,12 +1,15 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ops/lut3d/Lut3DOp.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "pystring/pystring.h"
 #include "transforms/FileTransform.h"
@@ -58,6 +61,11 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    bool serializeCachedFile(LutCacheWriter & writer,
+                             const CachedFileRcPtr & untypedCachedFile) const override;
+
+    CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const override;
 };
 
 void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
@@ -129,50 +137,109 @@ CachedFileRcPtr LocalFileFormat::read(
     int entriesRemaining = rSize * gSize * bSize;
     Array & lutArray = lut3d->getArray();
     unsigned long numVal = lutArray.getNumValues();
-    while (istream.good() && entriesRemaining > 0)
-    {
-        istream.getline(lineBuffer, MAX_LINE_SIZE);
 
-        if (sscanf(lineBuffer, "%d %d %d %f %f %f",
-            &rIndex, &gIndex, &bIndex,
-            &redValue, &greenValue, &blueValue) == 6)
+    auto setEntry = [&]()
+    {
+        bool invalidIndex = false;
+        if (rIndex < 0 || rIndex >= rSize
+            || gIndex < 0 || gIndex >= gSize
+            || bIndex < 0 || bIndex >= bSize)
+        {
+            invalidIndex = true;
+        }
+        else
         {
-            bool invalidIndex = false;
-            if (rIndex < 0 || rIndex >= rSize
-                || gIndex < 0 || gIndex >= gSize
-                || bIndex < 0 || bIndex >= bSize)
+            index = GetLut3DIndex_BlueFast(rIndex, gIndex, bIndex,
+                                            rSize, gSize, bSize);
+            if (index < 0 || index >= (int)numVal)
             {
                 invalidIndex = true;
             }
-            else
-            {
-                index = GetLut3DIndex_BlueFast(rIndex, gIndex, bIndex,
-                                                rSize, gSize, bSize);
-                if (index < 0 || index >= (int)numVal)
-                {
-                    invalidIndex = true;
-                }
 
-            }
+        }
 
-            if (invalidIndex)
+        if (invalidIndex)
+        {
+            std::ostringstream os;
+            os << "Error parsing .spi3d file (";
+            os << fileName;
+            os << "). ";
+            os << "Data is invalid. ";
+            os << "A LUT entry is specified (";
+            os << rIndex << " " << gIndex << " " << bIndex;
+            os << ") that falls outside of the cube.";
+            throw Exception(os.str().c_str());
+        }
+
+        lutArray[index+0] = redValue;
+        lutArray[index+1] = greenValue;
+        lutArray[index+2] = blueValue;
+
+        entriesRemaining--;
+    };
+
+    // The rest of the file is usually only made of the entries so parse it at once
+    // (concurrently for the large LUTs).
+    const std::string body = ReadRemainingText(istream);
+
+    const size_t numEntries = size_t(entriesRemaining);
+
+    // The indices must be integers.
+    auto validIndices = [](const std::vector<float> & values, size_t numEntries)
+    {
+        for (size_t idx = 0; idx < numEntries; ++idx)
+        {
+            for (size_t channel = 0; channel < 3; ++channel)
             {
-                std::ostringstream os;
-                os << "Error parsing .spi3d file (";
-                os << fileName;
-                os << "). ";
-                os << "Data is invalid. ";
-                os << "A LUT entry is specified (";
-                os << rIndex << " " << gIndex << " " << bIndex;
-                os << ") that falls outside of the cube.";
-                throw Exception(os.str().c_str());
+                const float val = values[6 * idx + channel];
+                if (val != std::floor(val) || std::abs(val) > 65536.0f)
+                {
+                    return false;
+                }
             }
+        }
+        return true;
+    };
 
-            lutArray[index+0] = redValue;
-            lutArray[index+1] = greenValue;
-            lutArray[index+2] = blueValue;
+    std::vector<float> entries;
+    if (ParseNumberLines(body.c_str(), body.c_str() + body.size(), 6, false, entries)
+        && entries.size() >= 6 * numEntries
+        && validIndices(entries, numEntries))
+    {
+        for (size_t idx = 0; idx < numEntries; ++idx)
+        {
+            const float * entry = &entries[6 * idx];
+            rIndex = int(entry[0]);
+            gIndex = int(entry[1]);
+            bIndex = int(entry[2]);
+            redValue   = entry[3];
+            greenValue = entry[4];
+            blueValue  = entry[5];
+            setEntry();
+        }
+    }
 
-            entriesRemaining--;
+    // Otherwise, parse the lines one by one.
+    std::istringstream bodyStream(entriesRemaining > 0 ? body : std::string());
+    while (bodyStream.good() && entriesRemaining > 0)
+    {
+        bodyStream.getline(lineBuffer, MAX_LINE_SIZE);
+
+        // Parse the line without sscanf() which is much slower (and locale dependent).
+        const char * last = lineBuffer + strlen(lineBuffer);
+        const char * str = ParseNumber(lineBuffer, last, rIndex);
+        str = str ? ParseNumber(str, last, gIndex) : nullptr;
+        str = str ? ParseNumber(str, last, bIndex) : nullptr;
+        str = str ? ParseNumber(str, last, redValue) : nullptr;
+        str = str ? ParseNumber(str, last, greenValue) : nullptr;
+        str = str ? ParseNumber(str, last, blueValue) : nullptr;
+
+        // Fall back to sscanf() for the unusual syntaxes (e.g. hexadecimal floats).
+        if (str || sscanf(lineBuffer, "%d %d %d %f %f %f",
+                          &rIndex, &gIndex, &bIndex,
+                          &redValue, &greenValue, &blueValue) == 6)
+        {
+            setEntry();
         }
     }
 
@@ -192,6 +259,29 @@ CachedFileRcPtr LocalFileFormat::read(
     return cachedFile;
 }
 
+bool LocalFileFormat::serializeCachedFile(LutCacheWriter & writer,
+                                          const CachedFileRcPtr & untypedCachedFile) const
+{
+    LocalCachedFileRcPtr cachedFile = DynamicPtrCast<LocalCachedFile>(untypedCachedFile);
+    if (!cachedFile)
+    {
+        return false;
+    }
+
+    writer.writeLut3D(cachedFile->lut);
+
+    return true;
+}
+
+CachedFileRcPtr LocalFileFormat::deserializeCachedFile(LutCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+
+    cachedFile->lut = reader.readLut3D();
+
+    return cachedFile;
+}
+
 void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                     const Config & /*config*/,
                                     const ConstContextRcPtr & /*context*/,
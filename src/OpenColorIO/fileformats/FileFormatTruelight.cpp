@@ -9,6 +9,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "BakingUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
 #include "ParseUtils.h"
@@ -115,6 +116,17 @@ LocalFileFormat::read(
 
         while(nextline(istream, line))
         {
+            // Most of the lines are color triples so parse them first without any string
+            // manipulation.
+            float rgb[3];
+            if((in1d || in3d)
+                && ParseNumbers(line.c_str(), line.c_str() + line.size(), rgb, 3) == 3)
+            {
+                std::vector<float> & raw = in1d ? raw1d : raw3d;
+                raw.insert(raw.end(), rgb, rgb + 3);
+                continue;
+            }
+
             // Strip, lowercase, and split the line
             pystring::split(pystring::lower(pystring::strip(line)), parts);
 
@@ -276,17 +288,13 @@ LocalFileFormat::bake(const Baker & baker,
     if (cubeSize==-1) cubeSize = DEFAULT_CUBE_SIZE;
     cubeSize = std::max(2, cubeSize); // smallest cube is 2x2x2
 
-    std::vector<float> cubeData;
-    cubeData.resize(cubeSize*cubeSize*cubeSize*3);
-    GenerateIdentityLut3D(&cubeData[0], cubeSize, 3, LUT3DORDER_FAST_RED);
-    PackedImageDesc cubeImg(&cubeData[0], cubeSize*cubeSize*cubeSize, 1, 3);
-
     // Apply processor to LUT data
     ConstCPUProcessorRcPtr inputToTarget;
     inputToTarget
         = config->getProcessor(baker.getInputSpace(), 
                                 baker.getTargetSpace())->getDefaultCPUProcessor();
-    inputToTarget->apply(cubeImg);
+    const std::vector<float> cubeData
+        = BakeLut3D(baker, cubeSize, LUT3DORDER_FAST_RED, { inputToTarget });
 
     int shaperSize = baker.getShaperSize();
     if (shaperSize==-1) shaperSize = DEFAULT_SHAPER_SIZE;
@@ -318,10 +326,7 @@ LocalFileFormat::bake(const Baker & baker,
 
     // Write the cube
     ostream << "# Cube\n";
-    for (int i=0; i<cubeSize*cubeSize*cubeSize; ++i)
-    {
-        ostream << cubeData[3*i+0] << " " << cubeData[3*i+1] << " " << cubeData[3*i+2] << "\n";
-    }
+    WriteNumberLines(ostream, cubeData.data(), cubeSize*cubeSize*cubeSize, 3);
 
     ostream << "# end\n";
 }
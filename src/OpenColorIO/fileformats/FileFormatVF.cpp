@@ -122,6 +122,15 @@ CachedFileRcPtr LocalFileFormat::read(
         {
             ++lineNumber;
 
+            // Most of the lines are color triples so parse them first without any string
+            // manipulation.
+            float rgb[3];
+            if(in3d && ParseNumbers(line.c_str(), line.c_str() + line.size(), rgb, 3) == 3)
+            {
+                raw3d.insert(raw3d.end(), rgb, rgb + 3);
+                continue;
+            }
+
             // Strip, lowercase, and split the line
             pystring::split(pystring::lower(pystring::strip(line)), parts);
 
@@ -975,6 +975,8 @@ void CDLParser::getCDLTransforms(CDLTransformMap & transformMap,
                                  FormatMetadataImpl & metadata) const
 {
     const CDLTransformVec& pTransformList = m_impl->getCDLParsingInfo()->m_transforms;
+    transformVec.reserve(transformVec.size() + pTransformList.size());
+    transformMap.reserve(transformMap.size() + pTransformList.size());
     for (size_t i = 0; i < pTransformList.size(); ++i)
     {
         const CDLTransformRcPtr& pTransform = pTransformList.at(i);
@@ -6,6 +6,7 @@
 #include "fileformats/ctf/CTFReaderUtils.h"
 #include "fileformats/xmlutils/XMLReaderUtils.h"
 #include "MathUtils.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "pystring/pystring.h"
 
@@ -296,6 +297,36 @@ void CTFReaderArrayElt::start(const char ** atts)
             }
         }
 
+        else if (0 == Platform::Strcasecmp(ATTR_ENCODING, atts[i]))
+        {
+            if (0 != Platform::Strcasecmp(ENCODING_BASE64, atts[i + 1]))
+            {
+                ThrowM(*this, "Unsupported '", getTypeName(), "' array encoding '",
+                       atts[i + 1], "'.");
+            }
+            m_isEncoded = true;
+        }
+        else if (0 == Platform::Strcasecmp(ATTR_ENCODED_BITDEPTH, atts[i]))
+        {
+            if (0 == Platform::Strcasecmp("16f", atts[i + 1]))
+            {
+                m_encodedBitDepth = BIT_DEPTH_F16;
+            }
+            else if (0 == Platform::Strcasecmp("32f", atts[i + 1]))
+            {
+                m_encodedBitDepth = BIT_DEPTH_F32;
+            }
+            else
+            {
+                ThrowM(*this, "Unsupported '", getTypeName(), "' array encoded bit-depth '",
+                       atts[i + 1], "'.");
+            }
+        }
+        else if (0 == Platform::Strcasecmp(ATTR_CHECKSUM, atts[i]))
+        {
+            m_checksum = atts[i + 1];
+        }
+
         i += 2;
     }
 
@@ -305,6 +336,21 @@ void CTFReaderArrayElt::start(const char ** atts)
         throwMessage("Missing 'dim' attribute.");
     }
 
+    if (m_isEncoded)
+    {
+        const CTFReaderOpElt * pOp = dynamic_cast<const CTFReaderOpElt*>(getParent().get());
+        if (pOp && pOp->getVersion() < CTF_PROCESS_LIST_VERSION_2_1)
+        {
+            ThrowM(*this, "Encoded '", getTypeName(),
+                   "' arrays require the transform file version 2.1 or higher.");
+        }
+
+        if (m_checksum.empty())
+        {
+            throwMessage("Missing 'checksum' attribute.");
+        }
+    }
+
     m_position = 0;
 }
 
@@ -314,14 +360,72 @@ void CTFReaderArrayElt::end()
     // no need to validate it.
     if (getParent()->isDummy()) return;
 
+    if (m_isEncoded)
+    {
+        decodeValues();
+    }
+
     CTFArrayMgt* pArr = dynamic_cast<CTFArrayMgt*>(getParent().get());
     pArr->endArray(m_position);
 }
 
+void CTFReaderArrayElt::decodeValues()
+{
+    std::string bytes;
+    if (!DecodeBase64(m_encodedValues.c_str(),
+                      m_encodedValues.c_str() + m_encodedValues.size(),
+                      bytes))
+    {
+        ThrowM(*this, "Illegal base64 values in '", getTypeName(), "'.");
+    }
+
+    if (GetEncodedArrayChecksum(bytes) != m_checksum)
+    {
+        ThrowM(*this, "The '", getTypeName(), "' array values do not match the checksum '",
+               m_checksum, "'.");
+    }
+
+    // The number of values is then validated by the parent like for the text values.
+    const size_t valueSize = GetEncodedArrayValueSize(m_encodedBitDepth);
+    const size_t numValues = bytes.size() / valueSize;
+    if (bytes.size() % valueSize != 0 || numValues > m_array->getNumValues())
+    {
+        ThrowM(*this, "Illegal number of encoded values in '", getTypeName(), "'.");
+    }
+
+    // The LUT arrays hold float values so the bytes are decoded in place (i.e. a plain copy
+    // for the little-endian 32f values).
+    Array * floatArray = dynamic_cast<Array *>(m_array);
+    if (floatArray)
+    {
+        GetEncodedArrayValues(bytes, m_encodedBitDepth, floatArray->getValues().data(), numValues);
+        m_position = (unsigned int)numValues;
+    }
+    else
+    {
+        std::vector<float> values(numValues);
+        GetEncodedArrayValues(bytes, m_encodedBitDepth, values.data(), numValues);
+
+        for (m_position = 0; m_position < (unsigned int)numValues; ++m_position)
+        {
+            m_array->setDoubleValue(m_position, values[m_position]);
+        }
+    }
+
+    // Release the text as soon as possible.
+    std::string().swap(m_encodedValues);
+}
+
 void CTFReaderArrayElt::setRawData(const char * s,
                                    size_t len,
                                    unsigned int/*xmlLine*/)
 {
+    if (m_isEncoded)
+    {
+        m_encodedValues.append(s, len);
+        return;
+    }
+
     const unsigned long maxValues = m_array->getNumValues();
     size_t pos(0);
 
@@ -331,19 +435,32 @@ void CTFReaderArrayElt::setRawData(const char * s,
     // is the most used when reading in large transforms.
     //
 
+    const char * last = s + len;
+
     pos = FindNextTokenStart(s, len, 0);
     while (pos != len)
     {
         double data(0.);
 
-        try
+        // Most of the values are plain decimal numbers which are parsed without the
+        // overhead of strtod. Other values (e.g. nan, inf or hexadecimal numbers) and
+        // the errors are handled by GetNextNumber.
+        const char * end = ParseNumber(s + pos, last, data);
+        if (end && end != s + pos && (end == last || IsNumberDelimiter(*end)))
         {
-            GetNextNumber(s, len, pos, data);
+            pos = FindNextTokenStart(s, len, size_t(end - s));
         }
-        catch (Exception& /*ce*/)
+        else
         {
-            ThrowM(*this, "Illegal values '", TruncateString(s, len),
-                   "' in ", getTypeName());
+            try
+            {
+                GetNextNumber(s, len, pos, data);
+            }
+            catch (Exception& /*ce*/)
+            {
+                ThrowM(*this, "Illegal values '", TruncateString(s, len),
+                       "' in ", getTypeName());
+            }
         }
 
         if (m_position<maxValues)
@@ -890,6 +1007,11 @@ const char * CTFReaderOpElt::getTypeName() const
     return typeid(r).name();
 }
 
+const CTFVersion & CTFReaderOpElt::getVersion() const
+{
+    return m_transform->getCTFVersion();
+}
+
 //------------------------------------------------------------------------------
 //
 // These macros are used to define which Op implementation to use
@@ -212,12 +212,21 @@ public:
 private:
     CTFReaderArrayElt() = delete;
 
+    void decodeValues();
+
     // The array to fill (pointer not owned).
     // Array is managed as a member object of an OpData.
     ArrayBase * m_array;
 
     // The current position to fill.
     unsigned int m_position;
+
+    // The base64 encoded values (refer to CTF_PROCESS_LIST_VERSION_2_1) are decoded once
+    // the whole text is read.
+    bool m_isEncoded = false;
+    BitDepth m_encodedBitDepth = BIT_DEPTH_F32;
+    std::string m_checksum;
+    std::string m_encodedValues;
 };
 
 class CTFArrayMgt
@@ -274,6 +283,13 @@ private:
 
     // The current position to fill.
     unsigned int m_position;
+
+    // The base64 encoded values (refer to CTF_PROCESS_LIST_VERSION_2_1) are decoded once
+    // the whole text is read.
+    bool m_isEncoded = false;
+    BitDepth m_encodedBitDepth = BIT_DEPTH_F32;
+    std::string m_checksum;
+    std::string m_encodedValues;
 };
 
 // Class to track creation of IndexMaps.
@@ -363,6 +379,8 @@ public:
 
     const char * getTypeName() const override;
 
+    const CTFVersion & getVersion() const;
+
     // Get the right reader using its type and
     // the xml transform version.
     static CTFReaderOpEltRcPtr GetReader(Type type,
@@ -5,6 +5,8 @@
 #include <sstream>
 
 #include "fileformats/ctf/CTFReaderUtils.h"
+#include "md5/md5.h"
+#include "OpenEXR/half.h"
 #include "Platform.h"
 
 namespace OCIO_NAMESPACE
@@ -111,4 +113,94 @@ const char * GetInterpolation3DName(Interpolation interp)
     return INTERPOLATION_DEFAULT;
 }
 
+namespace
+{
+inline bool IsLittleEndian()
+{
+    const uint16_t value = 1;
+    return *reinterpret_cast<const uint8_t *>(&value) == 1;
+}
+} // anon.
+
+size_t GetEncodedArrayValueSize(BitDepth encodedBitDepth)
+{
+    if (encodedBitDepth == BIT_DEPTH_F16)
+    {
+        return sizeof(uint16_t);
+    }
+    else if (encodedBitDepth == BIT_DEPTH_F32)
+    {
+        return sizeof(float);
+    }
+
+    throw Exception("Only 16f and 32f values can be encoded.");
+}
+
+void AppendEncodedArrayValue(std::string & bytes, float value, BitDepth encodedBitDepth)
+{
+    uint32_t bits = 0;
+    if (GetEncodedArrayValueSize(encodedBitDepth) == sizeof(uint16_t))
+    {
+        bits = half(value).bits();
+    }
+    else
+    {
+        memcpy(&bits, &value, sizeof(float));
+    }
+
+    for (size_t idx = 0; idx < GetEncodedArrayValueSize(encodedBitDepth); ++idx)
+    {
+        bytes += char((bits >> (8 * idx)) & 0xFF);
+    }
+}
+
+void GetEncodedArrayValues(const std::string & bytes, BitDepth encodedBitDepth,
+                           float * values, size_t numValues)
+{
+    const unsigned char * data = reinterpret_cast<const unsigned char *>(bytes.data());
+
+    if (GetEncodedArrayValueSize(encodedBitDepth) == sizeof(uint16_t))
+    {
+        for (size_t idx = 0; idx < numValues; ++idx, data += 2)
+        {
+            half h;
+            h.setBits(uint16_t(data[0] | (data[1] << 8)));
+            values[idx] = h;
+        }
+    }
+    else if (IsLittleEndian())
+    {
+        memcpy(values, data, numValues * sizeof(float));
+    }
+    else
+    {
+        for (size_t idx = 0; idx < numValues; ++idx, data += 4)
+        {
+            const uint32_t bits = uint32_t(data[0]) | (uint32_t(data[1]) << 8)
+                                  | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+            memcpy(&values[idx], &bits, sizeof(float));
+        }
+    }
+}
+
+std::string GetEncodedArrayChecksum(const std::string & bytes)
+{
+    md5_state_t state;
+    md5_byte_t digest[16];
+
+    md5_init(&state);
+    md5_append(&state, (const md5_byte_t *)bytes.data(), (int)bytes.size());
+    md5_finish(&state, digest);
+
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    std::string checksum;
+    for (int idx = 0; idx < 16; ++idx)
+    {
+        checksum += HEX_DIGITS[digest[idx] >> 4];
+        checksum += HEX_DIGITS[digest[idx] & 0x0F];
+    }
+    return checksum;
+}
+
 } // namespace OCIO_NAMESPACE
@@ -4,6 +4,8 @@
 #ifndef INCLUDED_OCIO_FILEFORMATS_CTF_CTFREADERUTILS_H
 #define INCLUDED_OCIO_FILEFORMATS_CTF_CTFREADERUTILS_H
 
+#include <string>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 namespace OCIO_NAMESPACE
@@ -14,6 +16,15 @@ const char * GetInterpolation1DName(Interpolation interp);
 Interpolation GetInterpolation3D(const char * str);
 const char * GetInterpolation3DName(Interpolation interp);
 
+// The base64 encoded arrays (refer to CTF_PROCESS_LIST_VERSION_2_1) store the values as
+// little-endian 16f or 32f values. The checksum is the MD5 of the stored bytes in hexadecimal.
+void AppendEncodedArrayValue(std::string & bytes, float value, BitDepth encodedBitDepth);
+// The bytes must contain numValues values.
+void GetEncodedArrayValues(const std::string & bytes, BitDepth encodedBitDepth,
+                           float * values, size_t numValues);
+size_t GetEncodedArrayValueSize(BitDepth encodedBitDepth);
+std::string GetEncodedArrayChecksum(const std::string & bytes);
+
 static constexpr const char * TAG_ACES = "ACES";
 static constexpr const char * TAG_ACES_PARAMS = "ACESParams";
 static constexpr const char * TAG_ARRAY = "Array";
@@ -51,9 +62,12 @@ static constexpr const char * ATTR_BASE_PATH = "basePath";
 static constexpr const char * ATTR_BITDEPTH_IN = "inBitDepth";
 static constexpr const char * ATTR_BITDEPTH_OUT = "outBitDepth";
 static constexpr const char * ATTR_CHAN = "channel";
+static constexpr const char * ATTR_CHECKSUM = "checksum";
 static constexpr const char * ATTR_COMP_CLF_VERSION = "compCLFversion";
 static constexpr const char * ATTR_CONTRAST = "contrast";
 static constexpr const char * ATTR_DIMENSION = "dim";
+static constexpr const char * ATTR_ENCODED_BITDEPTH = "encodedBitDepth";
+static constexpr const char * ATTR_ENCODING = "encoding";
 static constexpr const char * ATTR_EXPOSURE = "exposure";
 static constexpr const char * ATTR_GAMMA = "gamma";
 static constexpr const char * ATTR_HALF_DOMAIN = "halfDomain";
@@ -81,6 +95,8 @@ static constexpr const char * ATTR_SHADOW = "shadow";
 static constexpr const char * ATTR_STYLE = "style";
 static constexpr const char * ATTR_VERSION = "version";
 
+static constexpr const char * ENCODING_BASE64 = "base64";
+
 static constexpr const char * LOG_LOG2 = "log2";
 static constexpr const char * LOG_LOG10 = "log10";
 static constexpr const char * LOG_ANTILOG2 = "antiLog2";
@@ -19,6 +19,7 @@
 #include "ops/matrix/MatrixOpData.h"
 #include "ops/range/RangeOpData.h"
 #include "ops/reference/ReferenceOpData.h"
+#include "ParseUtils.h"
 #include "Platform.h"
 #include "transforms/CDLTransform.h"
 
@@ -469,6 +470,39 @@ void SetOStream<double>(double, std::ostream & xml)
     xml.precision(15);
 }
 
+template <typename T>
+void AppendValue(T value, const NumberFormatter & numberFormatter, unsigned width, std::string & str)
+{
+    const char * special = nullptr;
+    if (IsNan(value))
+    {
+        special = "nan";
+    }
+    else if (value == std::numeric_limits<T>::infinity())
+    {
+        special = "inf";
+    }
+    else if (std::is_signed<T>::value &&
+        value == -std::numeric_limits<T>::infinity())
+    {
+        special = "-inf";
+    }
+
+    if (special)
+    {
+        const size_t length = strlen(special);
+        if (length < width)
+        {
+            str.append(width - length, ' ');
+        }
+        str += special;
+    }
+    else
+    {
+        numberFormatter.append(str, value, width);
+    }
+}
+
 template<typename Iter, typename scaleType>
 void WriteValues(XmlFormatter & formatter,
                  Iter valuesBegin,
@@ -480,77 +514,137 @@ void WriteValues(XmlFormatter & formatter,
 {
     std::ostream& xml = formatter.getStream();
 
-    for (Iter it(valuesBegin); it != valuesEnd; it += iterStep)
+    bool isFloat = false;
+
+    switch (bitDepth)
     {
-        switch (bitDepth)
-        {
-        case BIT_DEPTH_UINT8:
-        {
-            xml.width(3);
-            xml << (*it) * scale;
-            break;
-        }
-        case BIT_DEPTH_UINT10:
-        {
-            xml.width(4);
-            xml << (*it) * scale;
-            break;
-        }
+    case BIT_DEPTH_UINT8:
+    {
+        xml.width(3);
+        break;
+    }
+    case BIT_DEPTH_UINT10:
+    {
+        xml.width(4);
+        break;
+    }
 
-        case BIT_DEPTH_UINT12:
-        {
-            xml.width(4);
-            xml << (*it) * scale;
-            break;
-        }
+    case BIT_DEPTH_UINT12:
+    {
+        xml.width(4);
+        break;
+    }
 
-        case BIT_DEPTH_UINT16:
-        {
-            xml.width(5);
-            xml << (*it) * scale;
-            break;
-        }
+    case BIT_DEPTH_UINT16:
+    {
+        xml.width(5);
+        break;
+    }
 
-        case BIT_DEPTH_F16:
-        {
-            xml.width(11);
-            xml.precision(5);
-            WriteValue((*it) * scale, xml);
-            break;
-        }
+    case BIT_DEPTH_F16:
+    {
+        xml.width(11);
+        xml.precision(5);
+        isFloat = true;
+        break;
+    }
 
-        case BIT_DEPTH_F32:
-        {
-            SetOStream(*it, xml);
-            WriteValue((*it) * scale, xml);
-            break;
-        }
+    case BIT_DEPTH_F32:
+    {
+        SetOStream(typename std::iterator_traits<Iter>::value_type(), xml);
+        isFloat = true;
+        break;
+    }
 
-        case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
-        {
-            throw Exception("Unsupported bitdepth.");
-            break;
-        }
+    case BIT_DEPTH_UINT14:
+    case BIT_DEPTH_UINT32:
+    {
+        throw Exception("Unsupported bitdepth.");
+        break;
+    }
+
+    case BIT_DEPTH_UNKNOWN:
+    {
+        throw Exception("Unknown bitdepth.");
+        break;
+    }
+
+    }
+
+    const unsigned width = unsigned(xml.width());
+    xml.width(0);
 
-        case BIT_DEPTH_UNKNOWN:
+    // The values are formatted like the stream would do, but in a buffer which is much
+    // faster when writing large LUTs.
+    const NumberFormatter numberFormatter(xml);
+    std::string buffer;
+
+    for (Iter it(valuesBegin); it != valuesEnd; it += iterStep)
+    {
+        if (isFloat)
         {
-            throw Exception("Unknown bitdepth.");
-            break;
+            AppendValue((*it) * scale, numberFormatter, width, buffer);
         }
-
+        else
+        {
+            numberFormatter.append(buffer, (*it) * scale, width);
         }
 
         if (std::distance(valuesBegin, it) % valuesPerLine
             == valuesPerLine - 1)
         {
-            xml << std::endl;
+            buffer += '\n';
         }
         else
         {
-            xml << " ";
+            buffer += ' ';
         }
     }
+
+    xml << buffer;
+}
+
+// Write the values as little-endian 16f or 32f values encoded in base64 instead of text,
+// which is much smaller and faster to read for large LUTs.
+template<typename Iter, typename scaleType>
+void WriteEncodedValues(XmlFormatter & formatter,
+                        XmlFormatter::Attributes & attributes,
+                        Iter valuesBegin,
+                        Iter valuesEnd,
+                        BitDepth encodedBitDepth,
+                        unsigned iterStep,
+                        scaleType scale)
+{
+    std::string bytes;
+    bytes.reserve(std::distance(valuesBegin, valuesEnd) / iterStep
+                  * GetEncodedArrayValueSize(encodedBitDepth));
+
+    for (Iter it(valuesBegin); it != valuesEnd; it += iterStep)
+    {
+        AppendEncodedArrayValue(bytes, float((*it) * scale), encodedBitDepth);
+    }
+
+    attributes.push_back(XmlFormatter::Attribute(ATTR_ENCODING, ENCODING_BASE64));
+    attributes.push_back(XmlFormatter::Attribute(ATTR_ENCODED_BITDEPTH,
+                                                 encodedBitDepth == BIT_DEPTH_F16 ? "16f" : "32f"));
+    attributes.push_back(XmlFormatter::Attribute(ATTR_CHECKSUM, GetEncodedArrayChecksum(bytes)));
+
+    formatter.writeStartTag(TAG_ARRAY, attributes);
+
+    // Split the encoded values in lines of 76 characters like the MIME base64 encoding.
+    static constexpr size_t LINE_LENGTH = 76;
+
+    const std::string encoded = EncodeBase64(bytes.data(), bytes.size());
+
+    std::string buffer;
+    buffer.reserve(encoded.size() + encoded.size() / LINE_LENGTH + 1);
+    for (size_t pos = 0; pos < encoded.size(); pos += LINE_LENGTH)
+    {
+        buffer.append(encoded, pos, LINE_LENGTH);
+        buffer += '\n';
+    }
+
+    formatter.getStream() << buffer;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -569,6 +663,7 @@ public:
 
     inline void setInputBitdepth(BitDepth in) { m_inBitDepth = in; }
     inline void setOutputBitdepth(BitDepth out) { m_outBitDepth = out; }
+    inline void setBase64Arrays(bool base64Arrays) { m_base64Arrays = base64Arrays; }
 
 protected:
     virtual ConstOpDataRcPtr getOp() const = 0;
@@ -579,6 +674,7 @@ protected:
 
     BitDepth m_inBitDepth = BIT_DEPTH_UNKNOWN;
     BitDepth m_outBitDepth = BIT_DEPTH_UNKNOWN;
+    bool m_base64Arrays = false;
 };
 
 OpWriter::OpWriter(XmlFormatter & formatter)
@@ -1359,11 +1455,10 @@ void Lut1DWriter::writeContent() const
     attributes.push_back(XmlFormatter::Attribute(ATTR_DIMENSION,
                                                  dimension.str()));
 
-    m_formatter.writeStartTag(TAG_ARRAY, attributes);
-
     // To avoid needing to duplicate the const objects,
     // we scale the values on-the-fly while writing.
     const float scale = (float)GetBitDepthMaxValue(m_outBitDepth);
+    const unsigned iterStep = array.getNumColorComponents() == 1 ? 3 : 1;
 
     if (m_lut->isOutputRawHalfs())
     {
@@ -1378,23 +1473,43 @@ void Lut1DWriter::writeContent() const
             values[i] = h.bits();
         }
 
-        WriteValues(m_formatter,
-                    values.begin(),
-                    values.end(),
-                    array.getNumColorComponents(),
-                    BIT_DEPTH_UINT16,
-                    array.getNumColorComponents() == 1 ? 3 : 1,
-                    1.0f);
+        if (m_base64Arrays)
+        {
+            // The 16-bit integers are exactly represented by the 32f values.
+            WriteEncodedValues(m_formatter, attributes, values.begin(), values.end(),
+                               BIT_DEPTH_F32, iterStep, 1.0f);
+        }
+        else
+        {
+            m_formatter.writeStartTag(TAG_ARRAY, attributes);
+
+            WriteValues(m_formatter,
+                        values.begin(),
+                        values.end(),
+                        array.getNumColorComponents(),
+                        BIT_DEPTH_UINT16,
+                        iterStep,
+                        1.0f);
+        }
+    }
+    else if (m_base64Arrays)
+    {
+        const Array::Values & values = array.getValues();
+        WriteEncodedValues(m_formatter, attributes, values.begin(), values.end(),
+                           m_outBitDepth == BIT_DEPTH_F16 ? BIT_DEPTH_F16 : BIT_DEPTH_F32,
+                           iterStep, scale);
     }
     else
     {
+        m_formatter.writeStartTag(TAG_ARRAY, attributes);
+
         const Array::Values & values = array.getValues();
         WriteValues(m_formatter,
                     values.begin(),
                     values.end(),
                     array.getNumColorComponents(),
                     m_outBitDepth,
-                    array.getNumColorComponents() == 1 ? 3 : 1,
+                    iterStep,
                     scale);
     }
 
@@ -1481,18 +1596,32 @@ void Lut3DWriter::writeContent() const
     attributes.push_back(XmlFormatter::Attribute(ATTR_DIMENSION,
                          dimension.str()));
 
-    m_formatter.writeStartTag(TAG_ARRAY, attributes);
-
     // To avoid needing to duplicate the const objects,
     // we scale the values on-the-fly while writing.
     const float scale = (float)GetBitDepthMaxValue(m_outBitDepth);
-    WriteValues(m_formatter,
-                array.getValues().begin(),
-                array.getValues().end(),
-                3,
-                m_outBitDepth,
-                1,
-                scale);
+
+    if (m_base64Arrays)
+    {
+        WriteEncodedValues(m_formatter,
+                           attributes,
+                           array.getValues().begin(),
+                           array.getValues().end(),
+                           m_outBitDepth == BIT_DEPTH_F16 ? BIT_DEPTH_F16 : BIT_DEPTH_F32,
+                           1,
+                           scale);
+    }
+    else
+    {
+        m_formatter.writeStartTag(TAG_ARRAY, attributes);
+
+        WriteValues(m_formatter,
+                    array.getValues().begin(),
+                    array.getValues().end(),
+                    3,
+                    m_outBitDepth,
+                    1,
+                    scale);
+    }
 
     m_formatter.writeEndTag(TAG_ARRAY);
 }
@@ -1719,10 +1848,12 @@ void RangeWriter::writeContent() const
 
 TransformWriter::TransformWriter(XmlFormatter & formatter,
                                  ConstCTFReaderTransformPtr transform,
-                                 bool isCLF)
+                                 bool isCLF,
+                                 bool base64Arrays)
     : XmlElementWriter(formatter)
     , m_transform(transform)
     , m_isCLF(isCLF)
+    , m_base64Arrays(base64Arrays)
 {
 }
 
@@ -1747,7 +1878,19 @@ void TransformWriter::write() const
     }
     else
     {
-        fversion << GetMinimumVersion(m_transform);
+        CTFVersion version = GetMinimumVersion(m_transform);
+        if (m_base64Arrays && version < CTF_PROCESS_LIST_VERSION_2_1)
+        {
+            for (const auto & op : m_transform->getOps())
+            {
+                if (op->getType() == OpData::Lut1DType || op->getType() == OpData::Lut3DType)
+                {
+                    version = CTF_PROCESS_LIST_VERSION_2_1;
+                    break;
+                }
+            }
+        }
+        fversion << version;
 
         attributes.push_back(XmlFormatter::Attribute(ATTR_VERSION,
                                                      fversion.str()));
@@ -2005,6 +2148,7 @@ void TransformWriter::writeOps() const
                 outBD = GetValidatedFileBitDepth(lut->getFileOutputBitDepth(), type);
                 opWriter.setInputBitdepth(inBD);
                 opWriter.setOutputBitdepth(outBD);
+                opWriter.setBase64Arrays(m_base64Arrays);
 
                 opWriter.write();
                 break;
@@ -2025,6 +2169,7 @@ void TransformWriter::writeOps() const
                 outBD = GetValidatedFileBitDepth(lut->getFileOutputBitDepth(), type);
                 opWriter.setInputBitdepth(inBD);
                 opWriter.setOutputBitdepth(outBD);
+                opWriter.setBase64Arrays(m_base64Arrays);
 
                 opWriter.write();
                 break;
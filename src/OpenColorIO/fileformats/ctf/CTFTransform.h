@@ -109,9 +109,12 @@ static const CTFVersion CTF_PROCESS_LIST_VERSION_1_8 = CTFVersion(1, 8);
 // TODO: Version 2.0 (TBD) sync with OCIO and incorporate CLF v3 changes.
 static const CTFVersion CTF_PROCESS_LIST_VERSION_2_0 = CTFVersion(2, 0);
 
+// Version 2.1 adds the base64 encoding of the LUT arrays.
+static const CTFVersion CTF_PROCESS_LIST_VERSION_2_1 = CTFVersion(2, 1);
+
 // Add new version before this line
 // and do not forget to update the following line.
-static const CTFVersion CTF_PROCESS_LIST_VERSION = CTF_PROCESS_LIST_VERSION_2_0;
+static const CTFVersion CTF_PROCESS_LIST_VERSION = CTF_PROCESS_LIST_VERSION_2_1;
 
 
 // Version 1.0 initial Autodesk version for InfoElt.
@@ -255,9 +258,11 @@ public:
     TransformWriter(const TransformWriter &) = delete;
     TransformWriter& operator=(const TransformWriter &) = delete;
 
+    // The LUT arrays are base64 encoded if base64Arrays is true (CTF only).
     TransformWriter(XmlFormatter & formatter,
                     ConstCTFReaderTransformPtr transform,
-                    bool isCLF);
+                    bool isCLF,
+                    bool base64Arrays = false);
 
     virtual ~TransformWriter();
 
@@ -271,6 +276,7 @@ private:
 private:
     ConstCTFReaderTransformPtr m_transform;
     bool                       m_isCLF;
+    bool                       m_base64Arrays;
 };
 
 
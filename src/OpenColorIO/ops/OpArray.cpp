@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <map>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "ops/OpArray.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+typedef OCIO_SHARED_PTR<std::vector<float>> FloatValuesRcPtr;
+
+// The interned values keyed by their hash. As the map holds a reference, the values of the
+// arrays are always copied before being modified.
+typedef std::map<std::string, FloatValuesRcPtr> InternedValuesMap;
+
+InternedValuesMap g_internedValues;
+Mutex g_internedValuesMutex;
+
+// The unused values are only removed when the map doubles in size so that interning many
+// LUTs does not scan the whole map each time.
+static constexpr size_t MIN_PRUNE_SIZE = 64;
+size_t g_pruneSize = MIN_PRUNE_SIZE;
+
+// You must manually acquire the interned values mutex before calling this.
+void RemoveUnusedValues()
+{
+    for (auto iter = g_internedValues.begin(); iter != g_internedValues.end();)
+    {
+        if (iter->second.use_count() == 1)
+        {
+            iter = g_internedValues.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    g_pruneSize = std::max(MIN_PRUNE_SIZE, 2 * g_internedValues.size());
+}
+
+} // anon.
+
+void InternArrayValues(FloatValuesRcPtr & values, const std::string & hash)
+{
+    AutoMutex lock(g_internedValuesMutex);
+
+    auto iter = g_internedValues.find(hash);
+    if (iter != g_internedValues.end())
+    {
+        if (iter->second == values)
+        {
+            // Already shared.
+            return;
+        }
+
+        // Never share different values having the same hash.
+        if (*iter->second == *values)
+        {
+            values = iter->second;
+        }
+        else if (iter->second.use_count() == 1)
+        {
+            iter->second = values;
+        }
+        return;
+    }
+
+    if (g_internedValues.size() >= g_pruneSize)
+    {
+        RemoveUnusedValues();
+    }
+
+    g_internedValues[hash] = values;
+}
+
+void ClearInternedArrayValues()
+{
+    AutoMutex lock(g_internedValuesMutex);
+
+    // The values still used stay interned so that the arrays holding them never replace
+    // their values (i.e. the CPU renderers may point to them).
+    RemoveUnusedValues();
+}
+
+void GetLutMemoryUsage(unsigned long long & uniqueSize, unsigned long long & logicalSize)
+{
+    AutoMutex lock(g_internedValuesMutex);
+
+    uniqueSize  = 0;
+    logicalSize = 0;
+
+    for (const auto & interned : g_internedValues)
+    {
+        // Exclude the reference held by the map.
+        const unsigned long long numArrays = interned.second.use_count() - 1;
+        if (numArrays > 0)
+        {
+            const unsigned long long size = interned.second->size() * sizeof(float);
+
+            uniqueSize  += size;
+            logicalSize += size * numArrays;
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
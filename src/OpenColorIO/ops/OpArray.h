@@ -4,7 +4,9 @@
 #ifndef INCLUDED_OCIO_OPARRAY_H
 #define INCLUDED_OCIO_OPARRAY_H
 
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -12,6 +14,15 @@
 namespace OCIO_NAMESPACE
 {
 
+// Share the LUT values having the same hash and content across all the arrays: the values
+// are replaced by the already interned ones if any, otherwise the values are interned.
+// The interned values are never modified since the arrays copy shared values before any
+// modification.
+void InternArrayValues(OCIO_SHARED_PTR<std::vector<float>> & values, const std::string & hash);
+
+// Release the interned values which are not used anymore.
+void ClearInternedArrayValues();
+
 class ArrayBase
 {
 public:
@@ -32,15 +43,20 @@ public:
 // other classes. Since the dimensionality of the underlying array of those 
 // classes varies, the interpretation of "length" is defined by child classes.
 // The class represents the array for a 3by1D LUT and a 3D LUT or a matrix.
+//
+// The values are shared by the copies of the array (e.g. when the ops are cloned) and are
+// only copied when they are modified through one of the non-const accessors.
 template<typename T> class ArrayT : public ArrayBase
 {
 public:
     typedef std::vector<T> Values;
+    typedef OCIO_SHARED_PTR<Values> ValuesRcPtr;
 
 public:
     ArrayT()
         : m_length(0)
         , m_numColorComponents(0)
+        , m_data(std::make_shared<Values>())
     {
     }
 
@@ -55,7 +71,7 @@ public:
     {
         m_length = length;
         m_numColorComponents = numColorComponents;
-        m_data.resize(getNumValues());
+        resizeValues();
     }
 
     void setLength(unsigned long length)
@@ -63,13 +79,13 @@ public:
         if (m_length != length)
         {
             m_length = length;
-            m_data.resize(getNumValues());
+            resizeValues();
         }
     }
 
     void setDoubleValue(unsigned long index, double value) override
     {
-        m_data[index] = (T)value;
+        getValues()[index] = (T)value;
     }
 
     unsigned long getLength() const override
@@ -82,7 +98,7 @@ public:
         if (m_numColorComponents != getMaxColorComponents())
         {
             m_numColorComponents = getMaxColorComponents();
-            m_data.resize(getNumValues());
+            resizeValues();
         }
     }
 
@@ -96,7 +112,7 @@ public:
         if (m_numColorComponents != numColorComponents)
         {
             m_numColorComponents = numColorComponents;
-            m_data.resize(getNumValues());
+            resizeValues();
         }
     }
 
@@ -104,11 +120,12 @@ public:
     {
         if (m_numColorComponents == 3)
         {
+            const Values & data = *m_data;
             bool sameCoeff = true;
             for (unsigned long idx = 0; idx < m_length && sameCoeff; ++idx)
             {
-                if (m_data[idx * 3] != m_data[idx * 3 + 1]
-                    || m_data[idx * 3] != m_data[idx * 3 + 2])
+                if (data[idx * 3] != data[idx * 3 + 1]
+                    || data[idx * 3] != data[idx * 3 + 2])
                 {
                     sameCoeff = false;
                     break;
@@ -129,22 +146,34 @@ public:
 
     inline const Values& getValues() const
     {
-        return m_data;
+        return *m_data;
     }
 
+    // Copy the values first if they are shared.
     inline Values& getValues()
     {
-        return m_data;
+        if (m_data.use_count() > 1)
+        {
+            m_data = std::make_shared<Values>(*m_data);
+        }
+        return *m_data;
     }
 
     inline const T& operator[](unsigned long index) const
     {
-        return m_data[index];
+        return (*m_data)[index];
     }
 
     inline T& operator[](unsigned long index)
     {
-        return m_data[index];
+        return getValues()[index];
+    }
+
+    // Share the values with the other arrays holding the same values (refer to
+    // InternArrayValues()).
+    void internValues(const std::string & hash)
+    {
+        InternArrayValues(m_data, hash);
     }
 
     virtual void validate() const
@@ -156,10 +185,10 @@ public:
 
         // getNumValues is based on the dimensions claimed in the file.  Check
         // that this matches the number of values that were actually set.
-        if (m_data.size() != getNumValues())
+        if (m_data->size() != getNumValues())
         {
             std::ostringstream os;
-            os << "Array contains: " << m_data.size() << " values, ";
+            os << "Array contains: " << m_data->size() << " values, ";
             os << "but " << getNumValues() << " are expected.";
             throw Exception(os.str().c_str());
         }
@@ -170,25 +199,34 @@ public:
         if (this == &a) return true;
         return (m_length == a.m_length)
             && (m_numColorComponents == a.m_numColorComponents)
-            && (m_data == a.m_data);
+            && (m_data == a.m_data || *m_data == *a.m_data);
     }
 
     void scale(T scale)
     {
         if (scale != (T)1.)
         {
-            const size_t nbVal = m_data.size();
+            Values & data = getValues();
+            const size_t nbVal = data.size();
             for (size_t i = 0; i < nbVal; ++i)
             {
-                m_data[i] *= scale;
+                data[i] *= scale;
             }
         }
     }
 
 protected:
+    void resizeValues()
+    {
+        if (m_data->size() != getNumValues())
+        {
+            getValues().resize(getNumValues());
+        }
+    }
+
     unsigned long m_length;
     unsigned long m_numColorComponents;
-    Values        m_data;
+    ValuesRcPtr   m_data;
 };
 
 typedef ArrayT<double> ArrayDouble;
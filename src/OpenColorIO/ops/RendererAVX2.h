@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_RENDERERAVX2_H
+#define INCLUDED_OCIO_RENDERERAVX2_H
+
+
+#include <memory>
+#include <utility>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Op.h"
+#include "Platform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+#ifdef USE_SSE
+
+// AVX2 version of a renderer, to only be used when the CPU supports AVX2 (refer to
+// IsSupported()). The renderer must implement:
+//   void applyAVX2(const float * in, float * out, long numPixels) const;
+template<typename Renderer>
+class RendererAVX2 : public Renderer
+{
+public:
+    template<typename... Args>
+    explicit RendererAVX2(Args &&... args) : Renderer(std::forward<Args>(args)...) {}
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        this->applyAVX2((const float *)inImg, (float *)outImg, numPixels);
+    }
+
+    static bool IsSupported()
+    {
+        const Platform::CPUInfo & info = Platform::GetCPUInfo();
+        return info.hasAVX2;
+    }
+};
+
+#endif
+
+// Create the AVX2 version of the renderer when the CPU supports it.
+template<typename Renderer, typename... Args>
+ConstOpCPURcPtr CreateRenderer(Args &&... args)
+{
+#ifdef USE_SSE
+    if (RendererAVX2<Renderer>::IsSupported())
+    {
+        return std::make_shared<RendererAVX2<Renderer>>(std::forward<Args>(args)...);
+    }
+#endif
+    return std::make_shared<Renderer>(std::forward<Args>(args)...);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif
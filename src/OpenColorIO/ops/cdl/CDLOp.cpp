@@ -53,7 +53,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -154,10 +154,12 @@ void CDLOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr CDLOp::getCPUOp() const
+ConstOpCPURcPtr CDLOp::getCPUOp(OptimizationFlags oFlags) const
 {
+    const bool fastLogExpPow
+        = (oFlags & OPTIMIZATION_FAST_LOG_EXP_POW) == OPTIMIZATION_FAST_LOG_EXP_POW;
     ConstCDLOpDataRcPtr data = cdlData();
-    return CDLOpCPU::GetRenderer(data);
+    return CDLOpCPU::GetRenderer(data, fastLogExpPow);
 }
 
 void CDLOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
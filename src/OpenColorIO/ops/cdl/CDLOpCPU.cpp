@@ -9,6 +9,7 @@
 
 #include "BitDepthUtils.h"
 #include "CDLOpCPU.h"
+#include "MathUtils.h"
 #include "SSE.h"
 
 
@@ -172,17 +173,17 @@ inline void ApplyClamp<false>(__m128&)
 // base is negative in this mode, pixel values are just passed
 // through.
 template<bool>
-inline void ApplyPower(__m128& pix, const __m128& power)
+inline void ApplyPower(__m128& pix, const __m128& power, bool fastPower)
 {
     ApplyClamp<true>(pix);
-    pix = ssePower(pix, power);
+    pix = ssePower(pix, power, fastPower);
 }
 
 template<>
-inline void ApplyPower<false>(__m128& pix, const __m128& power)
+inline void ApplyPower<false>(__m128& pix, const __m128& power, bool fastPower)
 {
     __m128 negMask = _mm_cmplt_ps(pix, EZERO);
-    __m128 pixPower = ssePower(pix, power);
+    __m128 pixPower = ssePower(pix, power, fastPower);
     pix = sseSelect(negMask, pix, pixPower);
 }
 
@@ -272,28 +273,29 @@ inline void ApplyClamp<false>(float *)
 // base is negative in this mode, pixel values are just passed
 // through.
 template<bool>
-inline void ApplyPower(float * pix, const float * power)
+inline void ApplyPower(float * pix, const float * power, bool fastPower)
 {
     ApplyClamp<true>(pix);
-    pix[0] = powf(pix[0], power[0]);
-    pix[1] = powf(pix[1], power[1]);
-    pix[2] = powf(pix[2], power[2]);
+    pix[0] = Power(pix[0], power[0], fastPower);
+    pix[1] = Power(pix[1], power[1], fastPower);
+    pix[2] = Power(pix[2], power[2], fastPower);
 }
 
 template<>
-inline void ApplyPower<false>(float * pix, const float * power)
+inline void ApplyPower<false>(float * pix, const float * power, bool fastPower)
 {
     // Note: Set NaNs to 0 to match the SSE path.
-    pix[0] = IsNan(pix[0]) ? 0.0f : (pix[0]<0.f ? pix[0] : powf(pix[0], power[0]));
-    pix[1] = IsNan(pix[1]) ? 0.0f : (pix[1]<0.f ? pix[1] : powf(pix[1], power[1]));
-    pix[2] = IsNan(pix[2]) ? 0.0f : (pix[2]<0.f ? pix[2] : powf(pix[2], power[2]));
+    pix[0] = IsNan(pix[0]) ? 0.0f : (pix[0]<0.f ? pix[0] : Power(pix[0], power[0], fastPower));
+    pix[1] = IsNan(pix[1]) ? 0.0f : (pix[1]<0.f ? pix[1] : Power(pix[1], power[1], fastPower));
+    pix[2] = IsNan(pix[2]) ? 0.0f : (pix[2]<0.f ? pix[2] : Power(pix[2], power[2], fastPower));
 }
 
 #endif // USE_SSE
 
 
-CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl)
+CDLOpCPU::CDLOpCPU(ConstCDLOpDataRcPtr & cdl, bool fastPower)
     :   OpCPU()
+    ,   m_fastPower(fastPower)
 {
     m_renderParams.update(cdl);
 }
@@ -312,8 +314,8 @@ void LoadRenderParams(const RenderParams & renderParams,
 }
 #endif
 
-CDLRendererV1_2Fwd::CDLRendererV1_2Fwd(ConstCDLOpDataRcPtr & cdl)
-    :   CDLOpCPU(cdl)
+CDLRendererV1_2Fwd::CDLRendererV1_2Fwd(ConstCDLOpDataRcPtr & cdl, bool fastPower)
+    :   CDLOpCPU(cdl, fastPower)
 {
 }
 
@@ -345,7 +347,7 @@ void CDLRendererV1_2Fwd::_apply(const float * inImg, float * outImg, long numPix
         ApplySlope(pix, slope);
         ApplyOffset(pix, offset);
 
-        ApplyPower<CLAMP>(pix, power);
+        ApplyPower<CLAMP>(pix, power, m_fastPower);
 
         ApplySaturation(pix, saturation);
         ApplyClamp<CLAMP>(pix);
@@ -373,7 +375,7 @@ void CDLRendererV1_2Fwd::_apply(const float * inImg, float * outImg, long numPix
         ApplySlope(out, inSlope);
         ApplyOffset(out, m_renderParams.getOffset());
 
-        ApplyPower<CLAMP>(out, m_renderParams.getPower());
+        ApplyPower<CLAMP>(out, m_renderParams.getPower(), m_fastPower);
 
         ApplySaturation(out, m_renderParams.getSaturation());
         ApplyClamp<CLAMP>(out);
@@ -386,8 +388,8 @@ void CDLRendererV1_2Fwd::_apply(const float * inImg, float * outImg, long numPix
 #endif
 }
 
-CDLRendererNoClampFwd::CDLRendererNoClampFwd(ConstCDLOpDataRcPtr & cdl)
-    :   CDLRendererV1_2Fwd(cdl)
+CDLRendererNoClampFwd::CDLRendererNoClampFwd(ConstCDLOpDataRcPtr & cdl, bool fastPower)
+    :   CDLRendererV1_2Fwd(cdl, fastPower)
 {
 }
 
@@ -396,8 +398,8 @@ void CDLRendererNoClampFwd::apply(const void * inImg, void * outImg, long numPix
     _apply<false>((const float *)inImg, (float *)outImg, numPixels);
 }
 
-CDLRendererV1_2Rev::CDLRendererV1_2Rev(ConstCDLOpDataRcPtr & cdl)
-    :   CDLOpCPU(cdl)
+CDLRendererV1_2Rev::CDLRendererV1_2Rev(ConstCDLOpDataRcPtr & cdl, bool fastPower)
+    :   CDLOpCPU(cdl, fastPower)
 {
 }
 
@@ -429,7 +431,7 @@ void CDLRendererV1_2Rev::_apply(const float * inImg, float * outImg, long numPix
         ApplyClamp<CLAMP>(pix);
         ApplySaturation(pix, saturationRev);
 
-        ApplyPower<CLAMP>(pix, powerRev);
+        ApplyPower<CLAMP>(pix, powerRev, m_fastPower);
 
         ApplyOffset(pix, offsetRev);
         ApplySlope(pix, slopeRev);
@@ -454,7 +456,7 @@ void CDLRendererV1_2Rev::_apply(const float * inImg, float * outImg, long numPix
         ApplyClamp<CLAMP>(out);
         ApplySaturation(out, m_renderParams.getSaturation());
 
-        ApplyPower<CLAMP>(out, m_renderParams.getPower());
+        ApplyPower<CLAMP>(out, m_renderParams.getPower(), m_fastPower);
 
         ApplyOffset(out, m_renderParams.getOffset());
         ApplySlope(out, m_renderParams.getSlope());
@@ -469,8 +471,8 @@ void CDLRendererV1_2Rev::_apply(const float * inImg, float * outImg, long numPix
 #endif
 }
 
-CDLRendererNoClampRev::CDLRendererNoClampRev(ConstCDLOpDataRcPtr & cdl)
-    :   CDLRendererV1_2Rev(cdl)
+CDLRendererNoClampRev::CDLRendererNoClampRev(ConstCDLOpDataRcPtr & cdl, bool fastPower)
+    :   CDLRendererV1_2Rev(cdl, fastPower)
 {
 }
 
@@ -480,18 +482,18 @@ void CDLRendererNoClampRev::apply(const void * inImg, void * outImg, long numPix
 }
 
 // TODO:  Add a faster renderer for the case where power and saturation are 1.
-ConstOpCPURcPtr CDLOpCPU::GetRenderer(ConstCDLOpDataRcPtr & cdl)
+ConstOpCPURcPtr CDLOpCPU::GetRenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
 {
     switch(cdl->getStyle())
     {
         case CDLOpData::CDL_V1_2_FWD:
-            return std::make_shared<CDLRendererV1_2Fwd>(cdl);
+            return std::make_shared<CDLRendererV1_2Fwd>(cdl, fastPower);
         case CDLOpData::CDL_NO_CLAMP_FWD:
-            return std::make_shared<CDLRendererNoClampFwd>(cdl);
+            return std::make_shared<CDLRendererNoClampFwd>(cdl, fastPower);
         case CDLOpData::CDL_V1_2_REV:
-            return std::make_shared<CDLRendererV1_2Rev>(cdl);
+            return std::make_shared<CDLRendererV1_2Rev>(cdl, fastPower);
         case CDLOpData::CDL_NO_CLAMP_REV:
-            return std::make_shared<CDLRendererNoClampRev>(cdl);
+            return std::make_shared<CDLRendererNoClampRev>(cdl, fastPower);
     }
 
     throw Exception("Unknown CDL style");
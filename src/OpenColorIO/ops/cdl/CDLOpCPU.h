@@ -60,9 +60,9 @@ class CDLOpCPU : public OpCPU
 public:
 
     // Get the dedicated renderer
-    static ConstOpCPURcPtr GetRenderer(ConstCDLOpDataRcPtr & cdl);
+    static ConstOpCPURcPtr GetRenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
-    CDLOpCPU(ConstCDLOpDataRcPtr & cdl);
+    CDLOpCPU(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
 protected:
     const RenderParams & getRenderParams() const { return m_renderParams; }
@@ -70,6 +70,9 @@ protected:
 protected:
     RenderParams m_renderParams;
 
+    // Use the fast approximation of the power function.
+    bool m_fastPower;
+
 private:
     CDLOpCPU();
 };
@@ -77,7 +80,7 @@ private:
 class CDLRendererV1_2Fwd : public CDLOpCPU
 {
 public:
-    CDLRendererV1_2Fwd(ConstCDLOpDataRcPtr & cdl);
+    CDLRendererV1_2Fwd(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
 
@@ -89,7 +92,7 @@ protected:
 class CDLRendererNoClampFwd : public CDLRendererV1_2Fwd
 {
 public:
-    CDLRendererNoClampFwd(ConstCDLOpDataRcPtr & cdl);
+    CDLRendererNoClampFwd(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
 };
@@ -97,7 +100,7 @@ public:
 class CDLRendererV1_2Rev : public CDLOpCPU
 {
 public:
-    CDLRendererV1_2Rev(ConstCDLOpDataRcPtr & cdl);
+    CDLRendererV1_2Rev(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
 
@@ -109,7 +112,7 @@ protected:
 class CDLRendererNoClampRev : public CDLRendererV1_2Rev
 {
 public:
-    CDLRendererNoClampRev(ConstCDLOpDataRcPtr & cdl);
+    CDLRendererNoClampRev(ConstCDLOpDataRcPtr & cdl, bool fastPower);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
 };
@@ -140,7 +140,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -240,7 +240,7 @@ void ExponentOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr ExponentOp::getCPUOp() const
+ConstOpCPURcPtr ExponentOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     return std::make_shared<ExponentOpCPU>(expData());
 }
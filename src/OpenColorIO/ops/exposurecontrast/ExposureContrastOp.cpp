@@ -48,7 +48,7 @@ public:
                                 DynamicPropertyImplRcPtr prop) override;
     void removeDynamicProperties() override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -132,10 +132,12 @@ void ExposureContrastOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr ExposureContrastOp::getCPUOp() const
+ConstOpCPURcPtr ExposureContrastOp::getCPUOp(OptimizationFlags oFlags) const
 {
+    const bool fastLogExpPow
+        = (oFlags & OPTIMIZATION_FAST_LOG_EXP_POW) == OPTIMIZATION_FAST_LOG_EXP_POW;
     ConstExposureContrastOpDataRcPtr ecOpData = ecData();
-    return GetExposureContrastCPURenderer(ecOpData);
+    return GetExposureContrastCPURenderer(ecOpData, fastLogExpPow);
 }
 
 void ExposureContrastOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
@@ -8,6 +8,7 @@
 
 #include "BitDepthUtils.h"
 #include "DynamicProperty.h"
+#include "MathUtils.h"
 #include "ops/exposurecontrast/ExposureContrastOpCPU.h"
 #include "SSE.h"
 
@@ -22,25 +23,46 @@ class ECRendererBase : public OpCPU
 public:
     ECRendererBase() = delete;
     ECRendererBase(const ECRendererBase &) = delete;   
-    explicit ECRendererBase(ConstExposureContrastOpDataRcPtr & ec);
+    ECRendererBase(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
     virtual ~ECRendererBase();
 
+    // Use the current values of the dynamic properties.
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
     bool hasDynamicProperty(DynamicPropertyType type) const override;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
 protected:
     virtual void updateData(ConstExposureContrastOpDataRcPtr & ec) = 0;
 
+    // Compute the contrast and exposure values used by the renderer from the values of the
+    // dynamic properties.
+    virtual void computeParams(double exposure, double contrast, double gamma,
+                               float & contrastVal, float & exposureVal) const = 0;
+
+    // Get the contrast and exposure values used by the renderer, only computed again when
+    // one of the dynamic properties changes.
+    void getParams(const DynamicPropertySnapshot & snapshot,
+                   float & contrastVal, float & exposureVal) const;
+
     DynamicPropertyImplRcPtr m_exposure;
     DynamicPropertyImplRcPtr m_contrast;
     DynamicPropertyImplRcPtr m_gamma;
 
     float m_pivot = 0.0f;
     float m_logExposureStep = 0.088f;
+
+    // Use the fast approximation of the power function.
+    bool m_fastPower = true;
+
+private:
+    // The values computed by computeParams() keyed on the versions of the dynamic properties.
+    mutable DynamicPropertyCache<3, 2> m_params;
 };
 
-ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec)
+ECRendererBase::ECRendererBase(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
     : OpCPU()
+    , m_fastPower(fastPower)
 {
     // Copy DynamicPropertyImpl sharedPtr so that if content changes in ec
     // change will be reflected here.
@@ -53,6 +75,30 @@ ECRendererBase::~ECRendererBase()
 {
 }
 
+void ECRendererBase::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    applyLatched(inImg, outImg, numPixels, DynamicPropertySnapshot());
+}
+
+void ECRendererBase::getParams(const DynamicPropertySnapshot & snapshot,
+                               float & contrastVal, float & exposureVal) const
+{
+    unsigned versions[3];
+    const double exposure = snapshot.getDoubleValue(*m_exposure, versions[0]);
+    const double contrast = snapshot.getDoubleValue(*m_contrast, versions[1]);
+    const double gamma    = snapshot.getDoubleValue(*m_gamma, versions[2]);
+
+    float params[2];
+    if (!m_params.get(versions, params))
+    {
+        computeParams(exposure, contrast, gamma, params[0], params[1]);
+        m_params.set(versions, params);
+    }
+
+    contrastVal = params[0];
+    exposureVal = params[1];
+}
+
 bool ECRendererBase::hasDynamicProperty(DynamicPropertyType type) const
 {
     bool res = false;
@@ -108,16 +154,19 @@ DynamicPropertyRcPtr ECRendererBase::getDynamicProperty(DynamicPropertyType type
 class ECLinearRenderer : public ECRendererBase
 {
 public:
-    explicit ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECLinearRenderer::ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLinearRenderer::ECLinearRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -127,14 +176,20 @@ void ECLinearRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_pivot = (float)std::max(EC::MIN_PIVOT, ec->getPivot());
 }
 
-void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECLinearRenderer::computeParams(double exposure, double contrast, double gamma,
+                                     float & contrastVal, float & exposureVal) const
 {
     // TODO: allow negative contrast?
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, contrast * gamma);
+    exposureVal = powf(2.f, (float)exposure);
+}
+
+void ECLinearRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                    const DynamicPropertySnapshot & snapshot) const
+{
     // TODO: is it worth adding a code path without dynamic parameters?
-    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
-                                              m_contrast->getDoubleValue() *
-                                              m_gamma->getDoubleValue());
-    const float exposureVal = powf(2.f, (float)m_exposure->getDoubleValue());
+    float contrastVal = 1.f, exposureVal = 1.f;
+    getParams(snapshot, contrastVal, exposureVal);
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -178,7 +233,8 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
                         _mm_mul_ps(
                             data,
                             exposure_over_pivot),
-                        contrast),
+                        contrast,
+                        m_fastPower),
                     piv));
             out[3] = outAlpha;
 
@@ -194,12 +250,12 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
             // out = powf( i * exposure / iPivot, contrast ) * oPivot
             //
             // Note: With std::max NAN becomes 0.
-            out[0] = powf(std::max(0.0f, in[0] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[1] = powf(std::max(0.0f, in[1] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[2] = powf(std::max(0.0f, in[2] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
+            out[0] = Power(std::max(0.0f, in[0] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
+            out[1] = Power(std::max(0.0f, in[1] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
+            out[2] = Power(std::max(0.0f, in[2] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
             out[3] = in[3];
 
             in += 4;
@@ -212,16 +268,19 @@ void ECLinearRenderer::apply(const void * inImg, void * outImg, long numPixels)
 class ECLinearRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECLinearRevRenderer::ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLinearRevRenderer::ECLinearRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -231,13 +290,21 @@ void ECLinearRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_pivot = (float)std::max(EC::MIN_PIVOT, ec->getPivot());
 }
 
-void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECLinearRevRenderer::computeParams(double exposure, double contrast, double gamma,
+                                        float & contrastVal, float & exposureVal) const
 {
     // TODO: allow negative contrast?
-    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
-                                              (m_contrast->getDoubleValue() * m_gamma->getDoubleValue()));
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, contrast * gamma);
+    // Inverse of the exposure.
+    exposureVal = 1.f / powf(2.f, (float)exposure);
+}
+
+void ECLinearRevRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                       const DynamicPropertySnapshot & snapshot) const
+{
+    float contrastVal = 1.f, invExposureVal = 1.f;
+    getParams(snapshot, contrastVal, invExposureVal);
     const float invContrastVal = 1.f / contrastVal;
-    const float invExposureVal = 1.f / powf(2.f, (float)m_exposure->getDoubleValue());
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -283,7 +350,8 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
                         _mm_mul_ps(
                             data,
                             inv_pivot),
-                        inv_contrast),
+                        inv_contrast,
+                        m_fastPower),
                     pivot_over_exposure));
 
             out[3] = outAlpha;
@@ -300,12 +368,12 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
             //
             // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
             //
-            out[0] = powf(std::max(0.0f, in[0] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[1] = powf(std::max(0.0f, in[1] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[2] = powf(std::max(0.0f, in[2] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
+            out[0] = Power(std::max(0.0f, in[0] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
+            out[1] = Power(std::max(0.0f, in[1] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
+            out[2] = Power(std::max(0.0f, in[2] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
             out[3] = in[3];
 
             in += 4;
@@ -318,16 +386,19 @@ void ECLinearRevRenderer::apply(const void * inImg, void * outImg, long numPixel
 class ECVideoRenderer : public ECRendererBase
 {
 public:
-    explicit ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECVideoRenderer::ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECVideoRenderer::ECVideoRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -338,13 +409,19 @@ void ECVideoRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                    (float)EC::VIDEO_OETF_POWER);
 }
 
-void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECVideoRenderer::computeParams(double exposure, double contrast, double gamma,
+                                    float & contrastVal, float & exposureVal) const
 {
     // TODO: allow negative contrast?
-    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
-                                              (m_contrast->getDoubleValue() * m_gamma->getDoubleValue()));
-    const float exposureVal = powf(powf(2.f, (float)m_exposure->getDoubleValue()),
-                                   (float)EC::VIDEO_OETF_POWER);
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, contrast * gamma);
+    exposureVal = powf(powf(2.f, (float)exposure), (float)EC::VIDEO_OETF_POWER);
+}
+
+void ECVideoRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                   const DynamicPropertySnapshot & snapshot) const
+{
+    float contrastVal = 1.f, exposureVal = 1.f;
+    getParams(snapshot, contrastVal, exposureVal);
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -388,7 +465,8 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
                         _mm_mul_ps(
                             data,
                             exposure_over_pivot),
-                        contrast),
+                        contrast,
+                        m_fastPower),
                     piv));
             out[3] = outAlpha;
 
@@ -402,12 +480,12 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
             //
             // out = powf( i * exposure / pivot, contrast ) * pivot
             //
-            out[0] = powf(std::max(0.0f, in[0] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[1] = powf(std::max(0.0f, in[1] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
-            out[2] = powf(std::max(0.0f, in[2] * exposureOverPivotVal),
-                           contrastVal) * m_pivot;
+            out[0] = Power(std::max(0.0f, in[0] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
+            out[1] = Power(std::max(0.0f, in[1] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
+            out[2] = Power(std::max(0.0f, in[2] * exposureOverPivotVal),
+                            contrastVal, m_fastPower) * m_pivot;
             out[3] = in[3];
 
             in += 4;
@@ -420,16 +498,19 @@ void ECVideoRenderer::apply(const void * inImg, void * outImg, long numPixels) c
 class ECVideoRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECVideoRevRenderer::ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECVideoRevRenderer::ECVideoRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -440,14 +521,21 @@ void ECVideoRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                    (float)EC::VIDEO_OETF_POWER);
 }
 
-void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECVideoRevRenderer::computeParams(double exposure, double contrast, double gamma,
+                                       float & contrastVal, float & exposureVal) const
 {
     // TODO: allow negative contrast?
-    const float contrastVal = (float)std::max(EC::MIN_CONTRAST,
-                                              (m_contrast->getDoubleValue() * m_gamma->getDoubleValue()));
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, contrast * gamma);
+    // Inverse of the exposure.
+    exposureVal = 1.f / powf(powf(2.f, (float)exposure), (float)EC::VIDEO_OETF_POWER);
+}
+
+void ECVideoRevRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                      const DynamicPropertySnapshot & snapshot) const
+{
+    float contrastVal = 1.f, invExposureVal = 1.f;
+    getParams(snapshot, contrastVal, invExposureVal);
     const float invContrastVal = 1.f / contrastVal;
-    const float invExposureVal = 1.f / powf(powf(2.f, (float)m_exposure->getDoubleValue()),
-                                            (float)EC::VIDEO_OETF_POWER);
     const float pivotOverExposureVal = m_pivot * invExposureVal;
     const float invPivotVal = 1.f / m_pivot;
 
@@ -494,7 +582,8 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
                         _mm_mul_ps(
                             data,
                             inv_pivot),
-                        inv_contrast),
+                        inv_contrast,
+                        m_fastPower),
                     pivot_over_exposure));
             out[3] = outAlpha;
 
@@ -507,12 +596,12 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
             //
             // out = powf( i / pivot, 1 / contrast ) * pivot / exposure
             //
-            out[0] = powf(std::max(0.0f, in[0] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[1] = powf(std::max(0.0f, in[1] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
-            out[2] = powf(std::max(0.0f, in[2] * invPivotVal),
-                           invContrastVal) * pivotOverExposureVal;
+            out[0] = Power(std::max(0.0f, in[0] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
+            out[1] = Power(std::max(0.0f, in[1] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
+            out[2] = Power(std::max(0.0f, in[2] * invPivotVal),
+                            invContrastVal, m_fastPower) * pivotOverExposureVal;
             out[3] = in[3];
 
             in += 4;
@@ -525,16 +614,19 @@ void ECVideoRevRenderer::apply(const void * inImg, void * outImg, long numPixels
 class ECLogarithmicRenderer : public ECRendererBase
 {
 public:
-    explicit ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECLogarithmicRenderer::ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLogarithmicRenderer::ECLogarithmicRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -549,13 +641,18 @@ void ECLogarithmicRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
     m_logExposureStep = (float)ec->getLogExposureStep();
 }
 
-void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECLogarithmicRenderer::computeParams(double exposure, double contrast, double gamma,
+                                          float & contrastVal, float & exposureVal) const
+{
+    exposureVal = (float)exposure * m_logExposureStep;
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, contrast * gamma);
+}
+
+void ECLogarithmicRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                         const DynamicPropertySnapshot & snapshot) const
 {
-    const float exposureVal = (float)m_exposure->getDoubleValue() *
-                              m_logExposureStep;
-    const float contrastVal
-        = (float)std::max(EC::MIN_CONTRAST,
-                          (m_contrast->getDoubleValue() * m_gamma->getDoubleValue()));
+    float contrastVal = 1.f, exposureVal = 0.f;
+    getParams(snapshot, contrastVal, exposureVal);
     const float offsetVal = (exposureVal - m_pivot) * contrastVal + m_pivot;
 
     const float * in = (float *)inImg;
@@ -609,16 +706,19 @@ void ECLogarithmicRenderer::apply(const void * inImg, void * outImg, long numPix
 class ECLogarithmicRevRenderer : public ECRendererBase
 {
 public:
-    explicit ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec);
+    ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyLatched(const void * inImg, void * outImg, long numPixels,
+                      const DynamicPropertySnapshot & snapshot) const override;
 
 protected:
     void updateData(ConstExposureContrastOpDataRcPtr & ec) override;
+    void computeParams(double exposure, double contrast, double gamma,
+                       float & contrastVal, float & exposureVal) const override;
 };
 
-ECLogarithmicRevRenderer::ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec)
-    : ECRendererBase(ec)
+ECLogarithmicRevRenderer::ECLogarithmicRevRenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
+    : ECRendererBase(ec, fastPower)
 {
     updateData(ec);
 }
@@ -631,13 +731,19 @@ void ECLogarithmicRevRenderer::updateData(ConstExposureContrastOpDataRcPtr & ec)
                                   ec->getLogMidGray());
 }
 
-void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+void ECLogarithmicRevRenderer::computeParams(double exposure, double contrast, double gamma,
+                                             float & contrastVal, float & exposureVal) const
+{
+    exposureVal = (float)exposure * m_logExposureStep;
+    // Inverse of the contrast.
+    contrastVal = (float)std::max(EC::MIN_CONTRAST, 1. / (contrast * gamma));
+}
+
+void ECLogarithmicRevRenderer::applyLatched(const void * inImg, void * outImg, long numPixels,
+                                            const DynamicPropertySnapshot & snapshot) const
 {
-    const float exposureVal = (float)m_exposure->getDoubleValue() *
-                              m_logExposureStep;
-    const float inv_contrastVal
-        = (float)std::max(EC::MIN_CONTRAST,
-                          1. / (m_contrast->getDoubleValue() * m_gamma->getDoubleValue()));
+    float inv_contrastVal = 1.f, exposureVal = 0.f;
+    getParams(snapshot, inv_contrastVal, exposureVal);
     const float negOffsetVal = m_pivot - m_pivot * inv_contrastVal -
                                exposureVal;
 
@@ -661,22 +767,22 @@ void ECLogarithmicRevRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
-OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec)
+OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower)
 {
     switch (ec->getStyle())
     {
     case ExposureContrastOpData::STYLE_LINEAR:
-        return std::make_shared<ECLinearRenderer>(ec);
+        return std::make_shared<ECLinearRenderer>(ec, fastPower);
     case ExposureContrastOpData::STYLE_LINEAR_REV:
-        return std::make_shared<ECLinearRevRenderer>(ec);
+        return std::make_shared<ECLinearRevRenderer>(ec, fastPower);
     case ExposureContrastOpData::STYLE_VIDEO:
-        return std::make_shared<ECVideoRenderer>(ec);
+        return std::make_shared<ECVideoRenderer>(ec, fastPower);
     case ExposureContrastOpData::STYLE_VIDEO_REV:
-        return std::make_shared<ECVideoRevRenderer>(ec);
+        return std::make_shared<ECVideoRevRenderer>(ec, fastPower);
     case ExposureContrastOpData::STYLE_LOGARITHMIC:
-        return std::make_shared<ECLogarithmicRenderer>(ec);
+        return std::make_shared<ECLogarithmicRenderer>(ec, fastPower);
     case ExposureContrastOpData::STYLE_LOGARITHMIC_REV:
-        return std::make_shared<ECLogarithmicRevRenderer>(ec);
+        return std::make_shared<ECLogarithmicRevRenderer>(ec, fastPower);
     }
 
     throw Exception("Unknown exposure contrast style");
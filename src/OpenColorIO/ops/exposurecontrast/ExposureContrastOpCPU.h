@@ -12,7 +12,7 @@
 namespace OCIO_NAMESPACE
 {
 
-OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec);
+OpCPURcPtr GetExposureContrastCPURenderer(ConstExposureContrastOpDataRcPtr & ec, bool fastPower);
 
 } // namespace OCIO_NAMESPACE
 
@@ -43,7 +43,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -121,7 +121,7 @@ void FixedFunctionOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr FixedFunctionOp::getCPUOp() const
+ConstOpCPURcPtr FixedFunctionOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     ConstFixedFunctionOpDataRcPtr data = fnData();
     return GetFixedFunctionCPURenderer(data);
@@ -9,11 +9,27 @@
 
 #include "BitDepthUtils.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
+#include "ops/RendererAVX2.h"
+#include "Platform.h"
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+#ifdef USE_SSE
+
+namespace
+{
+
+template<typename Renderer>
+OCIO_TARGET_AVX2
+void ApplyAVX2(const Renderer & renderer, const float * in, float * out, long numPixels);
+
+} // anon.
+
+#endif
+
 class Renderer_ACES_RedMod03_Fwd : public OpCPU
 {
 public:
@@ -24,6 +40,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
+
 protected:
     float m_1minusScale;
     float m_pivot;
@@ -38,6 +67,19 @@ public:
     explicit Renderer_ACES_RedMod03_Inv(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_ACES_RedMod10_Fwd : public OpCPU
@@ -50,6 +92,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
+
 protected:
     float m_1minusScale;
     float m_pivot;
@@ -64,6 +119,19 @@ public:
     explicit Renderer_ACES_RedMod10_Inv(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_ACES_Glow03_Fwd : public OpCPU
@@ -74,6 +142,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
+
 protected:
     float m_glowGain, m_glowMid;
 
@@ -87,6 +168,19 @@ public:
                             float glowGain, float glowMid);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_ACES_DarkToDim10_Fwd : public OpCPU
@@ -99,6 +193,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
+
 protected:
     float m_gamma;
 };
@@ -113,6 +220,19 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
+
 protected:
     float m_gamma;
 };
@@ -126,6 +246,19 @@ public:
     explicit Renderer_RGB_TO_HSV(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_HSV_TO_RGB : public OpCPU
@@ -137,6 +270,19 @@ public:
     explicit Renderer_HSV_TO_RGB(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_XYZ_TO_xyY : public OpCPU
@@ -148,6 +294,19 @@ public:
     explicit Renderer_XYZ_TO_xyY(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_xyY_TO_XYZ : public OpCPU
@@ -159,6 +318,19 @@ public:
     explicit Renderer_xyY_TO_XYZ(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_XYZ_TO_uvY : public OpCPU
@@ -170,6 +342,19 @@ public:
     explicit Renderer_XYZ_TO_uvY(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_uvY_TO_XYZ : public OpCPU
@@ -181,6 +366,19 @@ public:
     explicit Renderer_uvY_TO_XYZ(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_XYZ_TO_LUV : public OpCPU
@@ -192,6 +390,19 @@ public:
     explicit Renderer_XYZ_TO_LUV(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 class Renderer_LUV_TO_XYZ : public OpCPU
@@ -203,12 +414,434 @@ public:
     explicit Renderer_LUV_TO_XYZ(ConstFixedFunctionOpDataRcPtr & data);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    // Reference implementation, used when SSE is not available.
+    void applyScalar(const float * in, float * out, long numPixels) const;
+
+#ifdef USE_SSE
+    // Process 4 pixels, each register holding one channel.
+    inline void applySSE(__m128 & red, __m128 & grn, __m128 & blu) const;
+    // Process 8 pixels, each register holding one channel.
+    OCIO_TARGET_AVX2 inline void applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const;
+    // Process the image 8 pixels at a time (refer to ApplyAVX2()).
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const
+    { ApplyAVX2(*this, in, out, numPixels); }
+#endif
 };
 
 
 ///////////////////////////////////////////////////////////////////////////////
 
 
+#ifdef USE_SSE
+
+namespace
+{
+
+// Apply the vectorized implementation of the renderer 4 pixels at a time. The remaining
+// pixels are padded to a full block so that the result of a pixel does not depend on its
+// position in the image.
+template<typename Renderer>
+void ApplySSE(const Renderer & renderer, const float * in, float * out, long numPixels)
+{
+    for (; numPixels >= 4; numPixels -= 4)
+    {
+        __m128 red, grn, blu, alpha;
+        sseLoadRGBA(in, red, grn, blu, alpha);
+
+        renderer.applySSE(red, grn, blu);
+
+        sseStoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 16;
+        out += 16;
+    }
+
+    if (numPixels > 0)
+    {
+        float tmp[16] = {};
+        std::copy(in, in + numPixels * 4, tmp);
+
+        __m128 red, grn, blu, alpha;
+        sseLoadRGBA(tmp, red, grn, blu, alpha);
+
+        renderer.applySSE(red, grn, blu);
+
+        sseStoreRGBA(tmp, red, grn, blu, alpha);
+
+        std::copy(tmp, tmp + numPixels * 4, out);
+    }
+}
+
+// Note: The std::min() & std::max() return their first argument when a NaN is involved
+// whereas _mm_min_ps() & _mm_max_ps() return their second argument, the argument order
+// below is therefore the reverse of the reference implementations.
+
+// Floor of the values.
+inline __m128 sseFloor(const __m128 x)
+{
+    // The float values with a magnitude of at least 2^23 are already integers.
+    const __m128 isInt = _mm_cmpge_ps(_mm_and_ps(x, EABS_MASK), _mm_set1_ps(8388608.f));
+
+    const __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+    const __m128 res = _mm_sub_ps(trunc, _mm_and_ps(_mm_cmpgt_ps(trunc, x), EONE));
+
+    return sseSelect(isInt, x, res);
+}
+
+// Same as (x == 0.f) ? 0.f : num / x.
+inline __m128 SafeDivide(const __m128 num, const __m128 x)
+{
+    return _mm_andnot_ps(_mm_cmpeq_ps(x, EZERO), _mm_div_ps(num, x));
+}
+
+// Arc tangent as accurate as atanf() i.e. the sseAtan() approximation is not accurate enough
+// for the hue window of the ACES RedMod styles. The argument reduction and the polynomial
+// come from the Cephes library.
+inline __m128 AccurateAtan(const __m128 x)
+{
+    const __m128 sign = _mm_and_ps(x, ESIGN_MASK);
+    const __m128 ax   = _mm_and_ps(x, EABS_MASK);
+
+    // Reduce the argument to [-tan(pi/8), tan(pi/8)].
+    const __m128 isBig = _mm_cmpgt_ps(ax, _mm_set1_ps(2.414213562373095f));
+    const __m128 isMid = _mm_andnot_ps(isBig, _mm_cmpgt_ps(ax, _mm_set1_ps(0.4142135623730950f)));
+
+    __m128 xr = sseSelect(isBig, _mm_div_ps(_mm_set1_ps(-1.f), ax), ax);
+    xr = sseSelect(isMid, _mm_div_ps(_mm_sub_ps(ax, EONE), _mm_add_ps(ax, EONE)), xr);
+
+    const __m128 y0 = _mm_or_ps(_mm_and_ps(isBig, E_PI_2),
+                                _mm_and_ps(isMid, _mm_set1_ps(0.78539816339744830962f)));
+
+    const __m128 z = _mm_mul_ps(xr, xr);
+    __m128 poly = _mm_set1_ps(8.05374449538e-2f);
+    poly = _mm_sub_ps(_mm_mul_ps(poly, z), _mm_set1_ps(1.38776856032e-1f));
+    poly = _mm_add_ps(_mm_mul_ps(poly, z), _mm_set1_ps(1.99777106478e-1f));
+    poly = _mm_sub_ps(_mm_mul_ps(poly, z), _mm_set1_ps(3.33329491539e-1f));
+    poly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(poly, z), xr), xr);
+
+    return _mm_or_ps(_mm_add_ps(y0, poly), sign);
+}
+
+// Refer to sseAtan2() for the quadrant adjustments.
+inline __m128 AccurateAtan2(const __m128 y, const __m128 x)
+{
+    __m128 res = AccurateAtan(_mm_div_ps(y, x));
+
+    // Fix for x=0 and y=0
+    const __m128 zero_mask = _mm_or_ps(_mm_cmpneq_ps(x, EZERO), _mm_cmpneq_ps(y, EZERO));
+    res = _mm_and_ps(res, zero_mask);
+
+    // Adjust quadrants 2 and 3 based on the sign of the arguments
+    const __m128 neg_x = isNegativeSpecial(x);
+    const __m128 sign_y = _mm_and_ps(y, ESIGN_MASK);
+
+    return _mm_add_ps(res, _mm_and_ps(_mm_or_ps(sign_y, E_PI), neg_x));
+}
+
+// Refer to the scalar CalcSatWeight().
+inline __m128 CalcSatWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                            const __m128 noiseLimit)
+{
+    const __m128 minVal = _mm_min_ps(_mm_min_ps(blu, grn), red);
+    const __m128 maxVal = _mm_max_ps(_mm_max_ps(blu, grn), red);
+
+    const __m128 lowLimit = _mm_set1_ps(1e-10f);
+
+    return _mm_div_ps(_mm_sub_ps(_mm_max_ps(maxVal, lowLimit), _mm_max_ps(minVal, lowLimit)),
+                      _mm_max_ps(maxVal, noiseLimit));
+}
+
+// Refer to the scalar CalcHueWeight(). The B-spline coefficients are selected with masks
+// and are all zero outside of the hue window.
+inline __m128 CalcHueWeight(const __m128 red, const __m128 grn, const __m128 blu,
+                            const __m128 inv_width)
+{
+    // Convert RGB to Yab (luma/chroma).
+    const __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.f), red), _mm_add_ps(grn, blu));
+    const __m128 b = _mm_mul_ps(_mm_set1_ps(1.7320508075688772f), _mm_sub_ps(grn, blu));
+
+    const __m128 hue = AccurateAtan2(b, a);
+
+    // Determine normalized input coords to B-spline.
+    const __m128 knot_coord = _mm_add_ps(_mm_mul_ps(hue, inv_width), _mm_set1_ps(2.f));
+    const __m128i j = _mm_cvttps_epi32(knot_coord);
+    const __m128 t = _mm_sub_ps(knot_coord, _mm_cvtepi32_ps(j));
+
+    const __m128 j0 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(0)));
+    const __m128 j1 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(1)));
+    const __m128 j2 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(2)));
+    const __m128 j3 = _mm_castsi128_ps(_mm_cmpeq_epi32(j, _mm_set1_epi32(3)));
+
+    // Same coefficients as the scalar version.
+    const __m128 coef0 = _mm_or_ps(_mm_or_ps(_mm_and_ps(j0, _mm_set1_ps( 0.25f)),
+                                             _mm_and_ps(j1, _mm_set1_ps(-0.75f))),
+                                   _mm_or_ps(_mm_and_ps(j2, _mm_set1_ps( 0.75f)),
+                                             _mm_and_ps(j3, _mm_set1_ps(-0.25f))));
+    const __m128 coef1 = _mm_or_ps(_mm_and_ps(j1, _mm_set1_ps( 0.75f)),
+                                   _mm_or_ps(_mm_and_ps(j2, _mm_set1_ps(-1.50f)),
+                                             _mm_and_ps(j3, _mm_set1_ps( 0.75f))));
+    const __m128 coef2 = _mm_or_ps(_mm_and_ps(j1, _mm_set1_ps( 0.75f)),
+                                   _mm_and_ps(j3, _mm_set1_ps(-0.75f)));
+    const __m128 coef3 = _mm_or_ps(_mm_and_ps(j1, _mm_set1_ps( 0.25f)),
+                                   _mm_or_ps(_mm_and_ps(j2, _mm_set1_ps( 1.00f)),
+                                             _mm_and_ps(j3, _mm_set1_ps( 0.25f))));
+
+    __m128 f_H = _mm_add_ps(coef1, _mm_mul_ps(t, coef0));
+    f_H = _mm_add_ps(coef2, _mm_mul_ps(t, f_H));
+    f_H = _mm_add_ps(coef3, _mm_mul_ps(t, f_H));
+
+    return f_H;
+}
+
+// Restore the hue after the change of the red channel (i.e. red being the largest channel
+// within the hue window).
+inline void RestoreHue(const __m128 red, const __m128 newRed, __m128 & grn, __m128 & blu)
+{
+    const __m128 grnIsMid = _mm_cmpge_ps(grn, blu); // red >= grn >= blu
+
+    const __m128 midChan = sseSelect(grnIsMid, grn, blu);
+    const __m128 minChan = sseSelect(grnIsMid, blu, grn);
+
+    const __m128 hue_fac = _mm_div_ps(_mm_sub_ps(midChan, minChan),
+                                      _mm_max_ps(_mm_sub_ps(red, minChan), _mm_set1_ps(1e-10f)));
+    const __m128 newMid = _mm_add_ps(_mm_mul_ps(hue_fac, _mm_sub_ps(newRed, minChan)), minChan);
+
+    grn = sseSelect(grnIsMid, newMid, grn);
+    blu = sseSelect(grnIsMid, blu, newMid);
+}
+
+// Refer to rgbToYC().
+inline __m128 rgbToYC(const __m128 red, const __m128 grn, const __m128 blu)
+{
+    const __m128 chroma = _mm_sqrt_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(blu, _mm_sub_ps(blu, grn)),
+                              _mm_mul_ps(grn, _mm_sub_ps(grn, red))),
+                   _mm_mul_ps(red, _mm_sub_ps(red, blu))));
+
+    const __m128 sum = _mm_add_ps(_mm_add_ps(blu, grn), red);
+    return _mm_div_ps(_mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(1.75f), chroma)), _mm_set1_ps(3.f));
+}
+
+// Refer to SigmoidShaper().
+inline __m128 SigmoidShaper(const __m128 sat)
+{
+    const __m128 x = _mm_mul_ps(_mm_sub_ps(sat, _mm_set1_ps(0.4f)), _mm_set1_ps(5.f));
+    const __m128 sign = _mm_or_ps(_mm_and_ps(x, ESIGN_MASK), EONE);
+    const __m128 t = _mm_max_ps(_mm_sub_ps(EONE, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), sign), x)),
+                                EZERO);
+    const __m128 s = _mm_add_ps(EONE, _mm_mul_ps(sign, _mm_sub_ps(EONE, _mm_mul_ps(t, t))));
+    return _mm_mul_ps(s, _mm_set1_ps(0.5f));
+}
+
+// The AVX2 versions of the helpers above. The constants are created locally instead of
+// using the SSE.h ones as a static initialization must not contain any AVX instructions.
+
+OCIO_TARGET_AVX2
+inline __m256 AccurateAtan(const __m256 x)
+{
+    const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    const __m256 one = _mm256_set1_ps(1.f);
+
+    const __m256 sign = _mm256_and_ps(x, signMask);
+    const __m256 ax   = _mm256_andnot_ps(signMask, x);
+
+    // Reduce the argument to [-tan(pi/8), tan(pi/8)].
+    const __m256 isBig = _mm256_cmp_ps(ax, _mm256_set1_ps(2.414213562373095f), _CMP_GT_OQ);
+    const __m256 isMid = _mm256_andnot_ps(isBig,
+                                          _mm256_cmp_ps(ax, _mm256_set1_ps(0.4142135623730950f), _CMP_GT_OQ));
+
+    __m256 xr = _mm256_blendv_ps(ax, _mm256_div_ps(_mm256_set1_ps(-1.f), ax), isBig);
+    xr = _mm256_blendv_ps(xr, _mm256_div_ps(_mm256_sub_ps(ax, one), _mm256_add_ps(ax, one)), isMid);
+
+    const __m256 y0 = _mm256_or_ps(_mm256_and_ps(isBig, _mm256_set1_ps(1.57079632679489661923f)),
+                                   _mm256_and_ps(isMid, _mm256_set1_ps(0.78539816339744830962f)));
+
+    const __m256 z = _mm256_mul_ps(xr, xr);
+    __m256 poly = _mm256_set1_ps(8.05374449538e-2f);
+    poly = _mm256_sub_ps(_mm256_mul_ps(poly, z), _mm256_set1_ps(1.38776856032e-1f));
+    poly = _mm256_add_ps(_mm256_mul_ps(poly, z), _mm256_set1_ps(1.99777106478e-1f));
+    poly = _mm256_sub_ps(_mm256_mul_ps(poly, z), _mm256_set1_ps(3.33329491539e-1f));
+    poly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(poly, z), xr), xr);
+
+    return _mm256_or_ps(_mm256_add_ps(y0, poly), sign);
+}
+
+OCIO_TARGET_AVX2
+inline __m256 AccurateAtan2(const __m256 y, const __m256 x)
+{
+    const __m256 zero = _mm256_setzero_ps();
+
+    __m256 res = AccurateAtan(_mm256_div_ps(y, x));
+
+    // Fix for x=0 and y=0
+    const __m256 zero_mask = _mm256_or_ps(_mm256_cmp_ps(x, zero, _CMP_NEQ_UQ),
+                                          _mm256_cmp_ps(y, zero, _CMP_NEQ_UQ));
+    res = _mm256_and_ps(res, zero_mask);
+
+    // Adjust quadrants 2 and 3 based on the sign of the arguments
+    const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    const __m256 neg_x = _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(x), 31));
+    const __m256 sign_y = _mm256_and_ps(y, signMask);
+
+    return _mm256_add_ps(res, _mm256_and_ps(_mm256_or_ps(sign_y, _mm256_set1_ps(3.14159265358979323846f)),
+                                            neg_x));
+}
+
+OCIO_TARGET_AVX2
+inline __m256 CalcSatWeight(const __m256 red, const __m256 grn, const __m256 blu,
+                            const __m256 noiseLimit)
+{
+    const __m256 minVal = _mm256_min_ps(_mm256_min_ps(blu, grn), red);
+    const __m256 maxVal = _mm256_max_ps(_mm256_max_ps(blu, grn), red);
+
+    const __m256 lowLimit = _mm256_set1_ps(1e-10f);
+
+    return _mm256_div_ps(_mm256_sub_ps(_mm256_max_ps(maxVal, lowLimit), _mm256_max_ps(minVal, lowLimit)),
+                         _mm256_max_ps(maxVal, noiseLimit));
+}
+
+OCIO_TARGET_AVX2
+inline __m256 CalcHueWeight(const __m256 red, const __m256 grn, const __m256 blu,
+                            const __m256 inv_width)
+{
+    // Convert RGB to Yab (luma/chroma).
+    const __m256 a = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.f), red), _mm256_add_ps(grn, blu));
+    const __m256 b = _mm256_mul_ps(_mm256_set1_ps(1.7320508075688772f), _mm256_sub_ps(grn, blu));
+
+    const __m256 hue = AccurateAtan2(b, a);
+
+    // Determine normalized input coords to B-spline.
+    const __m256 knot_coord = _mm256_add_ps(_mm256_mul_ps(hue, inv_width), _mm256_set1_ps(2.f));
+    const __m256i j = _mm256_cvttps_epi32(knot_coord);
+    const __m256 t = _mm256_sub_ps(knot_coord, _mm256_cvtepi32_ps(j));
+
+    const __m256 j0 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(0)));
+    const __m256 j1 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(1)));
+    const __m256 j2 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(2)));
+    const __m256 j3 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(j, _mm256_set1_epi32(3)));
+
+    const __m256 coef0 = _mm256_or_ps(_mm256_or_ps(_mm256_and_ps(j0, _mm256_set1_ps( 0.25f)),
+                                                   _mm256_and_ps(j1, _mm256_set1_ps(-0.75f))),
+                                      _mm256_or_ps(_mm256_and_ps(j2, _mm256_set1_ps( 0.75f)),
+                                                   _mm256_and_ps(j3, _mm256_set1_ps(-0.25f))));
+    const __m256 coef1 = _mm256_or_ps(_mm256_and_ps(j1, _mm256_set1_ps( 0.75f)),
+                                      _mm256_or_ps(_mm256_and_ps(j2, _mm256_set1_ps(-1.50f)),
+                                                   _mm256_and_ps(j3, _mm256_set1_ps( 0.75f))));
+    const __m256 coef2 = _mm256_or_ps(_mm256_and_ps(j1, _mm256_set1_ps( 0.75f)),
+                                      _mm256_and_ps(j3, _mm256_set1_ps(-0.75f)));
+    const __m256 coef3 = _mm256_or_ps(_mm256_and_ps(j1, _mm256_set1_ps( 0.25f)),
+                                      _mm256_or_ps(_mm256_and_ps(j2, _mm256_set1_ps( 1.00f)),
+                                                   _mm256_and_ps(j3, _mm256_set1_ps( 0.25f))));
+
+    __m256 f_H = _mm256_add_ps(coef1, _mm256_mul_ps(t, coef0));
+    f_H = _mm256_add_ps(coef2, _mm256_mul_ps(t, f_H));
+    f_H = _mm256_add_ps(coef3, _mm256_mul_ps(t, f_H));
+
+    return f_H;
+}
+
+OCIO_TARGET_AVX2
+inline void RestoreHue(const __m256 red, const __m256 newRed, __m256 & grn, __m256 & blu)
+{
+    const __m256 grnIsMid = _mm256_cmp_ps(grn, blu, _CMP_GE_OQ); // red >= grn >= blu
+
+    const __m256 midChan = _mm256_blendv_ps(blu, grn, grnIsMid);
+    const __m256 minChan = _mm256_blendv_ps(grn, blu, grnIsMid);
+
+    const __m256 hue_fac = _mm256_div_ps(_mm256_sub_ps(midChan, minChan),
+                                         _mm256_max_ps(_mm256_sub_ps(red, minChan), _mm256_set1_ps(1e-10f)));
+    const __m256 newMid = _mm256_add_ps(_mm256_mul_ps(hue_fac, _mm256_sub_ps(newRed, minChan)), minChan);
+
+    grn = _mm256_blendv_ps(grn, newMid, grnIsMid);
+    blu = _mm256_blendv_ps(newMid, blu, grnIsMid);
+}
+
+OCIO_TARGET_AVX2
+inline __m256 rgbToYC(const __m256 red, const __m256 grn, const __m256 blu)
+{
+    const __m256 chroma = _mm256_sqrt_ps(
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(blu, _mm256_sub_ps(blu, grn)),
+                                    _mm256_mul_ps(grn, _mm256_sub_ps(grn, red))),
+                      _mm256_mul_ps(red, _mm256_sub_ps(red, blu))));
+
+    const __m256 sum = _mm256_add_ps(_mm256_add_ps(blu, grn), red);
+    return _mm256_div_ps(_mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(1.75f), chroma)),
+                         _mm256_set1_ps(3.f));
+}
+
+OCIO_TARGET_AVX2
+inline __m256 SigmoidShaper(const __m256 sat)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    const __m256 x = _mm256_mul_ps(_mm256_sub_ps(sat, _mm256_set1_ps(0.4f)), _mm256_set1_ps(5.f));
+    const __m256 sign = _mm256_or_ps(_mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000))),
+                                     one);
+    const __m256 t = _mm256_max_ps(_mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(half, sign), x)),
+                                   _mm256_setzero_ps());
+    const __m256 s = _mm256_add_ps(one, _mm256_mul_ps(sign, _mm256_sub_ps(one, _mm256_mul_ps(t, t))));
+    return _mm256_mul_ps(s, half);
+}
+
+OCIO_TARGET_AVX2
+inline __m256 avx2Floor(const __m256 x)
+{
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256 isInt = _mm256_cmp_ps(_mm256_and_ps(x, absMask), _mm256_set1_ps(8388608.f), _CMP_GE_OQ);
+
+    const __m256 trunc = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(x));
+    const __m256 res = _mm256_sub_ps(trunc, _mm256_and_ps(_mm256_cmp_ps(trunc, x, _CMP_GT_OQ),
+                                                          _mm256_set1_ps(1.f)));
+
+    return _mm256_blendv_ps(res, x, isInt);
+}
+
+OCIO_TARGET_AVX2
+inline __m256 SafeDivide(const __m256 num, const __m256 x)
+{
+    return _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_div_ps(num, x));
+}
+
+// Apply the AVX2 implementation of the renderer 8 pixels at a time (refer to ApplySSE()).
+template<typename Renderer>
+OCIO_TARGET_AVX2
+void ApplyAVX2(const Renderer & renderer, const float * in, float * out, long numPixels)
+{
+    for (; numPixels >= 8; numPixels -= 8)
+    {
+        __m256 red, grn, blu, alpha;
+        avx2LoadRGBA(in, red, grn, blu, alpha);
+
+        renderer.applyAVX2(red, grn, blu);
+
+        avx2StoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Pad the remaining pixels to a full block (refer to ApplySSE()).
+    if (numPixels > 0)
+    {
+        float tmp[32] = {};
+        std::copy(in, in + numPixels * 4, tmp);
+
+        __m256 red, grn, blu, alpha;
+        avx2LoadRGBA(tmp, red, grn, blu, alpha);
+
+        renderer.applyAVX2(red, grn, blu);
+
+        avx2StoreRGBA(tmp, red, grn, blu, alpha);
+
+        std::copy(tmp, tmp + numPixels * 4, out);
+    }
+}
+
+} // anon.
+
+#endif
 
 
 // Calculate a saturation measure in a safe manner.
@@ -287,11 +920,8 @@ __inline float CalcHueWeight(const float red, const float grn, const float blu,
     return f_H;
 }
 
-void Renderer_ACES_RedMod03_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_RedMod03_Fwd::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         float red = in[0];
@@ -338,16 +968,69 @@ void Renderer_ACES_RedMod03_Fwd::apply(const void * inImg, void * outImg, long n
     }
 }
 
+void Renderer_ACES_RedMod03_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_RedMod03_Fwd::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 f_H = CalcHueWeight(red, grn, blu, _mm_set1_ps(m_inv_width));
+    const __m128 f_S = CalcSatWeight(red, grn, blu, _mm_set1_ps(m_noiseLimit));
+
+    const __m128 newRed = _mm_add_ps(red,
+                                     _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, f_S),
+                                                           _mm_sub_ps(_mm_set1_ps(m_pivot), red)),
+                                                _mm_set1_ps(m_1minusScale)));
+
+    __m128 newGrn = grn;
+    __m128 newBlu = blu;
+    RestoreHue(red, newRed, newGrn, newBlu);
+
+    // Hue is in range of the window, apply mod.
+    const __m128 inWindow = _mm_cmpgt_ps(f_H, EZERO);
+
+    red = sseSelect(inWindow, newRed, red);
+    grn = sseSelect(inWindow, newGrn, grn);
+    blu = sseSelect(inWindow, newBlu, blu);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_RedMod03_Fwd::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 f_H = CalcHueWeight(red, grn, blu, _mm256_set1_ps(m_inv_width));
+    const __m256 f_S = CalcSatWeight(red, grn, blu, _mm256_set1_ps(m_noiseLimit));
+
+    const __m256 newRed = _mm256_add_ps(red,
+                                        _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, f_S),
+                                                                    _mm256_sub_ps(_mm256_set1_ps(m_pivot), red)),
+                                                      _mm256_set1_ps(m_1minusScale)));
+
+    __m256 newGrn = grn;
+    __m256 newBlu = blu;
+    RestoreHue(red, newRed, newGrn, newBlu);
+
+    // Hue is in range of the window, apply mod.
+    const __m256 inWindow = _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+    red = _mm256_blendv_ps(red, newRed, inWindow);
+    grn = _mm256_blendv_ps(grn, newGrn, inWindow);
+    blu = _mm256_blendv_ps(blu, newBlu, inWindow);
+}
+#endif
+
 Renderer_ACES_RedMod03_Inv::Renderer_ACES_RedMod03_Inv(ConstFixedFunctionOpDataRcPtr & data)
     :   Renderer_ACES_RedMod03_Fwd(data)
 {
 }
 
-void Renderer_ACES_RedMod03_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_RedMod03_Inv::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         float red = in[0];
@@ -390,6 +1073,76 @@ void Renderer_ACES_RedMod03_Inv::apply(const void * inImg, void * outImg, long n
     }
 }
 
+void Renderer_ACES_RedMod03_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_RedMod03_Inv::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 f_H = CalcHueWeight(red, grn, blu, _mm_set1_ps(m_inv_width));
+
+    const __m128 scale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot = _mm_set1_ps(m_pivot);
+
+    const __m128 minChan = _mm_min_ps(grn, blu);
+
+    const __m128 a = _mm_sub_ps(_mm_mul_ps(f_H, scale), EONE);
+    const __m128 b = _mm_sub_ps(red, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(pivot, minChan)), scale));
+    const __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, pivot), minChan), scale);
+
+    const __m128 root = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(b, b),
+                                               _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), a), c)));
+    const __m128 newRed = _mm_div_ps(_mm_sub_ps(_mm_xor_ps(b, ESIGN_MASK), root),
+                                     _mm_mul_ps(_mm_set1_ps(2.f), a));
+
+    __m128 newGrn = grn;
+    __m128 newBlu = blu;
+    RestoreHue(red, newRed, newGrn, newBlu);
+
+    const __m128 inWindow = _mm_cmpgt_ps(f_H, EZERO);
+
+    red = sseSelect(inWindow, newRed, red);
+    grn = sseSelect(inWindow, newGrn, grn);
+    blu = sseSelect(inWindow, newBlu, blu);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_RedMod03_Inv::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 f_H = CalcHueWeight(red, grn, blu, _mm256_set1_ps(m_inv_width));
+
+    const __m256 scale = _mm256_set1_ps(m_1minusScale);
+    const __m256 pivot = _mm256_set1_ps(m_pivot);
+
+    const __m256 minChan = _mm256_min_ps(grn, blu);
+
+    const __m256 a = _mm256_sub_ps(_mm256_mul_ps(f_H, scale), _mm256_set1_ps(1.f));
+    const __m256 b = _mm256_sub_ps(red, _mm256_mul_ps(_mm256_mul_ps(f_H, _mm256_add_ps(pivot, minChan)), scale));
+    const __m256 c = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, pivot), minChan), scale);
+
+    const __m256 root = _mm256_sqrt_ps(_mm256_sub_ps(_mm256_mul_ps(b, b),
+                                                     _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), a), c)));
+    const __m256 newRed = _mm256_div_ps(_mm256_sub_ps(_mm256_xor_ps(b, _mm256_set1_ps(-0.f)), root),
+                                        _mm256_mul_ps(_mm256_set1_ps(2.f), a));
+
+    __m256 newGrn = grn;
+    __m256 newBlu = blu;
+    RestoreHue(red, newRed, newGrn, newBlu);
+
+    const __m256 inWindow = _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ);
+
+    red = _mm256_blendv_ps(red, newRed, inWindow);
+    grn = _mm256_blendv_ps(grn, newGrn, inWindow);
+    blu = _mm256_blendv_ps(blu, newBlu, inWindow);
+}
+#endif
+
 Renderer_ACES_RedMod10_Fwd::Renderer_ACES_RedMod10_Fwd(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {
@@ -403,11 +1156,8 @@ Renderer_ACES_RedMod10_Fwd::Renderer_ACES_RedMod10_Fwd(ConstFixedFunctionOpDataR
     m_inv_width = 1.6976527263135504f;
 }
 
-void Renderer_ACES_RedMod10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_RedMod10_Fwd::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         float red = in[0];
@@ -440,16 +1190,53 @@ void Renderer_ACES_RedMod10_Fwd::apply(const void * inImg, void * outImg, long n
     }
 }
 
+void Renderer_ACES_RedMod10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_RedMod10_Fwd::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 f_H = CalcHueWeight(red, grn, blu, _mm_set1_ps(m_inv_width));
+    const __m128 f_S = CalcSatWeight(red, grn, blu, _mm_set1_ps(m_noiseLimit));
+
+    const __m128 newRed = _mm_add_ps(red,
+                                     _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, f_S),
+                                                           _mm_sub_ps(_mm_set1_ps(m_pivot), red)),
+                                                _mm_set1_ps(m_1minusScale)));
+
+    // Hue is in range of the window, apply mod.
+    red = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, red);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_RedMod10_Fwd::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 f_H = CalcHueWeight(red, grn, blu, _mm256_set1_ps(m_inv_width));
+    const __m256 f_S = CalcSatWeight(red, grn, blu, _mm256_set1_ps(m_noiseLimit));
+
+    const __m256 newRed = _mm256_add_ps(red,
+                                        _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, f_S),
+                                                                    _mm256_sub_ps(_mm256_set1_ps(m_pivot), red)),
+                                                      _mm256_set1_ps(m_1minusScale)));
+
+    // Hue is in range of the window, apply mod.
+    red = _mm256_blendv_ps(red, newRed, _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+#endif
+
 Renderer_ACES_RedMod10_Inv::Renderer_ACES_RedMod10_Inv(ConstFixedFunctionOpDataRcPtr & data)
     :   Renderer_ACES_RedMod10_Fwd(data)
 {
 }
 
-void Renderer_ACES_RedMod10_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_RedMod10_Inv::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         float red = in[0];
@@ -465,7 +1252,6 @@ void Renderer_ACES_RedMod10_Inv::apply(const void * inImg, void * outImg, long n
             const float b = red - f_H * (m_pivot + minChan) * m_1minusScale;
             const float c = f_H * m_pivot * minChan * m_1minusScale;
 
-            // TODO: Replace sqrt with faster approx. (also in RedMod03 above).
             red = ( -b - sqrt( b * b - 4.f * a * c)) / ( 2.f * a);
         }
 
@@ -479,6 +1265,60 @@ void Renderer_ACES_RedMod10_Inv::apply(const void * inImg, void * outImg, long n
     }
 }
 
+void Renderer_ACES_RedMod10_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_RedMod10_Inv::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 f_H = CalcHueWeight(red, grn, blu, _mm_set1_ps(m_inv_width));
+
+    const __m128 scale = _mm_set1_ps(m_1minusScale);
+    const __m128 pivot = _mm_set1_ps(m_pivot);
+
+    const __m128 minChan = _mm_min_ps(grn, blu);
+
+    const __m128 a = _mm_sub_ps(_mm_mul_ps(f_H, scale), EONE);
+    const __m128 b = _mm_sub_ps(red, _mm_mul_ps(_mm_mul_ps(f_H, _mm_add_ps(pivot, minChan)), scale));
+    const __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(f_H, pivot), minChan), scale);
+
+    const __m128 root = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(b, b),
+                                               _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), a), c)));
+    const __m128 newRed = _mm_div_ps(_mm_sub_ps(_mm_xor_ps(b, ESIGN_MASK), root),
+                                     _mm_mul_ps(_mm_set1_ps(2.f), a));
+
+    red = sseSelect(_mm_cmpgt_ps(f_H, EZERO), newRed, red);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_RedMod10_Inv::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 f_H = CalcHueWeight(red, grn, blu, _mm256_set1_ps(m_inv_width));
+
+    const __m256 scale = _mm256_set1_ps(m_1minusScale);
+    const __m256 pivot = _mm256_set1_ps(m_pivot);
+
+    const __m256 minChan = _mm256_min_ps(grn, blu);
+
+    const __m256 a = _mm256_sub_ps(_mm256_mul_ps(f_H, scale), _mm256_set1_ps(1.f));
+    const __m256 b = _mm256_sub_ps(red, _mm256_mul_ps(_mm256_mul_ps(f_H, _mm256_add_ps(pivot, minChan)), scale));
+    const __m256 c = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(f_H, pivot), minChan), scale);
+
+    const __m256 root = _mm256_sqrt_ps(_mm256_sub_ps(_mm256_mul_ps(b, b),
+                                                     _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), a), c)));
+    const __m256 newRed = _mm256_div_ps(_mm256_sub_ps(_mm256_xor_ps(b, _mm256_set1_ps(-0.f)), root),
+                                        _mm256_mul_ps(_mm256_set1_ps(2.f), a));
+
+    red = _mm256_blendv_ps(red, newRed, _mm256_cmp_ps(f_H, _mm256_setzero_ps(), _CMP_GT_OQ));
+}
+#endif
+
 Renderer_ACES_Glow03_Fwd::Renderer_ACES_Glow03_Fwd(ConstFixedFunctionOpDataRcPtr & /*data*/,
                                                    float glowGain,
                                                    float glowMid)
@@ -506,11 +1346,8 @@ __inline float SigmoidShaper(const float sat)
     return s;
 }
 
-void Renderer_ACES_Glow03_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_Glow03_Fwd::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float red = in[0];
@@ -555,6 +1392,71 @@ void Renderer_ACES_Glow03_Fwd::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void Renderer_ACES_Glow03_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_Glow03_Fwd::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    // NB: YC is at inScale.
+    const __m128 YC = rgbToYC(red, grn, blu);
+
+    const __m128 sat = CalcSatWeight(red, grn, blu, _mm_set1_ps(m_noiseLimit));
+
+    const __m128 s = SigmoidShaper(sat);
+
+    const __m128 GlowGain = _mm_mul_ps(_mm_set1_ps(m_glowGain), s);
+    const __m128 GlowMid = _mm_set1_ps(m_glowMid);
+
+    // Apply FwdGlow, the conditions being evaluated in the reverse order of the scalar version.
+    __m128 glowGainOut = _mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(GlowMid, YC), _mm_set1_ps(0.5f)));
+    glowGainOut = sseSelect(_mm_cmple_ps(YC, _mm_set1_ps(m_glowMid * 2.f / 3.f)), GlowGain, glowGainOut);
+    glowGainOut = _mm_andnot_ps(_mm_cmpge_ps(YC, _mm_set1_ps(m_glowMid * 2.f)), glowGainOut);
+
+    // Calculate glow factor.
+    const __m128 addedGlow = _mm_add_ps(EONE, glowGainOut);
+
+    red = _mm_mul_ps(red, addedGlow);
+    grn = _mm_mul_ps(grn, addedGlow);
+    blu = _mm_mul_ps(blu, addedGlow);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_Glow03_Fwd::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    // NB: YC is at inScale.
+    const __m256 YC = rgbToYC(red, grn, blu);
+
+    const __m256 sat = CalcSatWeight(red, grn, blu, _mm256_set1_ps(m_noiseLimit));
+
+    const __m256 s = SigmoidShaper(sat);
+
+    const __m256 GlowGain = _mm256_mul_ps(_mm256_set1_ps(m_glowGain), s);
+    const __m256 GlowMid = _mm256_set1_ps(m_glowMid);
+
+    // Apply FwdGlow, the conditions being evaluated in the reverse order of the scalar version.
+    __m256 glowGainOut = _mm256_mul_ps(GlowGain, _mm256_sub_ps(_mm256_div_ps(GlowMid, YC),
+                                                               _mm256_set1_ps(0.5f)));
+    glowGainOut = _mm256_blendv_ps(glowGainOut, GlowGain,
+                                   _mm256_cmp_ps(YC, _mm256_set1_ps(m_glowMid * 2.f / 3.f), _CMP_LE_OQ));
+    glowGainOut = _mm256_andnot_ps(_mm256_cmp_ps(YC, _mm256_set1_ps(m_glowMid * 2.f), _CMP_GE_OQ),
+                                   glowGainOut);
+
+    // Calculate glow factor.
+    const __m256 addedGlow = _mm256_add_ps(_mm256_set1_ps(1.f), glowGainOut);
+
+    red = _mm256_mul_ps(red, addedGlow);
+    grn = _mm256_mul_ps(grn, addedGlow);
+    blu = _mm256_mul_ps(blu, addedGlow);
+}
+#endif
+
 Renderer_ACES_Glow03_Inv::Renderer_ACES_Glow03_Inv(ConstFixedFunctionOpDataRcPtr & data,
                                                    float glowGain,
                                                    float glowMid)
@@ -562,11 +1464,8 @@ Renderer_ACES_Glow03_Inv::Renderer_ACES_Glow03_Inv(ConstFixedFunctionOpDataRcPtr
 {
 }
 
-void Renderer_ACES_Glow03_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_Glow03_Inv::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float red = in[0];
@@ -611,6 +1510,89 @@ void Renderer_ACES_Glow03_Inv::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void Renderer_ACES_Glow03_Inv::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_Glow03_Inv::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    // NB: YC is at inScale.
+    const __m128 YC = rgbToYC(red, grn, blu);
+
+    const __m128 sat = CalcSatWeight(red, grn, blu, _mm_set1_ps(m_noiseLimit));
+
+    const __m128 s = SigmoidShaper(sat);
+
+    const __m128 GlowGain = _mm_mul_ps(_mm_set1_ps(m_glowGain), s);
+    const __m128 GlowMid = _mm_set1_ps(m_glowMid);
+    const __m128 onePlusGain = _mm_add_ps(EONE, GlowGain);
+
+    // Apply InvGlow, the conditions being evaluated in the reverse order of the scalar version.
+    __m128 glowGainOut
+        = _mm_div_ps(_mm_mul_ps(GlowGain, _mm_sub_ps(_mm_div_ps(GlowMid, YC), _mm_set1_ps(0.5f))),
+                     _mm_sub_ps(_mm_mul_ps(GlowGain, _mm_set1_ps(0.5f)), EONE));
+
+    const __m128 lowThreshold
+        = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(onePlusGain, GlowMid), _mm_set1_ps(2.f)), _mm_set1_ps(3.f));
+    glowGainOut = sseSelect(_mm_cmple_ps(YC, lowThreshold),
+                            _mm_div_ps(_mm_xor_ps(GlowGain, ESIGN_MASK), onePlusGain),
+                            glowGainOut);
+    glowGainOut = _mm_andnot_ps(_mm_cmpge_ps(YC, _mm_set1_ps(m_glowMid * 2.f)), glowGainOut);
+
+    // Calculate glow factor.
+    const __m128 reducedGlow = _mm_add_ps(EONE, glowGainOut);
+
+    red = _mm_mul_ps(red, reducedGlow);
+    grn = _mm_mul_ps(grn, reducedGlow);
+    blu = _mm_mul_ps(blu, reducedGlow);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_Glow03_Inv::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+
+    // NB: YC is at inScale.
+    const __m256 YC = rgbToYC(red, grn, blu);
+
+    const __m256 sat = CalcSatWeight(red, grn, blu, _mm256_set1_ps(m_noiseLimit));
+
+    const __m256 s = SigmoidShaper(sat);
+
+    const __m256 GlowGain = _mm256_mul_ps(_mm256_set1_ps(m_glowGain), s);
+    const __m256 GlowMid = _mm256_set1_ps(m_glowMid);
+    const __m256 onePlusGain = _mm256_add_ps(one, GlowGain);
+
+    // Apply InvGlow, the conditions being evaluated in the reverse order of the scalar version.
+    __m256 glowGainOut
+        = _mm256_div_ps(_mm256_mul_ps(GlowGain, _mm256_sub_ps(_mm256_div_ps(GlowMid, YC),
+                                                              _mm256_set1_ps(0.5f))),
+                        _mm256_sub_ps(_mm256_mul_ps(GlowGain, _mm256_set1_ps(0.5f)), one));
+
+    const __m256 lowThreshold
+        = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(onePlusGain, GlowMid), _mm256_set1_ps(2.f)),
+                        _mm256_set1_ps(3.f));
+    glowGainOut = _mm256_blendv_ps(glowGainOut,
+                                   _mm256_div_ps(_mm256_xor_ps(GlowGain, _mm256_set1_ps(-0.f)), onePlusGain),
+                                   _mm256_cmp_ps(YC, lowThreshold, _CMP_LE_OQ));
+    glowGainOut = _mm256_andnot_ps(_mm256_cmp_ps(YC, _mm256_set1_ps(m_glowMid * 2.f), _CMP_GE_OQ),
+                                   glowGainOut);
+
+    // Calculate glow factor.
+    const __m256 reducedGlow = _mm256_add_ps(one, glowGainOut);
+
+    red = _mm256_mul_ps(red, reducedGlow);
+    grn = _mm256_mul_ps(grn, reducedGlow);
+    blu = _mm256_mul_ps(blu, reducedGlow);
+}
+#endif
+
 Renderer_ACES_DarkToDim10_Fwd::Renderer_ACES_DarkToDim10_Fwd(ConstFixedFunctionOpDataRcPtr & /*data*/,
                                                              float gamma)
     :   OpCPU()
@@ -618,11 +1600,8 @@ Renderer_ACES_DarkToDim10_Fwd::Renderer_ACES_DarkToDim10_Fwd(ConstFixedFunctionO
     m_gamma = gamma - 1.f;  // compute Y^gamma / Y
 }
 
-void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_ACES_DarkToDim10_Fwd::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float red = in[0];
@@ -639,8 +1618,6 @@ void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, lon
                                             0.67408176581114831f  * grn + 
                                             0.053689517407937051f * blu ) );
 
-        // TODO: Currently our fast approx. requires SSE registers.
-        //       Either make this whole routine SSE or make fast scalar pow.
         const float Ypow_over_Y = powf(Y, m_gamma);
 
         out[0] = red * Ypow_over_Y;
@@ -653,6 +1630,49 @@ void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, lon
     }
 }
 
+void Renderer_ACES_DarkToDim10_Fwd::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_ACES_DarkToDim10_Fwd::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    // Calculate luminance assuming input is AP1 RGB.
+    const __m128 lum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.27222871678091454f),  red),
+                                             _mm_mul_ps(_mm_set1_ps(0.67408176581114831f),  grn)),
+                                  _mm_mul_ps(_mm_set1_ps(0.053689517407937051f), blu));
+    const __m128 Y = _mm_max_ps(lum, _mm_set1_ps(1e-10f));
+
+    // The fast approximation of the power function is not accurate enough.
+    const __m128 Ypow_over_Y = ssePowerAccurate(Y, _mm_set1_ps(m_gamma));
+
+    red = _mm_mul_ps(red, Ypow_over_Y);
+    grn = _mm_mul_ps(grn, Ypow_over_Y);
+    blu = _mm_mul_ps(blu, Ypow_over_Y);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_ACES_DarkToDim10_Fwd::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    // Calculate luminance assuming input is AP1 RGB.
+    const __m256 lum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(0.27222871678091454f),  red),
+                                                   _mm256_mul_ps(_mm256_set1_ps(0.67408176581114831f),  grn)),
+                                     _mm256_mul_ps(_mm256_set1_ps(0.053689517407937051f), blu));
+    const __m256 Y = _mm256_max_ps(lum, _mm256_set1_ps(1e-10f));
+
+    const __m256 Ypow_over_Y = avx2PowerAccurate(Y, _mm256_set1_ps(m_gamma));
+
+    red = _mm256_mul_ps(red, Ypow_over_Y);
+    grn = _mm256_mul_ps(grn, Ypow_over_Y);
+    blu = _mm256_mul_ps(blu, Ypow_over_Y);
+}
+#endif
+
 Renderer_REC2100_Surround::Renderer_REC2100_Surround(ConstFixedFunctionOpDataRcPtr & data)
     :   OpCPU()
 {
@@ -662,11 +1682,8 @@ Renderer_REC2100_Surround::Renderer_REC2100_Surround(ConstFixedFunctionOpDataRcP
     m_gamma = gamma - 1.f;  // compute Y^gamma / Y
 }
 
-void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_REC2100_Surround::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float red = in[0];
@@ -687,8 +1704,6 @@ void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long nu
                                             0.6780f * grn + 
                                             0.0593f * blu ) );
 
-        // TODO: Currently our fast approx. requires SSE registers.
-        //       Either make this whole routine SSE or make fast scalar pow.
         const float Ypow_over_Y = powf(Y, m_gamma);
 
         out[0] = red * Ypow_over_Y;
@@ -701,6 +1716,49 @@ void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long nu
     }
 }
 
+void Renderer_REC2100_Surround::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_REC2100_Surround::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    // Calculate luminance assuming input is Rec.2100 RGB.
+    const __m128 lum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.2627f), red),
+                                             _mm_mul_ps(_mm_set1_ps(0.6780f), grn)),
+                                  _mm_mul_ps(_mm_set1_ps(0.0593f), blu));
+    const __m128 Y = _mm_max_ps(lum, _mm_set1_ps(1e-4f));
+
+    // The fast approximation of the power function is not accurate enough.
+    const __m128 Ypow_over_Y = ssePowerAccurate(Y, _mm_set1_ps(m_gamma));
+
+    red = _mm_mul_ps(red, Ypow_over_Y);
+    grn = _mm_mul_ps(grn, Ypow_over_Y);
+    blu = _mm_mul_ps(blu, Ypow_over_Y);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_REC2100_Surround::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    // Calculate luminance assuming input is Rec.2100 RGB.
+    const __m256 lum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(0.2627f), red),
+                                                   _mm256_mul_ps(_mm256_set1_ps(0.6780f), grn)),
+                                     _mm256_mul_ps(_mm256_set1_ps(0.0593f), blu));
+    const __m256 Y = _mm256_max_ps(lum, _mm256_set1_ps(1e-4f));
+
+    const __m256 Ypow_over_Y = avx2PowerAccurate(Y, _mm256_set1_ps(m_gamma));
+
+    red = _mm256_mul_ps(red, Ypow_over_Y);
+    grn = _mm256_mul_ps(grn, Ypow_over_Y);
+    blu = _mm256_mul_ps(blu, Ypow_over_Y);
+}
+#endif
+
 Renderer_RGB_TO_HSV::Renderer_RGB_TO_HSV(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {
@@ -711,11 +1769,8 @@ Renderer_RGB_TO_HSV::Renderer_RGB_TO_HSV(ConstFixedFunctionOpDataRcPtr & /*data*
 // The H is [0,1] for all inputs, with 1 meaning 360 degrees.  For RGB on [0,1], the algorithm
 // is the classic HSV formula.
 
-void Renderer_RGB_TO_HSV::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_RGB_TO_HSV::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float red = in[0];
@@ -781,6 +1836,92 @@ void Renderer_RGB_TO_HSV::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_RGB_TO_HSV::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_RGB_TO_HSV::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 rgb_min = _mm_min_ps(blu, _mm_min_ps(grn, red));
+    const __m128 rgb_max = _mm_max_ps(blu, _mm_max_ps(grn, red));
+
+    const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+    // Sat
+    __m128 sat = SafeDivide(delta, rgb_max);
+
+    // Hue, the conditions being evaluated in the reverse order of the scalar version.
+    __m128 hue = _mm_add_ps(_mm_set1_ps(4.f), _mm_div_ps(_mm_sub_ps(red, grn), delta));
+    hue = sseSelect(_mm_cmpeq_ps(grn, rgb_max),
+                    _mm_add_ps(_mm_set1_ps(2.f), _mm_div_ps(_mm_sub_ps(blu, red), delta)),
+                    hue);
+    hue = sseSelect(_mm_cmpeq_ps(red, rgb_max), _mm_div_ps(_mm_sub_ps(grn, blu), delta), hue);
+    hue = sseSelect(_mm_cmplt_ps(hue, EZERO), _mm_add_ps(hue, _mm_set1_ps(6.f)), hue);
+    hue = _mm_mul_ps(hue, _mm_set1_ps(0.16666666666666666f));
+
+    const __m128 isChroma = _mm_cmpneq_ps(rgb_min, rgb_max);
+    sat = _mm_and_ps(isChroma, sat);
+    hue = _mm_and_ps(isChroma, hue);
+
+    // Handle extended range inputs.
+    const __m128 val = sseSelect(_mm_cmplt_ps(rgb_min, EZERO), _mm_add_ps(rgb_max, rgb_min), rgb_max);
+
+    const __m128 neg_min = _mm_xor_ps(rgb_min, ESIGN_MASK);
+    sat = sseSelect(_mm_cmpgt_ps(neg_min, rgb_max), _mm_div_ps(delta, neg_min), sat);
+
+    red = hue;
+    grn = sat;
+    blu = val;
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_RGB_TO_HSV::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 zero = _mm256_setzero_ps();
+
+    const __m256 rgb_min = _mm256_min_ps(blu, _mm256_min_ps(grn, red));
+    const __m256 rgb_max = _mm256_max_ps(blu, _mm256_max_ps(grn, red));
+
+    const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+
+    // Sat
+    __m256 sat = SafeDivide(delta, rgb_max);
+
+    // Hue, the conditions being evaluated in the reverse order of the scalar version.
+    __m256 hue = _mm256_add_ps(_mm256_set1_ps(4.f), _mm256_div_ps(_mm256_sub_ps(red, grn), delta));
+    hue = _mm256_blendv_ps(hue,
+                           _mm256_add_ps(_mm256_set1_ps(2.f), _mm256_div_ps(_mm256_sub_ps(blu, red), delta)),
+                           _mm256_cmp_ps(grn, rgb_max, _CMP_EQ_OQ));
+    hue = _mm256_blendv_ps(hue, _mm256_div_ps(_mm256_sub_ps(grn, blu), delta),
+                           _mm256_cmp_ps(red, rgb_max, _CMP_EQ_OQ));
+    hue = _mm256_blendv_ps(hue, _mm256_add_ps(hue, _mm256_set1_ps(6.f)),
+                           _mm256_cmp_ps(hue, zero, _CMP_LT_OQ));
+    hue = _mm256_mul_ps(hue, _mm256_set1_ps(0.16666666666666666f));
+
+    const __m256 isChroma = _mm256_cmp_ps(rgb_min, rgb_max, _CMP_NEQ_UQ);
+    sat = _mm256_and_ps(isChroma, sat);
+    hue = _mm256_and_ps(isChroma, hue);
+
+    // Handle extended range inputs.
+    const __m256 val = _mm256_blendv_ps(rgb_max, _mm256_add_ps(rgb_max, rgb_min),
+                                        _mm256_cmp_ps(rgb_min, zero, _CMP_LT_OQ));
+
+    const __m256 neg_min = _mm256_xor_ps(rgb_min, _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+    sat = _mm256_blendv_ps(sat, _mm256_div_ps(delta, neg_min),
+                           _mm256_cmp_ps(neg_min, rgb_max, _CMP_GT_OQ));
+
+    red = hue;
+    grn = sat;
+    blu = val;
+}
+#endif
+
 Renderer_HSV_TO_RGB::Renderer_HSV_TO_RGB(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
@@ -793,11 +1934,8 @@ Renderer_HSV_TO_RGB::Renderer_HSV_TO_RGB(ConstFixedFunctionOpDataRcPtr & /*data*
 // as S approaches 2.  Applications may want to design UIs to limit S even more than this
 // function does (e.g. 1.9) to avoid RGB results in the thousands.
 
-void Renderer_HSV_TO_RGB::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_HSV_TO_RGB::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long idx=0; idx<numPixels; ++idx)
     {
         constexpr const float MAX_SAT = 1.999f;
@@ -836,16 +1974,101 @@ void Renderer_HSV_TO_RGB::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_HSV_TO_RGB::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_HSV_TO_RGB::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 hue = _mm_mul_ps(_mm_sub_ps(red, sseFloor(red)), _mm_set1_ps(6.f));
+    const __m128 sat = _mm_min_ps(_mm_set1_ps(1.999f), _mm_max_ps(grn, EZERO));
+    const __m128 val = blu;
+
+    const __m128 two   = _mm_set1_ps(2.f);
+    const __m128 three = _mm_set1_ps(3.f);
+    const __m128 four  = _mm_set1_ps(4.f);
+
+    const __m128 r = _mm_sub_ps(_mm_and_ps(_mm_sub_ps(hue, three), EABS_MASK), EONE);
+    const __m128 g = _mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, two), EABS_MASK));
+    const __m128 b = _mm_sub_ps(two, _mm_and_ps(_mm_sub_ps(hue, four), EABS_MASK));
+
+    const __m128 oneMinusSat = _mm_sub_ps(EONE, sat);
+    const __m128 twoMinusSat = _mm_sub_ps(two, sat);
+
+    __m128 rgb_max = val;
+    __m128 rgb_min = _mm_mul_ps(val, oneMinusSat);
+
+    // Handle extended range inputs.
+    const __m128 satAbove1 = _mm_cmpgt_ps(sat, EONE);
+    rgb_min = sseSelect(satAbove1, _mm_div_ps(rgb_min, twoMinusSat), rgb_min);
+    rgb_max = sseSelect(satAbove1, _mm_sub_ps(val, rgb_min), rgb_max);
+
+    const __m128 valNeg = _mm_cmplt_ps(val, EZERO);
+    rgb_min = sseSelect(valNeg, _mm_div_ps(val, twoMinusSat), rgb_min);
+    rgb_max = sseSelect(valNeg, _mm_sub_ps(val, rgb_min), rgb_max);
+
+    const __m128 delta = _mm_sub_ps(rgb_max, rgb_min);
+
+    red = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(r, EZERO), EONE), delta), rgb_min);
+    grn = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(g, EZERO), EONE), delta), rgb_min);
+    blu = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(b, EZERO), EONE), delta), rgb_min);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_HSV_TO_RGB::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 zero  = _mm256_setzero_ps();
+    const __m256 one   = _mm256_set1_ps(1.f);
+    const __m256 two   = _mm256_set1_ps(2.f);
+    const __m256 three = _mm256_set1_ps(3.f);
+    const __m256 four  = _mm256_set1_ps(4.f);
+
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+    const __m256 hue = _mm256_mul_ps(_mm256_sub_ps(red, avx2Floor(red)), _mm256_set1_ps(6.f));
+    const __m256 sat = _mm256_min_ps(_mm256_set1_ps(1.999f), _mm256_max_ps(grn, zero));
+    const __m256 val = blu;
+
+    const __m256 r = _mm256_sub_ps(_mm256_and_ps(_mm256_sub_ps(hue, three), absMask), one);
+    const __m256 g = _mm256_sub_ps(two, _mm256_and_ps(_mm256_sub_ps(hue, two), absMask));
+    const __m256 b = _mm256_sub_ps(two, _mm256_and_ps(_mm256_sub_ps(hue, four), absMask));
+
+    const __m256 oneMinusSat = _mm256_sub_ps(one, sat);
+    const __m256 twoMinusSat = _mm256_sub_ps(two, sat);
+
+    __m256 rgb_max = val;
+    __m256 rgb_min = _mm256_mul_ps(val, oneMinusSat);
+
+    // Handle extended range inputs.
+    const __m256 satAbove1 = _mm256_cmp_ps(sat, one, _CMP_GT_OQ);
+    rgb_min = _mm256_blendv_ps(rgb_min, _mm256_div_ps(rgb_min, twoMinusSat), satAbove1);
+    rgb_max = _mm256_blendv_ps(rgb_max, _mm256_sub_ps(val, rgb_min), satAbove1);
+
+    const __m256 valNeg = _mm256_cmp_ps(val, zero, _CMP_LT_OQ);
+    rgb_min = _mm256_blendv_ps(rgb_min, _mm256_div_ps(val, twoMinusSat), valNeg);
+    rgb_max = _mm256_blendv_ps(rgb_max, _mm256_sub_ps(val, rgb_min), valNeg);
+
+    const __m256 delta = _mm256_sub_ps(rgb_max, rgb_min);
+
+    red = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(r, zero), one), delta), rgb_min);
+    grn = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(g, zero), one), delta), rgb_min);
+    blu = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(b, zero), one), delta), rgb_min);
+}
+#endif
+
 Renderer_XYZ_TO_xyY::Renderer_XYZ_TO_xyY(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_XYZ_TO_xyY::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_XYZ_TO_xyY::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float X = in[0];
@@ -867,16 +2090,43 @@ void Renderer_XYZ_TO_xyY::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_XYZ_TO_xyY::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_XYZ_TO_xyY::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 d = SafeDivide(EONE, _mm_add_ps(_mm_add_ps(red, grn), blu));
+
+    blu = grn;
+    red = _mm_mul_ps(red, d);
+    grn = _mm_mul_ps(grn, d);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_XYZ_TO_xyY::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 d = SafeDivide(_mm256_set1_ps(1.f), _mm256_add_ps(_mm256_add_ps(red, grn), blu));
+
+    blu = grn;
+    red = _mm256_mul_ps(red, d);
+    grn = _mm256_mul_ps(grn, d);
+}
+#endif
+
 Renderer_xyY_TO_XYZ::Renderer_xyY_TO_XYZ(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_xyY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_xyY_TO_XYZ::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         const float x = in[0];
@@ -897,16 +2147,52 @@ void Renderer_xyY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_xyY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_xyY_TO_XYZ::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 x = red;
+    const __m128 y = grn;
+    const __m128 Y = blu;
+
+    const __m128 d = SafeDivide(EONE, y);
+
+    red = _mm_mul_ps(_mm_mul_ps(Y, x), d);
+    grn = Y;
+    blu = _mm_mul_ps(_mm_mul_ps(Y, _mm_sub_ps(_mm_sub_ps(EONE, x), y)), d);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_xyY_TO_XYZ::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 x = red;
+    const __m256 y = grn;
+    const __m256 Y = blu;
+
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 d = SafeDivide(one, y);
+
+    red = _mm256_mul_ps(_mm256_mul_ps(Y, x), d);
+    grn = Y;
+    blu = _mm256_mul_ps(_mm256_mul_ps(Y, _mm256_sub_ps(_mm256_sub_ps(one, x), y)), d);
+}
+#endif
+
 Renderer_XYZ_TO_uvY::Renderer_XYZ_TO_uvY(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_XYZ_TO_uvY::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_XYZ_TO_uvY::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
@@ -930,16 +2216,54 @@ void Renderer_XYZ_TO_uvY::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_XYZ_TO_uvY::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_XYZ_TO_uvY::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 X = red;
+    const __m128 Y = grn;
+    const __m128 Z = blu;
+
+    const __m128 d = SafeDivide(EONE, _mm_add_ps(_mm_add_ps(X, _mm_mul_ps(_mm_set1_ps(15.f), Y)),
+                                                 _mm_mul_ps(_mm_set1_ps(3.f), Z)));
+
+    red = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), X), d);
+    grn = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f), Y), d);
+    blu = Y;
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_XYZ_TO_uvY::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 X = red;
+    const __m256 Y = grn;
+    const __m256 Z = blu;
+
+    const __m256 d = SafeDivide(_mm256_set1_ps(1.f),
+                                _mm256_add_ps(_mm256_add_ps(X, _mm256_mul_ps(_mm256_set1_ps(15.f), Y)),
+                                              _mm256_mul_ps(_mm256_set1_ps(3.f), Z)));
+
+    red = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), X), d);
+    grn = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f), Y), d);
+    blu = Y;
+}
+#endif
+
 Renderer_uvY_TO_XYZ::Renderer_uvY_TO_XYZ(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_uvY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_uvY_TO_XYZ::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
@@ -962,16 +2286,57 @@ void Renderer_uvY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_uvY_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_uvY_TO_XYZ::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 u = red;
+    const __m128 v = grn;
+    const __m128 Y = blu;
+
+    const __m128 d = SafeDivide(EONE, v);
+
+    red = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f / 4.f), Y), u), d);
+    grn = Y;
+    blu = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(3.f / 4.f), Y),
+                                _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(4.f), u),
+                                           _mm_mul_ps(_mm_set1_ps(6.666666666666667f), v))),
+                     d);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_uvY_TO_XYZ::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 u = red;
+    const __m256 v = grn;
+    const __m256 Y = blu;
+
+    const __m256 d = SafeDivide(_mm256_set1_ps(1.f), v);
+
+    red = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f / 4.f), Y), u), d);
+    grn = Y;
+    blu = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(3.f / 4.f), Y),
+                                      _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(4.f), u),
+                                                    _mm256_mul_ps(_mm256_set1_ps(6.666666666666667f), v))),
+                        d);
+}
+#endif
+
 Renderer_XYZ_TO_LUV::Renderer_XYZ_TO_LUV(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_XYZ_TO_LUV::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_XYZ_TO_LUV::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
@@ -1000,16 +2365,73 @@ void Renderer_XYZ_TO_LUV::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_XYZ_TO_LUV::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_XYZ_TO_LUV::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 X = red;
+    const __m128 Y = grn;
+    const __m128 Z = blu;
+
+    const __m128 d = SafeDivide(EONE, _mm_add_ps(_mm_add_ps(X, _mm_mul_ps(_mm_set1_ps(15.f), Y)),
+                                                 _mm_mul_ps(_mm_set1_ps(3.f), Z)));
+    const __m128 u = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.f), X), d);
+    const __m128 v = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f), Y), d);
+
+    const __m128 Lstar
+        = sseSelect(_mm_cmple_ps(Y, _mm_set1_ps(0.008856451679f)),
+                    _mm_mul_ps(_mm_set1_ps(9.0329629629629608f), Y),
+                    _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.16f), ssePowerAccurate(Y, _mm_set1_ps(0.333333333f))),
+                               _mm_set1_ps(0.16f)));
+    const __m128 Lstar13 = _mm_mul_ps(_mm_set1_ps(13.f), Lstar);
+
+    red = Lstar;
+    grn = _mm_mul_ps(Lstar13, _mm_sub_ps(u, _mm_set1_ps(0.19783001f)));   // D65 white
+    blu = _mm_mul_ps(Lstar13, _mm_sub_ps(v, _mm_set1_ps(0.46831999f)));   // D65 white
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_XYZ_TO_LUV::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 X = red;
+    const __m256 Y = grn;
+    const __m256 Z = blu;
+
+    const __m256 d = SafeDivide(_mm256_set1_ps(1.f),
+                                _mm256_add_ps(_mm256_add_ps(X, _mm256_mul_ps(_mm256_set1_ps(15.f), Y)),
+                                              _mm256_mul_ps(_mm256_set1_ps(3.f), Z)));
+    const __m256 u = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.f), X), d);
+    const __m256 v = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f), Y), d);
+
+    const __m256 Lstar
+        = _mm256_blendv_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(1.16f),
+                                                       avx2PowerAccurate(Y, _mm256_set1_ps(0.333333333f))),
+                                         _mm256_set1_ps(0.16f)),
+                           _mm256_mul_ps(_mm256_set1_ps(9.0329629629629608f), Y),
+                           _mm256_cmp_ps(Y, _mm256_set1_ps(0.008856451679f), _CMP_LE_OQ));
+    const __m256 Lstar13 = _mm256_mul_ps(_mm256_set1_ps(13.f), Lstar);
+
+    red = Lstar;
+    grn = _mm256_mul_ps(Lstar13, _mm256_sub_ps(u, _mm256_set1_ps(0.19783001f)));   // D65 white
+    blu = _mm256_mul_ps(Lstar13, _mm256_sub_ps(v, _mm256_set1_ps(0.46831999f)));   // D65 white
+}
+#endif
+
 Renderer_LUV_TO_XYZ::Renderer_LUV_TO_XYZ(ConstFixedFunctionOpDataRcPtr & /*data*/)
     :   OpCPU()
 {   
 }
 
-void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+void Renderer_LUV_TO_XYZ::applyScalar(const float * in, float * out, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for(long idx=0; idx<numPixels; ++idx)
     {
         // TODO: Check robustness for arbitrary float inputs.
@@ -1039,6 +2461,68 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixels) const
+{
+#ifdef USE_SSE
+    ApplySSE(*this, (const float *)inImg, (float *)outImg, numPixels);
+#else
+    applyScalar((const float *)inImg, (float *)outImg, numPixels);
+#endif
+}
+
+#ifdef USE_SSE
+inline void Renderer_LUV_TO_XYZ::applySSE(__m128 & red, __m128 & grn, __m128 & blu) const
+{
+    const __m128 Lstar = red;
+    const __m128 ustar = grn;
+    const __m128 vstar = blu;
+
+    const __m128 d = SafeDivide(_mm_set1_ps(0.076923076923076927f), Lstar);
+    const __m128 u = _mm_add_ps(_mm_mul_ps(ustar, d), _mm_set1_ps(0.19783001f));    // D65 white
+    const __m128 v = _mm_add_ps(_mm_mul_ps(vstar, d), _mm_set1_ps(0.46831999f));    // D65 white
+
+    const __m128 tmp = _mm_mul_ps(_mm_add_ps(Lstar, _mm_set1_ps(0.16f)), _mm_set1_ps(0.86206896551724144f));
+    const __m128 Y = sseSelect(_mm_cmple_ps(Lstar, _mm_set1_ps(0.08f)),
+                               _mm_mul_ps(_mm_set1_ps(0.11070564598794539f), Lstar),
+                               _mm_mul_ps(_mm_mul_ps(tmp, tmp), tmp));
+
+    const __m128 dd = SafeDivide(_mm_set1_ps(0.25f), v);
+
+    red = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(9.f), Y), u), dd);
+    grn = Y;
+    blu = _mm_mul_ps(_mm_mul_ps(Y, _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(12.f), _mm_mul_ps(_mm_set1_ps(3.f), u)),
+                                              _mm_mul_ps(_mm_set1_ps(20.f), v))),
+                     dd);
+}
+
+OCIO_TARGET_AVX2
+inline void Renderer_LUV_TO_XYZ::applyAVX2(__m256 & red, __m256 & grn, __m256 & blu) const
+{
+    const __m256 Lstar = red;
+    const __m256 ustar = grn;
+    const __m256 vstar = blu;
+
+    const __m256 d = SafeDivide(_mm256_set1_ps(0.076923076923076927f), Lstar);
+    const __m256 u = _mm256_add_ps(_mm256_mul_ps(ustar, d), _mm256_set1_ps(0.19783001f));    // D65 white
+    const __m256 v = _mm256_add_ps(_mm256_mul_ps(vstar, d), _mm256_set1_ps(0.46831999f));    // D65 white
+
+    const __m256 tmp = _mm256_mul_ps(_mm256_add_ps(Lstar, _mm256_set1_ps(0.16f)),
+                                     _mm256_set1_ps(0.86206896551724144f));
+    const __m256 Y = _mm256_blendv_ps(_mm256_mul_ps(_mm256_mul_ps(tmp, tmp), tmp),
+                                      _mm256_mul_ps(_mm256_set1_ps(0.11070564598794539f), Lstar),
+                                      _mm256_cmp_ps(Lstar, _mm256_set1_ps(0.08f), _CMP_LE_OQ));
+
+    const __m256 dd = SafeDivide(_mm256_set1_ps(0.25f), v);
+
+    red = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(9.f), Y), u), dd);
+    grn = Y;
+    blu = _mm256_mul_ps(_mm256_mul_ps(Y, _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(12.f),
+                                                                     _mm256_mul_ps(_mm256_set1_ps(3.f), u)),
+                                                       _mm256_mul_ps(_mm256_set1_ps(20.f), v))),
+                        dd);
+}
+#endif
+
 
 
 
@@ -1052,84 +2536,84 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
     {
         case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
         {
-            return std::make_shared<Renderer_ACES_RedMod03_Fwd>(func);
+            return CreateRenderer<Renderer_ACES_RedMod03_Fwd>(func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_03_INV:
         {
-            return std::make_shared<Renderer_ACES_RedMod03_Inv>(func);
+            return CreateRenderer<Renderer_ACES_RedMod03_Inv>(func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_RedMod10_Fwd>(func);
+            return CreateRenderer<Renderer_ACES_RedMod10_Fwd>(func);
         }
         case FixedFunctionOpData::ACES_RED_MOD_10_INV:
         {
-            return std::make_shared<Renderer_ACES_RedMod10_Inv>(func);
+            return CreateRenderer<Renderer_ACES_RedMod10_Inv>(func);
         }
         case FixedFunctionOpData::ACES_GLOW_03_FWD:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.075f, 0.1f);
+            return CreateRenderer<Renderer_ACES_Glow03_Fwd>(func, 0.075f, 0.1f);
         }        
         case FixedFunctionOpData::ACES_GLOW_03_INV:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.075f, 0.1f);
+            return CreateRenderer<Renderer_ACES_Glow03_Inv>(func, 0.075f, 0.1f);
         }        
         case FixedFunctionOpData::ACES_GLOW_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Fwd>(func, 0.05f, 0.08f);
+            return CreateRenderer<Renderer_ACES_Glow03_Fwd>(func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_GLOW_10_INV:
         {
-            return std::make_shared<Renderer_ACES_Glow03_Inv>(func, 0.05f, 0.08f);
+            return CreateRenderer<Renderer_ACES_Glow03_Inv>(func, 0.05f, 0.08f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
         {
-            return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 0.9811f);
+            return CreateRenderer<Renderer_ACES_DarkToDim10_Fwd>(func, 0.9811f);
         }
         case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
         {
-            return std::make_shared<Renderer_ACES_DarkToDim10_Fwd>(func, 1.0192640913260627f);
+            return CreateRenderer<Renderer_ACES_DarkToDim10_Fwd>(func, 1.0192640913260627f);
         }
         case FixedFunctionOpData::REC2100_SURROUND_FWD:
         case FixedFunctionOpData::REC2100_SURROUND_INV:
         {
-            return std::make_shared<Renderer_REC2100_Surround>(func);
+            return CreateRenderer<Renderer_REC2100_Surround>(func);
         }
 
         case FixedFunctionOpData::RGB_TO_HSV:
         {
-            return std::make_shared<Renderer_RGB_TO_HSV>(func);
+            return CreateRenderer<Renderer_RGB_TO_HSV>(func);
         }
         case FixedFunctionOpData::HSV_TO_RGB:
         {
-            return std::make_shared<Renderer_HSV_TO_RGB>(func);
+            return CreateRenderer<Renderer_HSV_TO_RGB>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_xyY:
         {
-            return std::make_shared<Renderer_XYZ_TO_xyY>(func);
+            return CreateRenderer<Renderer_XYZ_TO_xyY>(func);
         }
         case FixedFunctionOpData::xyY_TO_XYZ:
         {
-            return std::make_shared<Renderer_xyY_TO_XYZ>(func);
+            return CreateRenderer<Renderer_xyY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_uvY:
         {
-            return std::make_shared<Renderer_XYZ_TO_uvY>(func);
+            return CreateRenderer<Renderer_XYZ_TO_uvY>(func);
         }
         case FixedFunctionOpData::uvY_TO_XYZ:
         {
-            return std::make_shared<Renderer_uvY_TO_XYZ>(func);
+            return CreateRenderer<Renderer_uvY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_LUV:
         {
-            return std::make_shared<Renderer_XYZ_TO_LUV>(func);
+            return CreateRenderer<Renderer_XYZ_TO_LUV>(func);
         }
         case FixedFunctionOpData::LUV_TO_XYZ:
         {
-            return std::make_shared<Renderer_LUV_TO_XYZ>(func);
+            return CreateRenderer<Renderer_LUV_TO_XYZ>(func);
         }
     }
 
@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "MathUtils.h"
 #include "ops/gamma/GammaOpCPU.h"
 #include "ops/gamma/GammaOpUtils.h"
 
@@ -26,13 +27,16 @@ class GammaBasicOpCPU : public OpCPU
 public:
     GammaBasicOpCPU() = delete;
     GammaBasicOpCPU(const GammaBasicOpCPU &) = delete;
-    explicit GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma);
+    GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
 
+    // Use the fast approximation of the power function.
+    bool m_fastPower;
+
 private:
     float m_redGamma;
     float m_grnGamma;
@@ -43,19 +47,25 @@ private:
 class GammaMoncurveOpCPU : public OpCPU
 {
 protected:
-    explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &) : OpCPU() {}
+    GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &, bool fastPower)
+        :   OpCPU()
+        ,   m_fastPower(fastPower)
+    {}
 
 protected:
     RendererParams m_red;
     RendererParams m_green;
     RendererParams m_blue;
     RendererParams m_alpha;
+
+    // Use the fast approximation of the power function.
+    bool m_fastPower;
 };
 
 class GammaMoncurveOpCPUFwd : public GammaMoncurveOpCPU
 {
 public:
-    explicit GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
+    GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -66,7 +76,7 @@ protected:
 class GammaMoncurveOpCPURev : public GammaMoncurveOpCPU
 {
 public:
-    explicit GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma);
+    GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
@@ -76,26 +86,26 @@ protected:
 };
 
 
-ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma)
+ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower)
 {
     switch(gamma->getStyle())
     {
         case GammaOpData::MONCURVE_FWD:
         {
-            return std::make_shared<GammaMoncurveOpCPUFwd>(gamma);
+            return std::make_shared<GammaMoncurveOpCPUFwd>(gamma, fastPower);
             break;
         }
 
         case GammaOpData::MONCURVE_REV:
         {
-            return std::make_shared<GammaMoncurveOpCPURev>(gamma);
+            return std::make_shared<GammaMoncurveOpCPURev>(gamma, fastPower);
             break;
         }
 
         case GammaOpData::BASIC_FWD:
         case GammaOpData::BASIC_REV:
         {
-            return std::make_shared<GammaBasicOpCPU>(gamma);
+            return std::make_shared<GammaBasicOpCPU>(gamma, fastPower);
             break;
         }
     }
@@ -106,8 +116,9 @@ ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma)
 
 
 
-GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma)
+GammaBasicOpCPU::GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma, bool fastPower)
     :   OpCPU()
+    ,   m_fastPower(fastPower)
     ,   m_redGamma(0.0f)
     ,   m_grnGamma(0.0f)
     ,   m_bluGamma(0.0f)
@@ -155,7 +166,7 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        pixel = ssePower(pixel, gamma);
+        pixel = ssePower(pixel, gamma, m_fastPower);
 
         _mm_storeu_ps(out, pixel);
 
@@ -170,10 +181,10 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
                                  std::max(0.0f, in[2]),
                                  std::max(0.0f, in[3]) };
 
-        out[0] = powf(pixel[0], m_redGamma);
-        out[1] = powf(pixel[1], m_grnGamma);
-        out[2] = powf(pixel[2], m_bluGamma);
-        out[3] = powf(pixel[3], m_alpGamma);
+        out[0] = Power(pixel[0], m_redGamma, m_fastPower);
+        out[1] = Power(pixel[1], m_grnGamma, m_fastPower);
+        out[2] = Power(pixel[2], m_bluGamma, m_fastPower);
+        out[3] = Power(pixel[3], m_alpGamma, m_fastPower);
 
         in  += 4;
         out += 4;
@@ -181,8 +192,8 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
 #endif
 }
 
-GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
-    :   GammaMoncurveOpCPU(gamma)
+GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma, bool fastPower)
+    :   GammaMoncurveOpCPU(gamma, fastPower)
 {
     update(gamma);
 }
@@ -227,7 +238,7 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
 
         __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
 
-        data = ssePower(data, gamma);
+        data = ssePower(data, gamma, m_fastPower);
 
         __m128 flag = _mm_cmpgt_ps( pixel, breakPnt);
 
@@ -257,10 +268,10 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
     {
         const float pixel[4] = { in[0], in[1], in[2], in[3] };
 
-        const float data[4] = { powf(pixel[0] * red[0] + red[1], red[2]),
-                                powf(pixel[1] * grn[0] + grn[1], grn[2]),
-                                powf(pixel[2] * blu[0] + blu[1], blu[2]),
-                                powf(pixel[3] * alp[0] + alp[1], alp[2]) };
+        const float data[4] = { Power(pixel[0] * red[0] + red[1], red[2], m_fastPower),
+                                Power(pixel[1] * grn[0] + grn[1], grn[2], m_fastPower),
+                                Power(pixel[2] * blu[0] + blu[1], blu[2], m_fastPower),
+                                Power(pixel[3] * alp[0] + alp[1], alp[2], m_fastPower) };
 
         out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
         out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
@@ -273,8 +284,8 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
 #endif
 }
 
-GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
-    :   GammaMoncurveOpCPU(gamma)
+GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma, bool fastPower)
+    :   GammaMoncurveOpCPU(gamma, fastPower)
 {
     update(gamma);
 }
@@ -317,7 +328,7 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
     {
         __m128 pixel = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
-        __m128 data = ssePower(pixel, gamma);
+        __m128 data = ssePower(pixel, gamma, m_fastPower);
 
         data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
 
@@ -349,10 +360,10 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
     {
         const float pixel[4] = { in[0], in[1], in[2], in[3] };
 
-        const float data[4] = { powf(pixel[0], red[0]) * red[1] - red[2],
-                                powf(pixel[1], grn[0]) * grn[1] - grn[2],
-                                powf(pixel[2], blu[0]) * blu[1] - blu[2],
-                                powf(pixel[3], alp[0]) * alp[1] - alp[2] };
+        const float data[4] = { Power(pixel[0], red[0], m_fastPower) * red[1] - red[2],
+                                Power(pixel[1], grn[0], m_fastPower) * grn[1] - grn[2],
+                                Power(pixel[2], blu[0], m_fastPower) * blu[1] - blu[2],
+                                Power(pixel[3], alp[0], m_fastPower) * alp[1] - alp[2] };
 
         out[0] = pixel[0]<=red[3] ? pixel[0] * red[4] : data[0];
         out[1] = pixel[1]<=grn[3] ? pixel[1] * grn[4] : data[1];
@@ -14,8 +14,9 @@
 namespace OCIO_NAMESPACE
 {
 
-// Get the Gamma dedicated renderer.
-ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma);
+// Get the Gamma dedicated renderer. The SSE renderers use the fast approximation of the
+// power function when fastPower is true.
+ConstOpCPURcPtr GetGammaRenderer(ConstGammaOpDataRcPtr & gamma, bool fastPower);
 
 } // namespace OCIO_NAMESPACE
 
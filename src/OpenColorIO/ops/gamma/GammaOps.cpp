@@ -144,7 +144,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -233,10 +233,12 @@ void GammaOp::finalize(OptimizationFlags oFlags)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr GammaOp::getCPUOp() const
+ConstOpCPURcPtr GammaOp::getCPUOp(OptimizationFlags oFlags) const
 {
+    const bool fastLogExpPow
+        = (oFlags & OPTIMIZATION_FAST_LOG_EXP_POW) == OPTIMIZATION_FAST_LOG_EXP_POW;
     ConstGammaOpDataRcPtr data = gammaData();
-    return GetGammaRenderer(data);
+    return GetGammaRenderer(data, fastLogExpPow);
 }
 
 void GammaOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
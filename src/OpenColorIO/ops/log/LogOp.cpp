@@ -41,7 +41,7 @@ public:
     bool isInverse(ConstOpRcPtr & op) const override;
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -105,10 +105,12 @@ void LogOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr LogOp::getCPUOp() const
+ConstOpCPURcPtr LogOp::getCPUOp(OptimizationFlags oFlags) const
 {
+    const bool fastLogExpPow
+        = (oFlags & OPTIMIZATION_FAST_LOG_EXP_POW) == OPTIMIZATION_FAST_LOG_EXP_POW;
     ConstLogOpDataRcPtr data = logData();
-    return GetLogRenderer(data);
+    return GetLogRenderer(data, fastLogExpPow);
 }
 
 void LogOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
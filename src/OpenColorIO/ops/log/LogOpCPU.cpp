@@ -11,6 +11,7 @@
 #include "ops/log/LogOpCPU.h"
 #include "ops/log/LogUtils.h"
 #include "ops/OpTools.h"
+#include "ops/RendererAVX2.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -22,18 +23,53 @@ public:
     LogOpCPU() = delete;
     LogOpCPU(const LogOpCPU &) = delete;
 
-    explicit LogOpCPU(ConstLogOpDataRcPtr & log);
+    LogOpCPU(ConstLogOpDataRcPtr & log, bool fastLogExp);
 
 protected:
     // Update renderer parameters.
     virtual void updateData(ConstLogOpDataRcPtr & pL);
+
+    // Use the fast approximations of the log and exp functions.
+    bool m_fastLogExp = true;
+};
+
+// All the log renderers apply one of these two forms to the RGB channels, with per-channel
+// parameters:
+//
+//   lin to log: out = log2( max(minValue, in * scale + offset) ) * postScale + postOffset
+//   log to lin: out = ( exp2( (in + offset) * scale ) + postOffset ) * postScale
+//
+// The renderers of the simpler log ops use the neutral values for the unused parameters,
+// which do not change the results.
+template<bool linToLog>
+class LogKernelRenderer : public LogOpCPU
+{
+public:
+    LogKernelRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
+protected:
+    void setParams(const float (&scale)[3], const float (&offset)[3],
+                   const float (&postScale)[3], const float (&postOffset)[3]);
+
+    // The alpha values are not used.
+    float m_scale[4]      = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float m_offset[4]     = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float m_postScale[4]  = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float m_postOffset[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 };
 
 // Base class for LogToLin and LinToLog renderers.
-class L2LBaseRenderer : public LogOpCPU
+template<bool linToLog>
+class L2LBaseRenderer : public LogKernelRenderer<linToLog>
 {
 public:
-    explicit L2LBaseRenderer(ConstLogOpDataRcPtr & log);
+    L2LBaseRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp);
 
 protected:
     void updateData(ConstLogOpDataRcPtr & pL) override;
@@ -46,91 +82,77 @@ protected:
 };
 
 // Renderer for LogToLin operations.
-class Log2LinRenderer : public L2LBaseRenderer
+class Log2LinRenderer : public L2LBaseRenderer<false>
 {
 public:
-    explicit Log2LinRenderer(ConstLogOpDataRcPtr & log);
-
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
+    Log2LinRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp);
 };
 
 // Renderer for Lin2Log operations.
-class Lin2LogRenderer : public L2LBaseRenderer
+class Lin2LogRenderer : public L2LBaseRenderer<true>
 {
 public:
-    explicit Lin2LogRenderer(ConstLogOpDataRcPtr & log);
-
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
-
+    Lin2LogRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp);
 };
 
 // Renderer for Log10 and Log2 operations.
-class LogRenderer : public LogOpCPU
+class LogRenderer : public LogKernelRenderer<true>
 {
 public:
-    explicit LogRenderer(ConstLogOpDataRcPtr & log, float logScale);
-
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
-
-private:
-    float m_logScale;
+    LogRenderer(ConstLogOpDataRcPtr & log, float logScale, bool fastLogExp);
 };
 
 // Renderer for AntiLog10 and AntiLog2 operations.
-class AntiLogRenderer : public LogOpCPU
+class AntiLogRenderer : public LogKernelRenderer<false>
 {
 public:
-    explicit AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base);
-
-    void apply(const void * inImg, void * outImg, long numPixels) const override;
-
-private:
-    float m_log2_base;
+    AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base, bool fastLogExp);
 };
 
 static constexpr float LOG2_10 = ((float) 3.3219280948873623478703194294894);
 static constexpr float LOG10_2 = ((float) 0.3010299956639811952137388947245);
 
-ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log)
+ConstOpCPURcPtr GetLogRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp)
 {
     const TransformDirection dir = log->getDirection();
     if (log->isLog2())
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
-            return std::make_shared<LogRenderer>(log, 1.0f);
+            return CreateRenderer<LogRenderer>(log, 1.0f, fastLogExp);
         }
         else
         {
-            return std::make_shared<AntiLogRenderer>(log, 1.0f);
+            return CreateRenderer<AntiLogRenderer>(log, 1.0f, fastLogExp);
         }
     }
     else if (log->isLog10())
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
-            return std::make_shared<LogRenderer>(log, LOG10_2);
+            return CreateRenderer<LogRenderer>(log, LOG10_2, fastLogExp);
         }
         else
         {
-            return std::make_shared<AntiLogRenderer>(log, LOG2_10);
+            return CreateRenderer<AntiLogRenderer>(log, LOG2_10, fastLogExp);
         }
     }
     else
     {
         if (dir == TRANSFORM_DIR_FORWARD)
         {
-            return std::make_shared<Lin2LogRenderer>(log);
+            return CreateRenderer<Lin2LogRenderer>(log, fastLogExp);
         }
         else
         {
-            return std::make_shared<Log2LinRenderer>(log);
+            return CreateRenderer<Log2LinRenderer>(log, fastLogExp);
         }
     }
 }
 
-LogOpCPU::LogOpCPU(ConstLogOpDataRcPtr & log)
+LogOpCPU::LogOpCPU(ConstLogOpDataRcPtr & log, bool fastLogExp)
     : OpCPU()
+    , m_fastLogExp(fastLogExp)
 {
 }
 
@@ -138,97 +160,59 @@ void LogOpCPU::updateData(ConstLogOpDataRcPtr & pL)
 {
 }
 
-
-L2LBaseRenderer::L2LBaseRenderer(ConstLogOpDataRcPtr & log)
-    : LogOpCPU(log)
+template<bool linToLog>
+LogKernelRenderer<linToLog>::LogKernelRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp)
+    : LogOpCPU(log, fastLogExp)
 {
 }
 
-void L2LBaseRenderer::updateData(ConstLogOpDataRcPtr & pL)
+template<bool linToLog>
+void LogKernelRenderer<linToLog>::setParams(const float (&scale)[3],
+                                            const float (&offset)[3],
+                                            const float (&postScale)[3],
+                                            const float (&postOffset)[3])
 {
-    LogOpCPU::updateData(pL);
-
-    m_base = (float)pL->getBase();
-    m_paramsR = pL->getRedParams();
-    m_paramsG = pL->getGreenParams();
-    m_paramsB = pL->getBlueParams();
-}
-
-LogRenderer::LogRenderer(ConstLogOpDataRcPtr & log, float logScale)
-    : LogOpCPU(log)
-    , m_logScale(logScale)
-{
-    LogOpCPU::updateData(log);
-}
-
-
-#ifndef USE_SSE
-
-inline void ApplyScale(float * pix, const float scale)
-{
-    pix[0] = pix[0] * scale;
-    pix[1] = pix[1] * scale;
-    pix[2] = pix[2] * scale;
-}
-
-inline void ApplyScale(float * pix, const float * scale)
-{
-    pix[0] = pix[0] * scale[0];
-    pix[1] = pix[1] * scale[1];
-    pix[2] = pix[2] * scale[2];
-}
-
-inline void ApplyAdd(float * pix, const float * add)
-{
-    pix[0] = pix[0] + add[0];
-    pix[1] = pix[1] + add[1];
-    pix[2] = pix[2] + add[2];
-}
-
-inline void ApplyMax(float * pix, float minValue)
-{
-    pix[0] = std::max(minValue, pix[0]);
-    pix[1] = std::max(minValue, pix[1]);
-    pix[2] = std::max(minValue, pix[2]);
-}
-
-inline void ApplyLog2(float * pix)
-{
-    pix[0] = log2(pix[0]);
-    pix[1] = log2(pix[1]);
-    pix[2] = log2(pix[2]);
-}
-
-inline void ApplyExp2(float * pix)
-{
-    pix[0] = exp2(pix[0]);
-    pix[1] = exp2(pix[1]);
-    pix[2] = exp2(pix[2]);
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        m_scale[idx]      = scale[idx];
+        m_offset[idx]     = offset[idx];
+        m_postScale[idx]  = postScale[idx];
+        m_postOffset[idx] = postOffset[idx];
+    }
 }
-#endif
 
-void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+template<bool linToLog>
+void LogKernelRenderer<linToLog>::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    //
-    // out = log2( max(in, minValue) ) * logScale;
-    //
     const float minValue = std::numeric_limits<float>::min();
 
     const float * in = (const float *)inImg;
     float * out = (float *)outImg;
 
 #ifdef USE_SSE
-    const __m128 mm_minValue = _mm_set1_ps(minValue);
-    const __m128 mm_logScale = _mm_set1_ps(m_logScale);
+    const __m128 mm_minValue   = _mm_set1_ps(minValue);
+    const __m128 mm_scale      = _mm_loadu_ps(m_scale);
+    const __m128 mm_offset     = _mm_loadu_ps(m_offset);
+    const __m128 mm_postScale  = _mm_loadu_ps(m_postScale);
+    const __m128 mm_postOffset = _mm_loadu_ps(m_postOffset);
 
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (long idx = 0; idx < numPixels; ++idx)
     {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_logScale);
+        __m128 mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
+
+        if (linToLog)
+        {
+            mm_pixel = _mm_add_ps(_mm_mul_ps(mm_pixel, mm_scale), mm_offset);
+            mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+            mm_pixel = sseLog2(mm_pixel, m_fastLogExp);
+            mm_pixel = _mm_add_ps(_mm_mul_ps(mm_pixel, mm_postScale), mm_postOffset);
+        }
+        else
+        {
+            mm_pixel = _mm_mul_ps(_mm_add_ps(mm_pixel, mm_offset), mm_scale);
+            mm_pixel = sseExp2(mm_pixel, m_fastLogExp);
+            mm_pixel = _mm_mul_ps(_mm_add_ps(mm_pixel, mm_postOffset), mm_postScale);
+        }
 
         const float alphares = in[3];
 
@@ -239,16 +223,24 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
         out += 4;
     }
 #else
-    for (long idx = 0; idx<numPixels; ++idx)
+    for (long idx = 0; idx < numPixels; ++idx)
     {
-        const float alphares = in[3];
-
         // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        memcpy(out, in, 4 * sizeof(float));
+        const float alphares = in[3];
 
-        ApplyMax(out, minValue);
-        ApplyLog2(out);
-        ApplyScale(out, m_logScale);
+        for (int c = 0; c < 3; ++c)
+        {
+            if (linToLog)
+            {
+                const float val = std::max(minValue, in[c] * m_scale[c] + m_offset[c]);
+                out[c] = Log2(val, m_fastLogExp) * m_postScale[c] + m_postOffset[c];
+            }
+            else
+            {
+                const float val = Exp2((in[c] + m_offset[c]) * m_scale[c], m_fastLogExp);
+                out[c] = (val + m_postOffset[c]) * m_postScale[c];
+            }
+        }
 
         out[3] = alphares;
 
@@ -258,73 +250,107 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 #endif
 }
 
-// Renderer for AntiLog10 and AntiLog2 operations
-AntiLogRenderer::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base)
-    : LogOpCPU(log)
-    , m_log2_base(log2base)
-{
-    LogOpCPU::updateData(log);
-}
+#ifdef USE_SSE
 
-void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+// Process two pixels per iteration (i.e. eight values), the computations being the same as
+// the SSE ones.
+template<bool linToLog>
+OCIO_TARGET_AVX2
+void LogKernelRenderer<linToLog>::applyAVX2(const float * in, float * out, long numPixels) const
 {
-    //
-    // out = pow(base, in);
-    //
-    // This computation is decomposed into:
-    //   out = exp2( log2(base) * in);
-    //   so that the constant factor log2(base) can be moved outside the loop.
-    //
+    const __m256 minValue   = _mm256_set1_ps(std::numeric_limits<float>::min());
+    const __m256 scale      = _mm256_broadcast_ps((const __m128 *)m_scale);
+    const __m256 offset     = _mm256_broadcast_ps((const __m128 *)m_offset);
+    const __m256 postScale  = _mm256_broadcast_ps((const __m128 *)m_postScale);
+    const __m256 postOffset = _mm256_broadcast_ps((const __m128 *)m_postOffset);
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pixels = _mm256_loadu_ps(in);
 
-#ifdef USE_SSE
-    const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
+        __m256 res;
+        if (linToLog)
+        {
+            res = _mm256_add_ps(_mm256_mul_ps(pixels, scale), offset);
+            res = _mm256_max_ps(res, minValue);
+            res = avx2Log2(res, m_fastLogExp);
+            res = _mm256_add_ps(_mm256_mul_ps(res, postScale), postOffset);
+        }
+        else
+        {
+            res = _mm256_mul_ps(_mm256_add_ps(pixels, offset), scale);
+            res = avx2Exp2(res, m_fastLogExp);
+            res = _mm256_mul_ps(_mm256_add_ps(res, postOffset), postScale);
+        }
 
-    __m128 mm_pixel;
+        // Keep the alpha values.
+        _mm256_storeu_ps(out, _mm256_blend_ps(res, pixels, 0x88));
 
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+        in  += 8;
+        out += 8;
+    }
 
-        const float alphares = in[3];
+    LogKernelRenderer<linToLog>::apply(in, out, numPixels);
+}
 
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
+#endif
 
-        in  += 4;
-        out += 4;
-    }
-#else
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
+template<bool linToLog>
+L2LBaseRenderer<linToLog>::L2LBaseRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp)
+    : LogKernelRenderer<linToLog>(log, fastLogExp)
+{
+}
 
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        memcpy(out, in, 4 * sizeof(float));
+template<bool linToLog>
+void L2LBaseRenderer<linToLog>::updateData(ConstLogOpDataRcPtr & pL)
+{
+    LogOpCPU::updateData(pL);
 
-        ApplyScale(out, m_log2_base);
-        ApplyExp2(out);
+    m_base = (float)pL->getBase();
+    m_paramsR = pL->getRedParams();
+    m_paramsG = pL->getGreenParams();
+    m_paramsB = pL->getBlueParams();
+}
 
-        out[3] = alphares;
+LogRenderer::LogRenderer(ConstLogOpDataRcPtr & log, float logScale, bool fastLogExp)
+    : LogKernelRenderer<true>(log, fastLogExp)
+{
+    LogOpCPU::updateData(log);
 
-        in  += 4;
-        out += 4;
-    }
-#endif
+    //
+    // out = log2( max(in, minValue) ) * logScale;
+    //
+    setParams({ 1.0f, 1.0f, 1.0f },
+              { 0.0f, 0.0f, 0.0f },
+              { logScale, logScale, logScale },
+              { 0.0f, 0.0f, 0.0f });
 }
 
-// Renderer for LogToLin operations
-Log2LinRenderer::Log2LinRenderer(ConstLogOpDataRcPtr & log)
-    : L2LBaseRenderer(log)
+// Renderer for AntiLog10 and AntiLog2 operations
+AntiLogRenderer::AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base, bool fastLogExp)
+    : LogKernelRenderer<false>(log, fastLogExp)
 {
-    updateData(log);
+    LogOpCPU::updateData(log);
+
+    //
+    // out = pow(base, in);
+    //
+    // This computation is decomposed into:
+    //   out = exp2( log2(base) * in);
+    //   so that the constant factor log2(base) can be moved outside the loop.
+    //
+    setParams({ log2base, log2base, log2base },
+              { 0.0f, 0.0f, 0.0f },
+              { 1.0f, 1.0f, 1.0f },
+              { 0.0f, 0.0f, 0.0f });
 }
 
-void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+// Renderer for LogToLin operations
+Log2LinRenderer::Log2LinRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp)
+    : L2LBaseRenderer<false>(log, fastLogExp)
 {
+    updateData(log);
+
     //
     // out = ( pow( base, (in - logOffset) / logSlope ) - linOffset ) / linSlope;
     //
@@ -351,75 +377,19 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         1.0f / (float)m_paramsG[LIN_SIDE_SLOPE],
         1.0f / (float)m_paramsB[LIN_SIDE_SLOPE] };
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-#ifdef USE_SSE
-    const __m128 mm_kinv = _mm_set_ps(
-        0.0f, kinv[2], kinv[1], kinv[0]);
-    const __m128 mm_minuskb = _mm_set_ps(
-        0.0f, minuskb[2], minuskb[1], minuskb[0]);
-    const __m128 mm_minusb = _mm_set_ps(
-        0.0f, minusb[2], minusb[1], minusb[0]);
-    const __m128 mm_minv = _mm_set_ps(
-        0.0f, minv[2], minv[1], minv[0]);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx < numPixels; ++idx)
-    {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
-        mm_pixel = sseExp2(mm_pixel);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
-
-        const float alphares = in[3];
-
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
-#else
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        // NB: 'in' and 'out' could be pointers to the same memory buffer.
-        memcpy(out, in, 4 * sizeof(float));
-
-        ApplyAdd(out, minuskb);
-        ApplyScale(out, kinv);
-        ApplyExp2(out);
-        ApplyAdd(out, minusb);
-        ApplyScale(out, minv);
-
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
-#endif
+    setParams(kinv, minuskb, minv, minusb);
 }
 
 // Renderer for Lin2Log operations
-Lin2LogRenderer::Lin2LogRenderer(ConstLogOpDataRcPtr & log)
-    : L2LBaseRenderer(log)
+Lin2LogRenderer::Lin2LogRenderer(ConstLogOpDataRcPtr & log, bool fastLogExp)
+    : L2LBaseRenderer<true>(log, fastLogExp)
 {
     updateData(log);
-}
 
-void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
-{
     // out = ( logSlope * log( base, max( minValue, (in*linSlope + linOffset) ) ) + logOffset )
     //
     // out = log2( max( minValue, (in*linSlope + linOffset) ) ) * logSlope / log2(base) + logOffset
     //
-    const float minValue = std::numeric_limits<float>::min();
-
     const float m[] = {
         (float)m_paramsR[LIN_SIDE_SLOPE],
         (float)m_paramsG[LIN_SIDE_SLOPE],
@@ -437,65 +407,7 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
         (float)m_paramsG[LOG_SIDE_OFFSET],
         (float)m_paramsB[LOG_SIDE_OFFSET] };
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
-#ifdef USE_SSE
-    const __m128 mm_minValue = _mm_set1_ps(minValue);
-
-    const __m128 mm_m = _mm_set_ps(
-        0.0f, m[2], m[1], m[0]);
-    const __m128 mm_b = _mm_set_ps(
-        0.0f, b[2], b[1], b[0]);
-    const __m128 mm_klog = _mm_set_ps(
-        0.0f, klog[2], klog[1], klog[0]);
-    const __m128 mm_kb = _mm_set_ps(
-        0.0f, kb[2], kb[1], kb[0]);
-
-    __m128 mm_pixel;
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        mm_pixel = _mm_set_ps(0.0f, in[2], in[1], in[0]);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_b);
-        mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
-        mm_pixel = sseLog2(mm_pixel);
-        mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
-        mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
-
-        const float alphares = in[3];
-
-        _mm_storeu_ps(out, mm_pixel);
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
-#else
-    if(in!=out)
-    {
-        memcpy(out, in, numPixels * 4 * sizeof(float));
-    }
-
-    for (long idx = 0; idx<numPixels; ++idx)
-    {
-        const float alphares = in[3];
-
-        ApplyScale(out, m);
-        ApplyAdd(out, b);
-        ApplyMax(out, minValue);
-        ApplyLog2(out);
-        ApplyScale(out, klog);
-        ApplyAdd(out, kb);
-
-        out[3] = alphares;
-
-        out += 4;
-        in  += 4;
-    }
-#endif
+    setParams(m, b, klog, kb);
 }
 
 } // namespace OCIO_NAMESPACE
-
@@ -48,7 +48,7 @@ public:
     bool hasChannelCrosstalk() const override;
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     bool supportedByLegacyShader() const override { return false; }
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
@@ -151,7 +151,7 @@ void Lut1DOp::finalize(OptimizationFlags oFlags)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr Lut1DOp::getCPUOp() const
+ConstOpCPURcPtr Lut1DOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     ConstLut1DOpDataRcPtr data = lut1DData();
     return GetLut1DRenderer(data, BIT_DEPTH_F32, BIT_DEPTH_F32);
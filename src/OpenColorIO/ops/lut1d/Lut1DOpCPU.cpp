@@ -2,9 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <math.h>
 #include <memory>
 #include <stdint.h>
+#include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -136,6 +139,29 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+#ifdef USE_SSE
+// Vectorized version of the 32-bit float to 32-bit float half domain renderer,
+// to only be used when the CPU supports AVX2 and F16C. The F16C instructions
+// convert the float values into half bit patterns which are then directly used
+// as gather indices in the LUT. The results are identical to the base class.
+class Lut1DRendererHalfCodeAVX2 : public Lut1DRendererHalfCode<BIT_DEPTH_F32, BIT_DEPTH_F32>
+{
+public:
+    Lut1DRendererHalfCodeAVX2() = delete;
+
+    explicit Lut1DRendererHalfCodeAVX2(ConstLut1DOpDataRcPtr & lut)
+        : Lut1DRendererHalfCode<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut) {}
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    static bool IsSupported()
+    {
+        const Platform::CPUInfo & info = Platform::GetCPUInfo();
+        return info.hasAVX2 && info.hasF16C;
+    }
+};
+#endif
+
 template<BitDepth inBD, BitDepth outBD>
 class Lut1DRenderer : public BaseLut1DRenderer<inBD, outBD>
 {
@@ -175,6 +201,61 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+// Accelerates the search performed by the inverse of a 1D LUT.
+//
+// Rather than a binary search over the complete effective LUT range, the value
+// to invert is first mapped to a bucket of a grid covering the range of the LUT
+// values. Each bucket holds the window of LUT entries where the lower bound of
+// any value falling into that bucket is located, so only a few entries are then
+// searched. As the mapping from a value to its bucket is monotonic, the result is
+// always identical to a std::lower_bound() over the complete effective range.
+//
+// The grid is uniform in value for regular LUTs. For half domain LUTs, whose values
+// typically span many orders of magnitude, the grid is uniform over the ordered
+// bit patterns of the float values (i.e. roughly logarithmic).
+class LutSearchIndex
+{
+public:
+    LutSearchIndex() = default;
+
+    // Build the index for the increasing values in [start, end).
+    void build(const float * start, const float * end, bool halfDomain);
+
+    // Return the first entry in [start, end) which does not compare less than val
+    // (i.e. same as std::lower_bound(start, end, val)).
+    inline const float * lowerBound(const float * start, float val) const;
+
+#ifdef USE_SSE
+    // Same as lowerBound() for 8 values of a regular LUT at once, the windows being searched
+    // in parallel using gathers. Return the offsets of the entries from start.
+    OCIO_TARGET_AVX2 inline __m256i lowerBound(const float * start, __m256 val) const;
+#endif
+
+private:
+    inline unsigned getBucket(float val) const;
+
+    static inline uint32_t GetOrderedBits(float val);
+
+    bool m_halfDomain = false;
+
+    // Uniform grid in value (regular LUT).
+    float m_minValue = 0.f;
+    float m_invBucketWidth = 0.f;
+    float m_maxBucket = 0.f;
+
+    // Uniform grid in ordered bit patterns (half domain LUT).
+    uint32_t m_minBits = 0;
+    uint32_t m_maxBits = 0;
+    unsigned m_shift = 0;
+
+    // m_windows[b] is the index of the first entry whose bucket is >= b, so the
+    // lower bound of a value in bucket b is always in [m_windows[b], m_windows[b+1]].
+    std::vector<uint32_t> m_windows;
+
+    // Number of iterations of the binary search in the largest window.
+    unsigned m_numIterations = 0;
+};
+
 // Holds the parameters of a color component.
 // Note: The structure does not own any of the pointers.
 struct ComponentParams
@@ -199,10 +280,16 @@ struct ComponentParams
     float flipSign;           // Flip the sign of value to handle decreasing luts.
     float bisectPoint;        // Point of switching from pos to neg of half domain.
 
+    LutSearchIndex index;     // Search acceleration for [lutStart, lutEnd).
+    LutSearchIndex negIndex;  // Search acceleration for [negLutStart, negLutEnd).
+
     static void setComponentParams(ComponentParams & params,
                                    const Lut1DOpData::ComponentProperties & properties,
                                    const float * lutPtr,
                                    float lutZeroEntry);
+
+    // Build the search indices once the LUT values are available.
+    void buildIndices(bool halfDomain);
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -235,6 +322,28 @@ protected:
     float              m_alphaScaling;  // Bit-depth scale factor for alpha channel.
 };
 
+#ifdef USE_SSE
+// Vectorized version of the 32-bit float to 32-bit float inverse renderer, to only be used
+// when the CPU supports AVX2. Each color component of 8 pixels is searched at once (refer to
+// LutSearchIndex). The results are identical to the base class.
+class InvLut1DRendererAVX2 : public InvLut1DRenderer<BIT_DEPTH_F32, BIT_DEPTH_F32>
+{
+public:
+    InvLut1DRendererAVX2() = delete;
+
+    explicit InvLut1DRendererAVX2(ConstLut1DOpDataRcPtr & lut)
+        : InvLut1DRenderer<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut) {}
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    static bool IsSupported()
+    {
+        const Platform::CPUInfo & info = Platform::GetCPUInfo();
+        return info.hasAVX2;
+    }
+};
+#endif
+
 template<BitDepth inBD, BitDepth outBD>
 class InvLut1DRendererHalfCode : public InvLut1DRenderer<inBD, outBD>
 {
@@ -356,9 +465,11 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
 
         m_dim = newLut->getArray().getLength();
 
-        m_tmpLutR = new T[m_dim];
-        m_tmpLutG = new T[m_dim];
-        m_tmpLutB = new T[m_dim];
+        // The three channels are allocated in one block (i.e. one after the other).
+        T * tmpLut = new T[m_dim * 3];
+        m_tmpLutR = tmpLut;
+        m_tmpLutG = tmpLut + m_dim;
+        m_tmpLutB = tmpLut + m_dim * 2;
 
         const Array::Values & lutValues = newLut->getArray().getValues();
 
@@ -374,9 +485,11 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
     {
         const Array::Values & lutValues = lut->getArray().getValues();
 
-        m_tmpLutR = new float[m_dim];
-        m_tmpLutG = new float[m_dim];
-        m_tmpLutB = new float[m_dim];
+        // The three channels are allocated in one block (i.e. one after the other).
+        float * tmpLut = new float[m_dim * 3];
+        m_tmpLutR = tmpLut;
+        m_tmpLutG = tmpLut + m_dim;
+        m_tmpLutB = tmpLut + m_dim * 2;
 
         for(unsigned long i=0; i<m_dim; ++i)
         {
@@ -439,9 +552,11 @@ template<BitDepth inBD, BitDepth outBD>
 template<typename T>
 void BaseLut1DRenderer<inBD, outBD>::resetData()
 {
-    delete [](T*)m_tmpLutR; m_tmpLutR = nullptr;
-    delete [](T*)m_tmpLutG; m_tmpLutG = nullptr;
-    delete [](T*)m_tmpLutB; m_tmpLutB = nullptr;
+    // Note: The green and blue channels are part of the red channel allocation.
+    delete [](T*)m_tmpLutR;
+    m_tmpLutR = nullptr;
+    m_tmpLutG = nullptr;
+    m_tmpLutB = nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -517,6 +632,117 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
     }
 }
 
+#ifdef USE_SSE
+
+namespace
+{
+
+// Convert 8 half bit patterns (i.e. 32-bit integers in [0, 65535]) to floats.
+OCIO_TARGET_AVX2 inline __m256 HalfBitsToFloat(__m256i bits)
+{
+    // Pack the 32-bit integers into the 8 lower 16-bit integers.
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(bits, bits), 0xD8);
+    return _mm256_cvtph_ps(_mm256_castsi256_si128(packed));
+}
+
+}
+
+OCIO_TARGET_AVX2
+void Lut1DRendererHalfCodeAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    // NB: The green and blue channels follow the red one.
+    const float * lut = (const float *)this->m_tmpLutR;
+    const int dim = (int)this->m_dim;
+
+    // Process two RGBA pixels at a time.
+    const __m256i chanOffsets = _mm256_setr_epi32(0, dim, dim * 2, 0, 0, dim, dim * 2, 0);
+    const __m256  rgbMask     = _mm256_castsi256_ps(_mm256_setr_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+    const __m256  alphaScale  = _mm256_set1_ps(this->m_alphaScaling);
+
+    const __m256i absMask    = _mm256_set1_epi32(0x7fff);
+    const __m256i signMask   = _mm256_set1_epi32(0x8000);
+    const __m256i infBits    = _mm256_set1_epi32(0x7c00);
+    const __m256i halfMax    = _mm256_set1_epi32(0x7bff);
+    const __m256i one        = _mm256_set1_epi32(1);
+    const __m256  absMaskPs  = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    const __m256  oneF       = _mm256_set1_ps(1.0f);
+
+    long idx = 0;
+    for (; idx + 2 <= numPixels; idx += 2)
+    {
+        __m256 fIn = _mm256_loadu_ps(in);
+
+        // The half bit patterns of the NaNs differ between F16C and the half class
+        // so these (rare) pixels go through the reference implementation.
+        const __m256 nanMask = _mm256_and_ps(_mm256_cmp_ps(fIn, fIn, _CMP_UNORD_Q), rgbMask);
+        if (_mm256_movemask_ps(nanMask))
+        {
+            Lut1DRendererHalfCode<BIT_DEPTH_F32, BIT_DEPTH_F32>::apply(in, out, 2);
+
+            in  += 8;
+            out += 8;
+            continue;
+        }
+
+        // Refer to IndexPair::GetEdgeFloatValues() for the reference implementation.
+
+        __m256i bits = _mm256_cvtepu16_epi32(_mm256_cvtps_ph(fIn, _MM_FROUND_TO_NEAREST_INT));
+
+        // Infinities become +/-HALF_MAX.
+        const __m256i isInf = _mm256_cmpeq_epi32(_mm256_and_si256(bits, absMask), infBits);
+        bits = _mm256_blendv_epi8(bits,
+                                  _mm256_or_si256(halfMax, _mm256_and_si256(bits, signMask)),
+                                  isInf);
+
+        const __m256 fHalf = HalfBitsToFloat(bits);
+        fIn = _mm256_blendv_ps(fIn, fHalf, _mm256_castsi256_ps(isInf));
+
+        // Strict comparison required otherwise negative fractions will occur.
+        const __m256i isAbove = _mm256_castps_si256(
+            _mm256_cmp_ps(_mm256_and_ps(fHalf, absMaskPs), _mm256_and_ps(fIn, absMaskPs), _CMP_GT_OQ));
+
+        const __m256i valA = _mm256_sub_epi32(bits, _mm256_and_si256(isAbove, one));
+        __m256i valB = _mm256_add_epi32(valA, one);
+
+        // The upper edge could also be an infinity.
+        const __m256i isInfB = _mm256_cmpeq_epi32(_mm256_and_si256(valB, absMask), infBits);
+        valB = _mm256_blendv_epi8(valB,
+                                  _mm256_or_si256(halfMax, _mm256_and_si256(valB, signMask)),
+                                  isInfB);
+
+        const __m256 fA = HalfBitsToFloat(valA);
+        const __m256 fB = HalfBitsToFloat(valB);
+
+        __m256 fraction = _mm256_div_ps(_mm256_sub_ps(fIn, fA), _mm256_sub_ps(fB, fA));
+        fraction = _mm256_andnot_ps(_mm256_cmp_ps(fraction, fraction, _CMP_UNORD_Q), fraction);
+
+        const __m256 lutA = _mm256_i32gather_ps(lut, _mm256_add_epi32(valA, chanOffsets), 4);
+        const __m256 lutB = _mm256_i32gather_ps(lut, _mm256_add_epi32(valB, chanOffsets), 4);
+
+        // Same as lerpf(lutB, lutA, 1.0f - fraction).
+        const __m256 rgb = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(lutA, lutB),
+                                                       _mm256_sub_ps(oneF, fraction)),
+                                         lutB);
+
+        const __m256 alpha = _mm256_mul_ps(_mm256_loadu_ps(in), alphaScale);
+
+        _mm256_storeu_ps(out, _mm256_blendv_ps(alpha, rgb, rgbMask));
+
+        in  += 8;
+        out += 8;
+    }
+
+    if (idx < numPixels)
+    {
+        Lut1DRendererHalfCode<BIT_DEPTH_F32, BIT_DEPTH_F32>::apply(in, out, numPixels - idx);
+    }
+}
+
+#endif
+
 IndexPair IndexPair::GetEdgeFloatValues(float fIn)
 {
     // TODO: Could we speed this up (perhaps alternate nan/inf behavior)?
@@ -717,6 +943,111 @@ inline void Order3(const float* RGB, int& min, int& mid, int& max)
     mid = table[++val];
     min = table[++val];
 }
+
+// Number of pixels processed at once by the hue adjustment (i.e. the LUT outputs of
+// a block of pixels are first computed and then adjusted altogether).
+static constexpr long BLOCK_SIZE = 64;
+
+// Restore the hue of a pixel after the LUT evaluation. RGB is the pixel before the LUT
+// and RGB2 the pixel after the LUT, where the middle channel is recomputed to keep the
+// same position relative to the smallest and largest channels as before the LUT.
+inline void HueAdjust(const float * RGB, float * RGB2)
+{
+    int min, mid, max;
+    Order3(RGB, min, mid, max);
+
+    const float orig_chroma = RGB[max] - RGB[min];
+    const float hue_factor
+        = orig_chroma == 0.f ? 0.f
+                             : (RGB[mid] - RGB[min]) / orig_chroma;
+
+    const float new_chroma = RGB2[max] - RGB2[min];
+
+    RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+}
+
+#ifdef USE_SSE
+// Same as above for four RGBA pixels at once. The channel ordering of Order3() is done
+// without branches using the comparison masks (including the NaN cases).
+inline void HueAdjustSSE(const float * RGB, float * RGB2)
+{
+    __m128 r = _mm_loadu_ps(RGB);
+    __m128 g = _mm_loadu_ps(RGB + 4);
+    __m128 b = _mm_loadu_ps(RGB + 8);
+    __m128 a = _mm_loadu_ps(RGB + 12);
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+
+    __m128 r2 = _mm_loadu_ps(RGB2);
+    __m128 g2 = _mm_loadu_ps(RGB2 + 4);
+    __m128 b2 = _mm_loadu_ps(RGB2 + 8);
+    __m128 a2 = _mm_loadu_ps(RGB2 + 12);
+    _MM_TRANSPOSE4_PS(r2, g2, b2, a2);
+
+    // The three comparisons of Order3().
+    const __m128 rg = _mm_cmpgt_ps(r, g);
+    const __m128 gb = _mm_cmpgt_ps(g, b);
+    const __m128 rb = _mm_cmpgt_ps(r, b);
+
+    // Red is the largest when (R > G && R > B), green when (R <= G && G > B), otherwise
+    // blue is the largest.
+    const __m128 maxIsR = _mm_and_ps(rg, rb);
+    const __m128 maxIsG = _mm_andnot_ps(rg, gb);
+
+    // Red is the smallest unless (R > G || (G > B && R > B)), green is the smallest
+    // when (R > G && G <= B), otherwise blue is the smallest.
+    const __m128 minIsNotR = _mm_or_ps(rg, _mm_and_ps(gb, rb));
+    const __m128 minIsG = _mm_andnot_ps(gb, rg);
+
+    // Green is the middle one when the first two comparisons are equal, otherwise red
+    // is the middle one when the last two comparisons are equal, otherwise blue is.
+    const __m128 midIsNotG = _mm_xor_ps(rg, gb);
+    const __m128 midIsB = _mm_and_ps(midIsNotG, _mm_xor_ps(gb, rb));
+    const __m128 midIsR = _mm_andnot_ps(midIsB, midIsNotG);
+
+    const __m128 max = sseSelect(maxIsR, r, sseSelect(maxIsG, g, b));
+    const __m128 min = sseSelect(minIsNotR, sseSelect(minIsG, g, b), r);
+    const __m128 mid = sseSelect(midIsNotG, sseSelect(midIsB, b, r), g);
+
+    const __m128 orig_chroma = _mm_sub_ps(max, min);
+    const __m128 hue_factor
+        = _mm_andnot_ps(_mm_cmpeq_ps(orig_chroma, _mm_setzero_ps()),
+                        _mm_div_ps(_mm_sub_ps(mid, min), orig_chroma));
+
+    const __m128 max2 = sseSelect(maxIsR, r2, sseSelect(maxIsG, g2, b2));
+    const __m128 min2 = sseSelect(minIsNotR, sseSelect(minIsG, g2, b2), r2);
+
+    const __m128 new_chroma = _mm_sub_ps(max2, min2);
+    const __m128 mid2 = _mm_add_ps(_mm_mul_ps(hue_factor, new_chroma), min2);
+
+    r2 = sseSelect(midIsR, mid2, r2);
+    g2 = sseSelect(midIsNotG, g2, mid2);
+    b2 = sseSelect(midIsB, mid2, b2);
+
+    _MM_TRANSPOSE4_PS(r2, g2, b2, a2);
+    _mm_storeu_ps(RGB2, r2);
+    _mm_storeu_ps(RGB2 + 4, g2);
+    _mm_storeu_ps(RGB2 + 8, b2);
+    _mm_storeu_ps(RGB2 + 12, a2);
+}
+#endif
+
+// Restore the hue of numPixels RGBA pixels (the alpha channels are unchanged).
+inline void HueAdjust(const float * RGB, float * RGB2, long numPixels)
+{
+    long idx = 0;
+
+#ifdef USE_SSE
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        HueAdjustSSE(RGB + 4 * idx, RGB2 + 4 * idx);
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        HueAdjust(RGB + 4 * idx, RGB2 + 4 * idx);
+    }
+}
 };
 
 
@@ -737,83 +1068,90 @@ void Lut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, void
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
-    // NB: The if/else is expanded at compile time based on the template args.
-    // (Should be no runtime cost.)
-    if (inBD != BIT_DEPTH_F32)
-    {
-        for(long idx=0; idx<numPixels; ++idx)
-        {
-            const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
-
-            int min, mid, max;
-            GamutMapUtils::Order3( RGB, min, mid, max);
-
-            const float orig_chroma = RGB[max] - RGB[min];
-            const float hue_factor 
-                = orig_chroma == 0.f  ?  0.f 
-                                      :  (RGB[mid] - RGB[min]) / orig_chroma;
+    // The pixels before and after the LUT.
+    float RGB[4 * GamutMapUtils::BLOCK_SIZE];
+    float RGB2[4 * GamutMapUtils::BLOCK_SIZE];
 
-            float RGB2[] = {
-                LookupLut<InType, float>::compute(lutR, in[0]),
-                LookupLut<InType, float>::compute(lutG, in[1]),
-                LookupLut<InType, float>::compute(lutB, in[2])   };
+    for (long blockIdx = 0; blockIdx < numPixels; blockIdx += GamutMapUtils::BLOCK_SIZE)
+    {
+        const long blockSize = std::min(numPixels - blockIdx, GamutMapUtils::BLOCK_SIZE);
 
-            const float new_chroma = RGB2[max] - RGB2[min];
+        // NB: The if/else is expanded at compile time based on the template args.
+        // (Should be no runtime cost.)
+        if (inBD != BIT_DEPTH_F32)
+        {
+            for(long idx=0; idx<blockSize; ++idx)
+            {
+                float * rgb  = RGB  + 4 * idx;
+                float * rgb2 = RGB2 + 4 * idx;
 
-            RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+                rgb[0] = (float)in[0];
+                rgb[1] = (float)in[1];
+                rgb[2] = (float)in[2];
+                rgb[3] = 0.f;
 
-            out[0] = OutType(RGB2[0]);
-            out[1] = OutType(RGB2[1]);
-            out[2] = OutType(RGB2[2]);
-            out[3] = OutType(in[3] * this->m_alphaScaling);
+                rgb2[0] = LookupLut<InType, float>::compute(lutR, in[0]);
+                rgb2[1] = LookupLut<InType, float>::compute(lutG, in[1]);
+                rgb2[2] = LookupLut<InType, float>::compute(lutB, in[2]);
+                rgb2[3] = in[3] * this->m_alphaScaling;
 
-            in  += 4;
-            out += 4;
+                in  += 4;
+            }
         }
-    }
-    else  // Need to interpolate rather than simply lookup.
-    {
-        for(long idx=0; idx<numPixels; ++idx)
+        else  // Need to interpolate rather than simply lookup.
         {
-            const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
+            for(long idx=0; idx<blockSize; ++idx)
+            {
+                float * rgb  = RGB  + 4 * idx;
+                float * rgb2 = RGB2 + 4 * idx;
+
+                rgb[0] = (float)in[0];
+                rgb[1] = (float)in[1];
+                rgb[2] = (float)in[2];
+                rgb[3] = 0.f;
+
+                const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(rgb[0]);
+                const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(rgb[1]);
+                const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(rgb[2]);
+
+                // Since fraction is in the domain [0, 1), interpolate using
+                // 1-fraction in order to avoid cases like -/+Inf * 0.
+                rgb2[0] = lerpf(lutR[redInterVals.valB],
+                                lutR[redInterVals.valA],
+                                1.0f-redInterVals.fraction);
+                rgb2[1] = lerpf(lutG[greenInterVals.valB],
+                                lutG[greenInterVals.valA],
+                                1.0f-greenInterVals.fraction);
+                rgb2[2] = lerpf(lutB[blueInterVals.valB],
+                                lutB[blueInterVals.valA],
+                                1.0f-blueInterVals.fraction);
+                rgb2[3] = in[3] * this->m_alphaScaling;
+
+                in  += 4;
+            }
+        }
 
-            int min, mid, max;
-            GamutMapUtils::Order3(RGB, min, mid, max);
+        GamutMapUtils::HueAdjust(RGB, RGB2, blockSize);
 
-            const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(RGB[0]);
-            const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(RGB[1]);
-            const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(RGB[2]);
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            const float * rgb2 = RGB2 + 4 * idx;
 
-            // Since fraction is in the domain [0, 1), interpolate using
-            // 1-fraction in order to avoid cases like -/+Inf * 0.
-            float RGB2[] = {
-                lerpf(lutR[redInterVals.valB],
-                      lutR[redInterVals.valA],
-                      1.0f-redInterVals.fraction),
-                lerpf(lutG[greenInterVals.valB],
-                      lutG[greenInterVals.valA],
-                      1.0f-greenInterVals.fraction),
-                lerpf(lutB[blueInterVals.valB],
-                      lutB[blueInterVals.valA],
-                      1.0f-blueInterVals.fraction)  };
-
-            // TODO: ease SSE implementation (may be applied to all chans):
-            // RGB2[channel] = (RGB[channel] - RGB(min)) 
-            //                 * new_chroma / orig_chroma + RGB2[min].
-            const float orig_chroma = RGB[max] - RGB[min];
-            const float hue_factor 
-                = orig_chroma == 0.f  ? 0.f
-                                      : (RGB[mid] - RGB[min]) / orig_chroma;
-
-            const float new_chroma = RGB2[max] - RGB2[min];
-            RGB2[mid] = hue_factor * new_chroma + RGB2[min];
-
-            out[0] = Converter<outBD>::CastValue(RGB2[0]);
-            out[1] = Converter<outBD>::CastValue(RGB2[1]);
-            out[2] = Converter<outBD>::CastValue(RGB2[2]);
-            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            if (inBD != BIT_DEPTH_F32)
+            {
+                out[0] = OutType(rgb2[0]);
+                out[1] = OutType(rgb2[1]);
+                out[2] = OutType(rgb2[2]);
+                out[3] = OutType(rgb2[3]);
+            }
+            else
+            {
+                out[0] = Converter<outBD>::CastValue(rgb2[0]);
+                out[1] = Converter<outBD>::CastValue(rgb2[1]);
+                out[2] = Converter<outBD>::CastValue(rgb2[2]);
+                out[3] = Converter<outBD>::CastValue(rgb2[3]);
+            }
 
-            in  += 4;
             out += 4;
         }
     }
@@ -832,148 +1170,321 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
-    // NB: The if/else is expanded at compile time based on the template args.
-    // (Should be no runtime cost.)
-    if (inBD != BIT_DEPTH_F32)
+    // The pixels before and after the LUT.
+    float RGB[4 * GamutMapUtils::BLOCK_SIZE];
+    float RGB2[4 * GamutMapUtils::BLOCK_SIZE];
+
+    for (long blockIdx = 0; blockIdx < numPixels; blockIdx += GamutMapUtils::BLOCK_SIZE)
     {
-        for(long idx=0; idx<numPixels; ++idx)
+        const long blockSize = std::min(numPixels - blockIdx, GamutMapUtils::BLOCK_SIZE);
+
+        // NB: The if/else is expanded at compile time based on the template args.
+        // (Should be no runtime cost.)
+        if (inBD != BIT_DEPTH_F32)
         {
-            const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
+            for(long idx=0; idx<blockSize; ++idx)
+            {
+                float * rgb  = RGB  + 4 * idx;
+                float * rgb2 = RGB2 + 4 * idx;
 
-            int min, mid, max;
-            GamutMapUtils::Order3(RGB, min, mid, max);
+                rgb[0] = (float)in[0];
+                rgb[1] = (float)in[1];
+                rgb[2] = (float)in[2];
+                rgb[3] = 0.f;
 
-            const float orig_chroma = RGB[max] - RGB[min];
-            const float hue_factor
-                = orig_chroma == 0.f ? 0.f
-                                     : (RGB[mid] - RGB[min]) / orig_chroma;
+                rgb2[0] = LookupLut<InType, float>::compute(lutR, in[0]);
+                rgb2[1] = LookupLut<InType, float>::compute(lutG, in[1]);
+                rgb2[2] = LookupLut<InType, float>::compute(lutB, in[2]);
+                rgb2[3] = in[3] * this->m_alphaScaling;
 
-            float RGB2[] = {
-                LookupLut<InType, float>::compute(lutR, in[0]),
-                LookupLut<InType, float>::compute(lutG, in[1]),
-                LookupLut<InType, float>::compute(lutB, in[2])
-            };
+                in  += 4;
+            }
+        }
+        else  // Need to interpolate rather than simply lookup.
+        {
+            for(long i=0; i<blockSize; ++i)
+            {
+                float * rgb  = RGB  + 4 * i;
+                float * rgb2 = RGB2 + 4 * i;
 
-            const float new_chroma = RGB2[max] - RGB2[min];
+                rgb[0] = (float)in[0];
+                rgb[1] = (float)in[1];
+                rgb[2] = (float)in[2];
+                rgb[3] = 0.f;
 
-            RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+#ifdef USE_SSE
+                __m128 idx
+                    = _mm_mul_ps(_mm_set_ps(in[3],
+                                            rgb[2],
+                                            rgb[1],
+                                            rgb[0]),
+                                 _mm_set_ps(1.0f,
+                                            this->m_step,
+                                            this->m_step,
+                                            this->m_step));
+
+                // _mm_max_ps => NaNs become 0
+                idx = _mm_min_ps(_mm_max_ps(idx, EZERO),
+                                 _mm_set1_ps(this->m_dimMinusOne));
+
+                // zero < std::floor(idx) < maxIdx
+                // SSE => zero < truncate(idx) < maxIdx
+                // then clamp to prevent hIdx from falling off the end
+                // of the LUT
+                __m128 lIdx = _mm_cvtepi32_ps(_mm_cvttps_epi32(idx));
+
+                // zero < std::ceil(idx) < maxIdx
+                // SSE => (lowIdx (already truncated) + 1) < maxIdx
+                __m128 hIdx = _mm_min_ps(_mm_add_ps(lIdx, EONE),
+                                         _mm_set1_ps(this->m_dimMinusOne));
+
+                // Computing delta relative to high rather than lowIdx
+                // to save computing (1-delta) below.
+                __m128 d = _mm_sub_ps(hIdx, idx);
+
+                OCIO_ALIGN(float delta[4]);   _mm_store_ps(delta, d);
+                OCIO_ALIGN(float lowIdx[4]);  _mm_store_ps(lowIdx, lIdx);
+                OCIO_ALIGN(float highIdx[4]); _mm_store_ps(highIdx, hIdx);
+#else
+                float idx[3];
+                idx[0] = this->m_step * rgb[0];
+                idx[1] = this->m_step * rgb[1];
+                idx[2] = this->m_step * rgb[2];
+
+                // NaNs become 0
+                idx[0] = std::min(std::max(0.f, idx[0]), this->m_dimMinusOne);
+                idx[1] = std::min(std::max(0.f, idx[1]), this->m_dimMinusOne);
+                idx[2] = std::min(std::max(0.f, idx[2]), this->m_dimMinusOne);
+
+                unsigned int lowIdx[3];
+                lowIdx[0] = static_cast<unsigned int>(std::floor(idx[0]));
+                lowIdx[1] = static_cast<unsigned int>(std::floor(idx[1]));
+                lowIdx[2] = static_cast<unsigned int>(std::floor(idx[2]));
+
+                // When the idx is exactly equal to an index (e.g. 0,1,2...)
+                // then the computation of highIdx is wrong. However,
+                // the delta is then equal to zero (e.g. lowIdx-idx),
+                // so the highIdx has no impact.
+                unsigned int highIdx[3];
+                highIdx[0] = static_cast<unsigned int>(std::ceil(idx[0]));
+                highIdx[1] = static_cast<unsigned int>(std::ceil(idx[1]));
+                highIdx[2] = static_cast<unsigned int>(std::ceil(idx[2]));
+
+                // Computing delta relative to high rather than lowIdx
+                // to save computing (1-delta) below.
+                float delta[3];
+                delta[0] = (float)highIdx[0] - idx[0];
+                delta[1] = (float)highIdx[1] - idx[1];
+                delta[2] = (float)highIdx[2] - idx[2];
+#endif
+                // Since fraction is in the domain [0, 1), interpolate using 1-fraction
+                // in order to avoid cases like -/+Inf * 0. Therefore we never multiply by 0 and
+                // thus handle the case where A or B is infinity and return infinity rather than
+                // 0*Infinity (which is NaN).
+                rgb2[0] = lerpf(lutR[(unsigned int)highIdx[0]], lutR[(unsigned int)lowIdx[0]], delta[0]);
+                rgb2[1] = lerpf(lutG[(unsigned int)highIdx[1]], lutG[(unsigned int)lowIdx[1]], delta[1]);
+                rgb2[2] = lerpf(lutB[(unsigned int)highIdx[2]], lutB[(unsigned int)lowIdx[2]], delta[2]);
+                rgb2[3] = in[3] * this->m_alphaScaling;
+
+                in  += 4;
+            }
+        }
 
-            out[0] = OutType(RGB2[0]);
-            out[1] = OutType(RGB2[1]);
-            out[2] = OutType(RGB2[2]);
-            out[3] = OutType(in[3] * this->m_alphaScaling);
+        GamutMapUtils::HueAdjust(RGB, RGB2, blockSize);
+
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            const float * rgb2 = RGB2 + 4 * idx;
+
+            if (inBD != BIT_DEPTH_F32)
+            {
+                out[0] = OutType(rgb2[0]);
+                out[1] = OutType(rgb2[1]);
+                out[2] = OutType(rgb2[2]);
+                out[3] = OutType(rgb2[3]);
+            }
+            else
+            {
+                out[0] = Converter<outBD>::CastValue(rgb2[0]);
+                out[1] = Converter<outBD>::CastValue(rgb2[1]);
+                out[2] = Converter<outBD>::CastValue(rgb2[2]);
+                out[3] = Converter<outBD>::CastValue(rgb2[3]);
+            }
 
-            in  += 4;
             out += 4;
         }
     }
-    else  // Need to interpolate rather than simply lookup.
+}
+
+uint32_t LutSearchIndex::GetOrderedBits(float val)
+{
+    // Map the float bit pattern to an unsigned integer that sorts like the float
+    // value (i.e. flip all the bits of negative values and the sign bit of positive
+    // ones). Adding 0 turns -0 into +0 as both have to be in the same bucket.
+    val += 0.f;
+
+    uint32_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+unsigned LutSearchIndex::getBucket(float val) const
+{
+    if (m_halfDomain)
     {
-        for(long i=0; i<numPixels; ++i)
+        const uint32_t bits = std::min(std::max(GetOrderedBits(val), m_minBits), m_maxBits);
+        // NaNs go to the first bucket (i.e. the result of std::lower_bound() for NaN).
+        return (val == val) ? ((bits - m_minBits) >> m_shift) : 0;
+    }
+    else
+    {
+        // NaNs become 0.
+        const float bucket = std::min(std::max(0.f, (val - m_minValue) * m_invBucketWidth),
+                                      m_maxBucket);
+        return (unsigned)bucket;
+    }
+}
+
+void LutSearchIndex::build(const float * start, const float * end, bool halfDomain)
+{
+    static constexpr size_t MaxBuckets = 4096;
+
+    const size_t numEntries = (size_t)(end - start);
+
+    m_halfDomain = halfDomain;
+
+    size_t numBuckets = 1;
+
+    if (numEntries > 0)
+    {
+        const float minValue = start[0];
+        const float maxValue = start[numEntries - 1];
+
+        const size_t targetBuckets = std::min(numEntries, MaxBuckets);
+
+        if (m_halfDomain)
         {
-            const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
+            m_minBits = GetOrderedBits(minValue);
+            m_maxBits = std::max(GetOrderedBits(maxValue), m_minBits);
 
-            int min, mid, max;
-            GamutMapUtils::Order3( RGB, min, mid, max);
+            m_shift = 0;
+            while (((m_maxBits - m_minBits) >> m_shift) >= targetBuckets)
+            {
+                ++m_shift;
+            }
 
-            const float orig_chroma = RGB[max] - RGB[min];
-            const float hue_factor 
-                = orig_chroma == 0.f ? 0.f
-                                     : (RGB[mid] - RGB[min]) / orig_chroma;
+            numBuckets = ((m_maxBits - m_minBits) >> m_shift) + 1;
+        }
+        else
+        {
+            const float range = maxValue - minValue;
 
-#ifdef USE_SSE
-            __m128 idx
-                = _mm_mul_ps(_mm_set_ps(in[3],
-                                        RGB[2],
-                                        RGB[1],
-                                        RGB[0]),
-                             _mm_set_ps(1.0f,
-                                        this->m_step,
-                                        this->m_step,
-                                        this->m_step));
+            m_minValue = minValue;
 
-            // _mm_max_ps => NaNs become 0
-            idx = _mm_min_ps(_mm_max_ps(idx, EZERO),
-                             _mm_set1_ps(this->m_dimMinusOne));
+            if (range > 0.f && range < std::numeric_limits<float>::infinity())
+            {
+                numBuckets = targetBuckets;
+                m_invBucketWidth = (float)numBuckets / range;
+                m_maxBucket = (float)(numBuckets - 1);
+            }
+            else
+            {
+                // Everything falls into a single bucket.
+                m_invBucketWidth = 0.f;
+                m_maxBucket = 0.f;
+            }
+        }
+    }
 
-            // zero < std::floor(idx) < maxIdx
-            // SSE => zero < truncate(idx) < maxIdx
-            // then clamp to prevent hIdx from falling off the end
-            // of the LUT
-            __m128 lIdx = _mm_cvtepi32_ps(_mm_cvttps_epi32(idx));
+    m_windows.resize(numBuckets + 1);
 
-            // zero < std::ceil(idx) < maxIdx
-            // SSE => (lowIdx (already truncated) + 1) < maxIdx
-            __m128 hIdx = _mm_min_ps(_mm_add_ps(lIdx, EONE),
-                                     _mm_set1_ps(this->m_dimMinusOne));
+    size_t entry = 0;
+    for (size_t bucket = 0; bucket < numBuckets; ++bucket)
+    {
+        while (entry < numEntries && getBucket(start[entry]) < bucket)
+        {
+            ++entry;
+        }
+        m_windows[bucket] = (uint32_t)entry;
+    }
+    m_windows[numBuckets] = (uint32_t)numEntries;
 
-            // Computing delta relative to high rather than lowIdx
-            // to save computing (1-delta) below.
-            __m128 d = _mm_sub_ps(hIdx, idx);
+    uint32_t maxLength = 0;
+    for (size_t bucket = 0; bucket < numBuckets; ++bucket)
+    {
+        maxLength = std::max(maxLength, m_windows[bucket + 1] - m_windows[bucket]);
+    }
 
-            OCIO_ALIGN(float delta[4]);   _mm_store_ps(delta, d);
-            OCIO_ALIGN(float lowIdx[4]);  _mm_store_ps(lowIdx, lIdx);
-            OCIO_ALIGN(float highIdx[4]); _mm_store_ps(highIdx, hIdx);
-#else
-            float idx[3];
-            idx[0] = this->m_step * RGB[0];
-            idx[1] = this->m_step * RGB[1];
-            idx[2] = this->m_step * RGB[2];
+    m_numIterations = 0;
+    while ((1u << m_numIterations) < maxLength)
+    {
+        ++m_numIterations;
+    }
+}
 
-            // NaNs become 0
-            idx[0] = std::min(std::max(0.f, idx[0]), this->m_dimMinusOne);
-            idx[1] = std::min(std::max(0.f, idx[1]), this->m_dimMinusOne);
-            idx[2] = std::min(std::max(0.f, idx[2]), this->m_dimMinusOne);
+const float * LutSearchIndex::lowerBound(const float * start, float val) const
+{
+    const unsigned bucket = getBucket(val);
 
-            unsigned int lowIdx[3];
-            lowIdx[0] = static_cast<unsigned int>(std::floor(idx[0]));
-            lowIdx[1] = static_cast<unsigned int>(std::floor(idx[1]));
-            lowIdx[2] = static_cast<unsigned int>(std::floor(idx[2]));
+    const float * first = start + m_windows[bucket];
+    size_t length = m_windows[bucket + 1] - m_windows[bucket];
 
-            // When the idx is exactly equal to an index (e.g. 0,1,2...)
-            // then the computation of highIdx is wrong. However,
-            // the delta is then equal to zero (e.g. lowIdx-idx),
-            // so the highIdx has no impact.
-            unsigned int highIdx[3];
-            highIdx[0] = static_cast<unsigned int>(std::ceil(idx[0]));
-            highIdx[1] = static_cast<unsigned int>(std::ceil(idx[1]));
-            highIdx[2] = static_cast<unsigned int>(std::ceil(idx[2]));
+    if (length == 0)
+    {
+        return first;
+    }
 
-            // Computing delta relative to high rather than lowIdx
-            // to save computing (1-delta) below.
-            float delta[3];
-            delta[0] = (float)highIdx[0] - idx[0];
-            delta[1] = (float)highIdx[1] - idx[1];
-            delta[2] = (float)highIdx[2] - idx[2];
-#endif
-            // Since fraction is in the domain [0, 1), interpolate using 1-fraction
-            // in order to avoid cases like -/+Inf * 0. Therefore we never multiply by 0 and
-            // thus handle the case where A or B is infinity and return infinity rather than
-            // 0*Infinity (which is NaN).
-            float RGB2[] = {
-                lerpf(lutR[(unsigned int)highIdx[0]], lutR[(unsigned int)lowIdx[0]], delta[0]),
-                lerpf(lutG[(unsigned int)highIdx[1]], lutG[(unsigned int)lowIdx[1]], delta[1]),
-                lerpf(lutB[(unsigned int)highIdx[2]], lutB[(unsigned int)lowIdx[2]], delta[2])
-            };
+    // Branch-free binary search where the number of iterations only depends
+    // on the window length.
+    while (length > 1)
+    {
+        const size_t half = length / 2;
+        first = (first[half] < val) ? first + half : first;
+        length -= half;
+    }
+
+    return (*first < val) ? first + 1 : first;
+}
 
-            const float new_chroma = RGB2[max] - RGB2[min];
+#ifdef USE_SSE
+OCIO_TARGET_AVX2
+__m256i LutSearchIndex::lowerBound(const float * start, __m256 val) const
+{
+    // Same as getBucket() i.e. the NaNs go to the first bucket.
+    __m256 bucket = _mm256_mul_ps(_mm256_sub_ps(val, _mm256_set1_ps(m_minValue)),
+                                  _mm256_set1_ps(m_invBucketWidth));
+    bucket = _mm256_min_ps(_mm256_max_ps(bucket, _mm256_setzero_ps()), _mm256_set1_ps(m_maxBucket));
+    const __m256i buckets = _mm256_cvttps_epi32(bucket);
 
-            RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+    const int * windows = (const int *)m_windows.data();
 
-            out[0] = Converter<outBD>::CastValue(RGB2[0]);
-            out[1] = Converter<outBD>::CastValue(RGB2[1]);
-            out[2] = Converter<outBD>::CastValue(RGB2[2]);
-            out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+    __m256i first  = _mm256_i32gather_epi32(windows, buckets, 4);
+    __m256i length = _mm256_sub_epi32(_mm256_i32gather_epi32(windows + 1, buckets, 4), first);
 
-            in  += 4;
-            out += 4;
-        }
+    // The iterations are no-ops once the length of a window is 1 (i.e. the half is 0).
+    for (unsigned iter = 0; iter < m_numIterations; ++iter)
+    {
+        const __m256i half = _mm256_srli_epi32(length, 1);
+        const __m256 entries = _mm256_i32gather_ps(start, _mm256_add_epi32(first, half), 4);
+        const __m256i isLess = _mm256_castps_si256(_mm256_cmp_ps(entries, val, _CMP_LT_OQ));
+        first  = _mm256_add_epi32(first, _mm256_and_si256(isLess, half));
+        length = _mm256_sub_epi32(length, half);
     }
+
+    // Move to the next entry if the last one is less than the value (except empty windows).
+    const __m256 entries = _mm256_i32gather_ps(start, first, 4);
+    const __m256i isLess = _mm256_and_si256(
+        _mm256_castps_si256(_mm256_cmp_ps(entries, val, _CMP_LT_OQ)),
+        _mm256_cmpgt_epi32(length, _mm256_setzero_si256()));
+
+    // NB: isLess is -1 for true.
+    return _mm256_sub_epi32(first, isLess);
 }
+#endif
 
 namespace
 {
-// TODO: Use SSE intrinsics to speed this up.
 
 // Calculate the inverse of a value resulting from linear interpolation
 // in a 1d LUT.
@@ -982,6 +1493,7 @@ namespace
 // end:         Pointer to the last effective LUT entry (start of flat spot).
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
+// index:       Search acceleration for [start, end).
 // val:         The value to invert.
 // Return the result that would produce val if used 
 // in a forward linear interpolation in the LUT.
@@ -990,22 +1502,23 @@ float FindLutInv(const float * start,
                  const float * end,
                  const float   flipSign,
                  const float   scale,
+                 const LutSearchIndex & index,
                  const float   val)
 {
     // Note that the LUT data pointed to by start/end must be in increasing order,
     // regardless of whether the original LUT was increasing or decreasing because
-    // this function uses std::lower_bound().
+    // the search is equivalent to std::lower_bound().
 
     // Clamp the value to the range of the LUT.
     const float cv = std::min( std::max( val * flipSign, *start ), *end );
 
-    // std::lower_bound()
+    // Same as std::lower_bound() which
     // "Returns an iterator pointing to the first element in the range [first,last) 
     // which does not compare less than val (but could be equal)."
     // (NB: This is correct using either end or end+1 since lower_bound will return a
     //  value one greater than the second argument if no values in the array are >= cv.)
     // http://www.sgi.com/tech/stl/lower_bound.html
-    const float* lowbound = std::lower_bound(start, end, cv);
+    const float* lowbound = index.lowerBound(start, cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1037,6 +1550,45 @@ float FindLutInv(const float * start,
     return (totalInds + delta) * scale;
 }
 
+#ifdef USE_SSE
+// Same as FindLutInv() for 8 values of a color component.
+OCIO_TARGET_AVX2
+inline __m256 FindLutInvAVX2(const ComponentParams & params, const float scale, const __m256 val)
+{
+    const float * start = params.lutStart;
+    const int numEntries = (int)(params.lutEnd - params.lutStart);
+
+    // Clamp the value to the range of the LUT (the argument order keeps the NaNs).
+    const __m256 cv = _mm256_min_ps(_mm256_set1_ps(*params.lutEnd),
+                                    _mm256_max_ps(_mm256_set1_ps(*start),
+                                                  _mm256_mul_ps(val, _mm256_set1_ps(params.flipSign))));
+
+    const __m256i one = _mm256_set1_epi32(1);
+
+    __m256i lowbound = params.index.lowerBound(start, cv);
+    lowbound = _mm256_sub_epi32(lowbound,
+                                _mm256_and_si256(_mm256_cmpgt_epi32(lowbound, _mm256_setzero_si256()),
+                                                 one));
+
+    const __m256i highbound
+        = _mm256_add_epi32(lowbound,
+                           _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(numEntries), lowbound),
+                                            one));
+
+    const __m256 low  = _mm256_i32gather_ps(start, lowbound, 4);
+    const __m256 high = _mm256_i32gather_ps(start, highbound, 4);
+
+    // Handle the flat spots by leaving delta = 0.
+    const __m256 delta = _mm256_and_ps(_mm256_cmp_ps(high, low, _CMP_GT_OQ),
+                                       _mm256_div_ps(_mm256_sub_ps(cv, low), _mm256_sub_ps(high, low)));
+
+    const __m256 totalInds = _mm256_add_ps(_mm256_cvtepi32_ps(lowbound),
+                                           _mm256_set1_ps(params.startOffset));
+
+    return _mm256_mul_ps(_mm256_add_ps(totalInds, delta), _mm256_set1_ps(scale));
+}
+#endif
+
 // Calculate the inverse of a value resulting from linear interpolation
 // in a half domain 1d LUT.
 // start:       Pointer to the first effective LUT entry (end of flat spot).
@@ -1044,6 +1596,7 @@ float FindLutInv(const float * start,
 // end:         Pointer to the last effective LUT entry (start of flat spot).
 // flipSign:    Flips val if we're working with the negative of the orig LUT.
 // scale:       From LUT index units to outDepth units.
+// index:       Search acceleration for [start, end).
 // val:         The value to invert.
 // Return the result that would produce val if used in a forward linear
 // interpolation in the LUT.
@@ -1052,16 +1605,17 @@ float FindLutInvHalf(const float * start,
                      const float * end,
                      const float   flipSign,
                      const float   scale,
+                     const LutSearchIndex & index,
                      const float   val)
 {
     // Note that the LUT data pointed to by start/end must be in increasing order,
     // regardless of whether the original LUT was increasing or decreasing because
-    // this function uses std::lower_bound().
+    // the search is equivalent to std::lower_bound().
 
     // Clamp the value to the range of the LUT.
     const float cv = std::min( std::max( val * flipSign, *start ), *end );
 
-    const float* lowbound = std::lower_bound(start, end, cv);
+    const float* lowbound = index.lowerBound(start, cv);
 
     // lower_bound() returns first entry >= val so decrement it unless val == *start.
     if (lowbound > start) {
@@ -1134,6 +1688,37 @@ void ComponentParams::setComponentParams(ComponentParams & params,
     params.negLutEnd   = lutPtr + properties.negEndDomain;
 }
 
+void ComponentParams::buildIndices(bool halfDomain)
+{
+    index.build(lutStart, lutEnd, halfDomain);
+
+    if (halfDomain)
+    {
+        negIndex.build(negLutStart, negLutEnd, halfDomain);
+    }
+}
+
+// Build the search indices of all the color components once the LUT values are final.
+void BuildIndices(bool hasSingleLut,
+                  bool halfDomain,
+                  ComponentParams & paramsR,
+                  ComponentParams & paramsG,
+                  ComponentParams & paramsB)
+{
+    paramsR.buildIndices(halfDomain);
+
+    if (hasSingleLut)
+    {
+        // NB: All pointers refer to the red LUT.
+        paramsB = paramsG = paramsR;
+    }
+    else
+    {
+        paramsG.buildIndices(halfDomain);
+        paramsB.buildIndices(halfDomain);
+    }
+}
+
 template<BitDepth inBD, BitDepth outBD>
 void InvLut1DRenderer<inBD, outBD>::resetData()
 {
@@ -1203,6 +1788,8 @@ void InvLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
         }
     }
 
+    BuildIndices(hasSingleLut, false, m_paramsR, m_paramsG, m_paramsB);
+
     const float outMax = (float)GetBitDepthMaxValue(outBD);
 
     m_alphaScaling = outMax / (float)GetBitDepthMaxValue(inBD);
@@ -1230,6 +1817,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                                this->m_paramsR.lutEnd,
                                this->m_paramsR.flipSign,
                                m_scale,
+                               this->m_paramsR.index,
                                (float)in[0]));
 
         // green
@@ -1239,6 +1827,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                                this->m_paramsG.lutEnd,
                                this->m_paramsG.flipSign,
                                m_scale,
+                               this->m_paramsG.index,
                                (float)in[1]));
 
         // blue
@@ -1248,6 +1837,7 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
                                this->m_paramsB.lutEnd,
                                this->m_paramsB.flipSign,
                                m_scale,
+                               this->m_paramsB.index,
                                (float)in[2]));
 
         // alpha
@@ -1258,6 +1848,37 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
     }
 }
 
+#ifdef USE_SSE
+OCIO_TARGET_AVX2
+void InvLut1DRendererAVX2::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    const __m256 alphaScale = _mm256_set1_ps(m_alphaScaling);
+
+    long idx = 0;
+    for (; idx + 8 <= numPixels; idx += 8)
+    {
+        __m256 red, grn, blu, alpha;
+        avx2LoadRGBA(in, red, grn, blu, alpha);
+
+        red   = FindLutInvAVX2(m_paramsR, m_scale, red);
+        grn   = FindLutInvAVX2(m_paramsG, m_scale, grn);
+        blu   = FindLutInvAVX2(m_paramsB, m_scale, blu);
+        alpha = _mm256_mul_ps(alpha, alphaScale);
+
+        avx2StoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 32;
+        out += 32;
+    }
+
+    // Process the remaining pixels.
+    InvLut1DRenderer<BIT_DEPTH_F32, BIT_DEPTH_F32>::apply(in, out, numPixels - idx);
+}
+#endif
+
 template<BitDepth inBD, BitDepth outBD>
 InvLut1DRendererHueAdjust<inBD, outBD>::InvLut1DRendererHueAdjust(ConstLut1DOpDataRcPtr & lut) 
     :  InvLut1DRenderer<inBD, outBD>(lut)
@@ -1274,53 +1895,67 @@ void InvLut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * ou
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
-    for(long idx=0; idx<numPixels; ++idx)
+    // The pixels before and after the LUT.
+    float RGB[4 * GamutMapUtils::BLOCK_SIZE];
+    float RGB2[4 * GamutMapUtils::BLOCK_SIZE];
+
+    for (long blockIdx = 0; blockIdx < numPixels; blockIdx += GamutMapUtils::BLOCK_SIZE)
     {
-        const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
+        const long blockSize = std::min(numPixels - blockIdx, GamutMapUtils::BLOCK_SIZE);
 
-        int min, mid, max;
-        GamutMapUtils::Order3(RGB, min, mid, max);
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            float * rgb  = RGB  + 4 * idx;
+            float * rgb2 = RGB2 + 4 * idx;
 
-        const float orig_chroma = RGB[max] - RGB[min];
-        const float hue_factor
-            = (orig_chroma == 0.f) ? 0.f
-                                   : (RGB[mid] - RGB[min]) / orig_chroma;
+            rgb[0] = (float)in[0];
+            rgb[1] = (float)in[1];
+            rgb[2] = (float)in[2];
+            rgb[3] = 0.f;
 
-        float RGB2[] = {
             // red
-            FindLutInv(this->m_paramsR.lutStart,
-                       this->m_paramsR.startOffset,
-                       this->m_paramsR.lutEnd,
-                       this->m_paramsR.flipSign,
-                       this->m_scale,
-                       RGB[0]),
+            rgb2[0] = FindLutInv(this->m_paramsR.lutStart,
+                                 this->m_paramsR.startOffset,
+                                 this->m_paramsR.lutEnd,
+                                 this->m_paramsR.flipSign,
+                                 this->m_scale,
+                                 this->m_paramsR.index,
+                                 rgb[0]);
             // green
-            FindLutInv(this->m_paramsG.lutStart,
-                       this->m_paramsG.startOffset,
-                       this->m_paramsG.lutEnd,
-                       this->m_paramsG.flipSign,
-                       this->m_scale,
-                       RGB[1]),
+            rgb2[1] = FindLutInv(this->m_paramsG.lutStart,
+                                 this->m_paramsG.startOffset,
+                                 this->m_paramsG.lutEnd,
+                                 this->m_paramsG.flipSign,
+                                 this->m_scale,
+                                 this->m_paramsG.index,
+                                 rgb[1]);
             // blue
-            FindLutInv(this->m_paramsB.lutStart,
-                       this->m_paramsB.startOffset,
-                       this->m_paramsB.lutEnd,
-                       this->m_paramsB.flipSign,
-                       this->m_scale,
-                       RGB[2])
-        };
+            rgb2[2] = FindLutInv(this->m_paramsB.lutStart,
+                                 this->m_paramsB.startOffset,
+                                 this->m_paramsB.lutEnd,
+                                 this->m_paramsB.flipSign,
+                                 this->m_scale,
+                                 this->m_paramsB.index,
+                                 rgb[2]);
 
-        const float new_chroma = RGB2[max] - RGB2[min];
+            rgb2[3] = in[3] * this->m_alphaScaling;
 
-        RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+            in  += 4;
+        }
 
-        out[0] = Converter<outBD>::CastValue(RGB2[0]);
-        out[1] = Converter<outBD>::CastValue(RGB2[1]);
-        out[2] = Converter<outBD>::CastValue(RGB2[2]);
-        out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+        GamutMapUtils::HueAdjust(RGB, RGB2, blockSize);
 
-        in  += 4;
-        out += 4;
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            const float * rgb2 = RGB2 + 4 * idx;
+
+            out[0] = Converter<outBD>::CastValue(rgb2[0]);
+            out[1] = Converter<outBD>::CastValue(rgb2[1]);
+            out[2] = Converter<outBD>::CastValue(rgb2[2]);
+            out[3] = Converter<outBD>::CastValue(rgb2[3]);
+
+            out += 4;
+        }
     }
 }
 
@@ -1413,6 +2048,8 @@ void InvLut1DRendererHalfCode<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & l
         }
     }
 
+    BuildIndices(hasSingleLut, true, this->m_paramsR, this->m_paramsG, this->m_paramsB);
+
     const float outMax = (float)GetBitDepthMaxValue(outBD);
 
     this->m_alphaScaling = outMax / (float)GetBitDepthMaxValue(inBD);
@@ -1455,12 +2092,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                                  this->m_paramsR.lutEnd,
                                  this->m_paramsR.flipSign,
                                  this->m_scale,
+                                 this->m_paramsR.index,
                                  redIn) 
                 : FindLutInvHalf(this->m_paramsR.negLutStart,
                                  this->m_paramsR.negStartOffset,
                                  this->m_paramsR.negLutEnd,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
+                                 this->m_paramsR.negIndex,
                                  redIn);
 
         const float grnIn = in[1];
@@ -1471,12 +2110,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                                  this->m_paramsG.lutEnd,
                                  this->m_paramsG.flipSign,
                                  this->m_scale,
+                                 this->m_paramsG.index,
                                  grnIn) 
                 : FindLutInvHalf(this->m_paramsG.negLutStart,
                                  this->m_paramsG.negStartOffset,
                                  this->m_paramsG.negLutEnd,
                                  -this->m_paramsG.flipSign,
                                  this->m_scale,
+                                 this->m_paramsG.negIndex,
                                  grnIn);
 
         const float bluIn = in[2];
@@ -1487,12 +2128,14 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
                                  this->m_paramsB.lutEnd,
                                  this->m_paramsB.flipSign,
                                  this->m_scale,
+                                 this->m_paramsB.index,
                                  bluIn)
                 : FindLutInvHalf(this->m_paramsB.negLutStart,
                                  this->m_paramsB.negStartOffset,
                                  this->m_paramsB.negLutEnd,
                                  -this->m_paramsR.flipSign,
                                  this->m_scale,
+                                 this->m_paramsB.negIndex,
                                  bluIn);
 
         out[0] = Converter<outBD>::CastValue(redOut);
@@ -1525,76 +2168,93 @@ void InvLut1DRendererHalfCodeHueAdjust<inBD, outBD>::apply(const void * inImg, v
     const bool grnIsIncreasing = this->m_paramsG.flipSign > 0.f;
     const bool bluIsIncreasing = this->m_paramsB.flipSign > 0.f;
 
-    for(long idx=0; idx<numPixels; ++idx)
-    {
-        const float RGB[] = {(float)in[0], (float)in[1], (float)in[2]};
-
-        int min, mid, max;
-        GamutMapUtils::Order3( RGB, min, mid, max);
+    // The pixels before and after the LUT.
+    float RGB[4 * GamutMapUtils::BLOCK_SIZE];
+    float RGB2[4 * GamutMapUtils::BLOCK_SIZE];
 
-        const float orig_chroma = RGB[max] - RGB[min];
-        const float hue_factor 
-            = orig_chroma == 0.f ? 0.f
-                                 : (RGB[mid] - RGB[min]) / orig_chroma;
-
-        const float redOut 
-            = (redIsIncreasing == (RGB[0] >= this->m_paramsR.bisectPoint)) 
-                ? FindLutInvHalf(this->m_paramsR.lutStart,
-                                 this->m_paramsR.startOffset,
-                                 this->m_paramsR.lutEnd,
-                                 this->m_paramsR.flipSign,
-                                 this->m_scale,
-                                 RGB[0])
-                : FindLutInvHalf(this->m_paramsR.negLutStart,
-                                 this->m_paramsR.negStartOffset,
-                                 this->m_paramsR.negLutEnd,
-                                 -this->m_paramsR.flipSign,
-                                 this->m_scale,
-                                 RGB[0]);
-
-        const float grnOut 
-            = (grnIsIncreasing == (RGB[1] >= this->m_paramsG.bisectPoint)) 
-                ? FindLutInvHalf(this->m_paramsG.lutStart,
-                                 this->m_paramsG.startOffset,
-                                 this->m_paramsG.lutEnd,
-                                 this->m_paramsG.flipSign,
-                                 this->m_scale,
-                                 RGB[1]) 
-                : FindLutInvHalf(this->m_paramsG.negLutStart,
-                                 this->m_paramsG.negStartOffset,
-                                 this->m_paramsG.negLutEnd,
-                                 -this->m_paramsG.flipSign,
-                                 this->m_scale,
-                                 RGB[1]);
+    for (long blockIdx = 0; blockIdx < numPixels; blockIdx += GamutMapUtils::BLOCK_SIZE)
+    {
+        const long blockSize = std::min(numPixels - blockIdx, GamutMapUtils::BLOCK_SIZE);
 
-        const float bluOut 
-            = (bluIsIncreasing == (RGB[2] >= this->m_paramsB.bisectPoint)) 
-                ? FindLutInvHalf(this->m_paramsB.lutStart,
-                                 this->m_paramsB.startOffset,
-                                 this->m_paramsB.lutEnd,
-                                 this->m_paramsB.flipSign,
-                                 this->m_scale,
-                                 RGB[2]) 
-                : FindLutInvHalf(this->m_paramsB.negLutStart,
-                                 this->m_paramsB.negStartOffset,
-                                 this->m_paramsB.negLutEnd,
-                                 -this->m_paramsR.flipSign,
-                                 this->m_scale,
-                                 RGB[2]);
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            float * rgb  = RGB  + 4 * idx;
+            float * rgb2 = RGB2 + 4 * idx;
+
+            rgb[0] = (float)in[0];
+            rgb[1] = (float)in[1];
+            rgb[2] = (float)in[2];
+            rgb[3] = 0.f;
+
+            rgb2[0]
+                = (redIsIncreasing == (rgb[0] >= this->m_paramsR.bisectPoint)) 
+                    ? FindLutInvHalf(this->m_paramsR.lutStart,
+                                     this->m_paramsR.startOffset,
+                                     this->m_paramsR.lutEnd,
+                                     this->m_paramsR.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsR.index,
+                                     rgb[0])
+                    : FindLutInvHalf(this->m_paramsR.negLutStart,
+                                     this->m_paramsR.negStartOffset,
+                                     this->m_paramsR.negLutEnd,
+                                     -this->m_paramsR.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsR.negIndex,
+                                     rgb[0]);
+
+            rgb2[1]
+                = (grnIsIncreasing == (rgb[1] >= this->m_paramsG.bisectPoint)) 
+                    ? FindLutInvHalf(this->m_paramsG.lutStart,
+                                     this->m_paramsG.startOffset,
+                                     this->m_paramsG.lutEnd,
+                                     this->m_paramsG.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsG.index,
+                                     rgb[1]) 
+                    : FindLutInvHalf(this->m_paramsG.negLutStart,
+                                     this->m_paramsG.negStartOffset,
+                                     this->m_paramsG.negLutEnd,
+                                     -this->m_paramsG.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsG.negIndex,
+                                     rgb[1]);
+
+            rgb2[2]
+                = (bluIsIncreasing == (rgb[2] >= this->m_paramsB.bisectPoint)) 
+                    ? FindLutInvHalf(this->m_paramsB.lutStart,
+                                     this->m_paramsB.startOffset,
+                                     this->m_paramsB.lutEnd,
+                                     this->m_paramsB.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsB.index,
+                                     rgb[2]) 
+                    : FindLutInvHalf(this->m_paramsB.negLutStart,
+                                     this->m_paramsB.negStartOffset,
+                                     this->m_paramsB.negLutEnd,
+                                     -this->m_paramsR.flipSign,
+                                     this->m_scale,
+                                     this->m_paramsB.negIndex,
+                                     rgb[2]);
+
+            rgb2[3] = in[3] * this->m_alphaScaling;
 
-        float RGB2[] = { redOut, grnOut, bluOut };
+            in  += 4;
+        }
 
-        const float new_chroma = RGB2[max] - RGB2[min];
+        GamutMapUtils::HueAdjust(RGB, RGB2, blockSize);
 
-        RGB2[mid] = hue_factor * new_chroma + RGB2[min];
+        for(long idx=0; idx<blockSize; ++idx)
+        {
+            const float * rgb2 = RGB2 + 4 * idx;
 
-        out[0] = Converter<outBD>::CastValue(RGB2[0]);
-        out[1] = Converter<outBD>::CastValue(RGB2[1]);
-        out[2] = Converter<outBD>::CastValue(RGB2[2]);
-        out[3] = Converter<outBD>::CastValue(in[3] * this->m_alphaScaling);
+            out[0] = Converter<outBD>::CastValue(rgb2[0]);
+            out[1] = Converter<outBD>::CastValue(rgb2[1]);
+            out[2] = Converter<outBD>::CastValue(rgb2[2]);
+            out[3] = Converter<outBD>::CastValue(rgb2[3]);
 
-        in  += 4;
-        out += 4;
+            out += 4;
+        }
     }
 }
 
@@ -1607,6 +2267,13 @@ OpCPURcPtr GetForwardLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     {
         if (lut->getHueAdjust() == HUE_NONE)
         {
+#ifdef USE_SSE
+            if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32
+                && Lut1DRendererHalfCodeAVX2::IsSupported())
+            {
+                return std::make_shared<Lut1DRendererHalfCodeAVX2>(lut);
+            }
+#endif
             return std::make_shared< Lut1DRendererHalfCode<inBD, outBD> >(lut);
         }
         else
@@ -1662,6 +2329,13 @@ ConstOpCPURcPtr GetLut1DRenderer_OutBitDepth(ConstLut1DOpDataRcPtr & lut)
             {
                 if (lut->getHueAdjust() == HUE_NONE)
                 {
+#ifdef USE_SSE
+                    if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32
+                        && InvLut1DRendererAVX2::IsSupported())
+                    {
+                        return std::make_shared<InvLut1DRendererAVX2>(lut);
+                    }
+#endif
                     return std::make_shared< InvLut1DRenderer<inBD, outBD> >(lut);
                 }
                 else
@@ -550,14 +550,22 @@ void Lut1DOpData::finalize()
     md5_state_t state;
     md5_byte_t digest[16];
 
+    // Read the values through the const accessor not to copy the shared values.
+    const Array::Values & values = static_cast<const Array &>(getArray()).getValues();
+
     md5_init(&state);
     md5_append(&state,
-        (const md5_byte_t *)&(getArray().getValues()[0]),
-        (int)(getArray().getValues().size() * sizeof(float)));
+        (const md5_byte_t *)&(values[0]),
+        (int)(values.size() * sizeof(float)));
     md5_finish(&state, digest);
 
+    const std::string hash = GetPrintableHash(digest);
+
+    // Share the values with the other LUTs having the same values.
+    getArray().internValues(hash);
+
     std::ostringstream cacheIDStream;
-    cacheIDStream << GetPrintableHash(digest) << " ";
+    cacheIDStream << hash << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
     cacheIDStream << InterpolationToString(m_interpolation) << " ";
     cacheIDStream << (isInputHalfDomain()?"half domain ":"standard domain ");
@@ -833,7 +841,9 @@ void Lut1DOpData::prepareArray()
     const unsigned long length = getArray().getLength();
     const unsigned long maxChannels = getArray().getMaxColorComponents();
     const unsigned long activeChannels = getArray().getNumColorComponents();
-    Array::Values& values = getArray().getValues();
+    // The values are only modified (i.e. copied if they are shared with other LUTs) when
+    // there are reversals to flatten.
+    const Array & array = getArray();
 
     for (unsigned long c = 0; c < activeChannels; ++c)
     {
@@ -854,7 +864,7 @@ void Lut1DOpData::prepareArray()
 
         {
             m_componentProperties[c].isIncreasing
-                = (values[lowInd] < values[highInd]);
+                = (array[lowInd] < array[highInd]);
         }
 
         // Flatten reversals.
@@ -865,18 +875,18 @@ void Lut1DOpData::prepareArray()
 
             if (!isInputHalfDomain())
             {
-                float prevValue = values[c];
+                float prevValue = array[c];
                 for (unsigned long idx = c + maxChannels;
                      idx < length * maxChannels;
                      idx += maxChannels)
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
+                    if (isIncreasing != (array[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        getArray()[idx] = prevValue;
                     }
                     else
                     {
-                        prevValue = values[idx];
+                        prevValue = array[idx];
                     }
                 }
             }
@@ -885,18 +895,18 @@ void Lut1DOpData::prepareArray()
                 // Do positive numbers.
                 unsigned long startInd = 0u * maxChannels + c; // 0 == +zero
                 unsigned long endInd = 31744u * maxChannels;   // 31744 == +infinity
-                float prevValue = values[startInd];
+                float prevValue = array[startInd];
                 for (unsigned long idx = startInd + maxChannels;
                      idx <= endInd;
                      idx += maxChannels)
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
+                    if (isIncreasing != (array[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        getArray()[idx] = prevValue;
                     }
                     else
                     {
-                        prevValue = values[idx];
+                        prevValue = array[idx];
                     }
                 }
 
@@ -904,16 +914,16 @@ void Lut1DOpData::prepareArray()
                 isIncreasing = !isIncreasing;
                 startInd = 32768u * maxChannels + c;      // 32768 == -zero
                 endInd = 64512u * maxChannels;            // 64512 == -infinity
-                prevValue = values[c];  // prev value for -0 is +0 (disallow overlaps)
+                prevValue = array[c];  // prev value for -0 is +0 (disallow overlaps)
                 for (unsigned long idx = startInd; idx <= endInd; idx += maxChannels)
                 {
-                    if (isIncreasing != (values[idx] > prevValue))
+                    if (isIncreasing != (array[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        getArray()[idx] = prevValue;
                     }
                     else
                     {
-                        prevValue = values[idx];
+                        prevValue = array[idx];
                     }
                 }
             }
@@ -927,19 +937,19 @@ void Lut1DOpData::prepareArray()
             if (!isInputHalfDomain())
             {
                 unsigned long endDomain = length - 1;
-                const float endValue = values[endDomain * maxChannels + c];
+                const float endValue = array[endDomain * maxChannels + c];
                 while (endDomain > 0
-                    && values[(endDomain - 1) * maxChannels + c] == endValue)
+                    && array[(endDomain - 1) * maxChannels + c] == endValue)
                 {
                     --endDomain;
                 }
 
                 unsigned long startDomain = 0;
-                const float startValue = values[startDomain * maxChannels + c];
+                const float startValue = array[startDomain * maxChannels + c];
                 // Note that this works for both increasing and decreasing LUTs
                 // since there is no reqmt that startValue < endValue.
                 while (startDomain < endDomain
-                    &&  values[(startDomain + 1) * maxChannels + c] == startValue)
+                    &&  array[(startDomain + 1) * maxChannels + c] == startValue)
                 {
                     ++startDomain;
                 }
@@ -961,19 +971,19 @@ void Lut1DOpData::prepareArray()
                 // a NaN. Limiting the effective domain allows 65504 to invert
                 // correctly.
                 unsigned long endDomain = 31743u;    // +65504 = largest half value < inf
-                const float endValue = values[endDomain * maxChannels + c];
+                const float endValue = array[endDomain * maxChannels + c];
                 while (endDomain > 0
-                    && values[(endDomain - 1) * maxChannels + c] == endValue)
+                    && array[(endDomain - 1) * maxChannels + c] == endValue)
                 {
                     --endDomain;
                 }
 
                 unsigned long startDomain = 0;       // positive zero
-                const float startValue = values[startDomain * maxChannels + c];
+                const float startValue = array[startDomain * maxChannels + c];
                 // Note that this works for both increasing and decreasing LUTs
                 // since there is no reqmt that startValue < endValue.
                 while (startDomain < endDomain
-                    &&  values[(startDomain + 1) * maxChannels + c] == startValue)
+                    &&  array[(startDomain + 1) * maxChannels + c] == startValue)
                 {
                     ++startDomain;
                 }
@@ -983,17 +993,17 @@ void Lut1DOpData::prepareArray()
 
                 // Negative half of domain has its own start/end.
                 unsigned long negEndDomain = 64511u;  // -65504 = last value before neg inf
-                const float negEndValue = values[negEndDomain * maxChannels + c];
+                const float negEndValue = array[negEndDomain * maxChannels + c];
                 while (negEndDomain > 32768u     // negative zero
-                    && values[(negEndDomain - 1) * maxChannels + c] == negEndValue)
+                    && array[(negEndDomain - 1) * maxChannels + c] == negEndValue)
                 {
                     --negEndDomain;
                 }
 
                 unsigned long negStartDomain = 32768u; // negative zero
-                const float negStartValue = values[negStartDomain * maxChannels + c];
+                const float negStartValue = array[negStartDomain * maxChannels + c];
                 while (negStartDomain < negEndDomain
-                    && values[(negStartDomain + 1) * maxChannels + c] == negStartValue)
+                    && array[(negStartDomain + 1) * maxChannels + c] == negStartValue)
                 {
                     ++negStartDomain;
                 }
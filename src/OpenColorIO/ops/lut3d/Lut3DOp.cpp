@@ -17,6 +17,7 @@
 #include "ops/lut3d/Lut3DOpGPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/OpTools.h"
+#include "ops/range/RangeOp.h"
 #include "transforms/Lut3DTransform.h"
 
 namespace OCIO_NAMESPACE
@@ -163,12 +164,15 @@ public:
     Lut3DOp() = delete;
     Lut3DOp(const Lut3DOp &) = delete;
     explicit Lut3DOp(Lut3DOpDataRcPtr & data);
+    Lut3DOp(Lut3DOpDataRcPtr & data, const OpRcPtrVec & preOps, const OpRcPtrVec & postOps);
     virtual ~Lut3DOp();
 
     OpRcPtr clone() const override;
 
     std::string getInfo() const override;
 
+    bool isNoOp() const override;
+    bool isIdentity() const override;
     bool isSameType(ConstOpRcPtr & op) const override;
     bool isInverse(ConstOpRcPtr & op) const override;
     bool canCombineWith(ConstOpRcPtr & op) const override;
@@ -176,11 +180,16 @@ public:
     bool hasChannelCrosstalk() const override;
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     bool supportedByLegacyShader() const override { return false; }
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
+    bool hasFusedOps() const { return !m_preOps.empty() || !m_postOps.empty(); }
+
+    const OpRcPtrVec & getPreOps() const { return m_preOps; }
+    const OpRcPtrVec & getPostOps() const { return m_postOps; }
+
 #ifdef OCIO_UNIT_TEST
     Array & getArray()
     {
@@ -198,6 +207,12 @@ protected:
     { 
         return DynamicPtrCast<Lut3DOpData>(data());
     }
+
+private:
+    // Matrix and range ops fused into the input and output of the LUT
+    // (see OPTIMIZATION_FUSE_LUT3D_STAGES).
+    OpRcPtrVec m_preOps;
+    OpRcPtrVec m_postOps;
 };
 
 typedef OCIO_SHARED_PTR<Lut3DOp> Lut3DOpRcPtr;
@@ -208,6 +223,20 @@ Lut3DOp::Lut3DOp(Lut3DOpDataRcPtr & lut3D)
     data() = lut3D;
 }
 
+Lut3DOp::Lut3DOp(Lut3DOpDataRcPtr & lut3D, const OpRcPtrVec & preOps, const OpRcPtrVec & postOps)
+{
+    data() = lut3D;
+
+    for (const auto & op : preOps)
+    {
+        m_preOps.push_back(op->clone());
+    }
+    for (const auto & op : postOps)
+    {
+        m_postOps.push_back(op->clone());
+    }
+}
+
 Lut3DOp::~Lut3DOp()
 {
 }
@@ -215,7 +244,7 @@ Lut3DOp::~Lut3DOp()
 OpRcPtr Lut3DOp::clone() const
 {
     Lut3DOpDataRcPtr lut = lut3DData()->clone();
-    return std::make_shared<Lut3DOp>(lut);
+    return std::make_shared<Lut3DOp>(lut, m_preOps, m_postOps);
 }
 
 std::string Lut3DOp::getInfo() const
@@ -223,6 +252,16 @@ std::string Lut3DOp::getInfo() const
     return "<Lut3DOp>";
 }
 
+bool Lut3DOp::isNoOp() const
+{
+    return !hasFusedOps() && Op::isNoOp();
+}
+
+bool Lut3DOp::isIdentity() const
+{
+    return !hasFusedOps() && Op::isIdentity();
+}
+
 bool Lut3DOp::isSameType(ConstOpRcPtr & op) const
 {
     return op->data()->getType() == OpData::Lut3DType;
@@ -231,7 +270,7 @@ bool Lut3DOp::isSameType(ConstOpRcPtr & op) const
 bool Lut3DOp::isInverse(ConstOpRcPtr & op) const
 {
     ConstLut3DOpRcPtr typedRcPtr = DynamicPtrCast<const Lut3DOp>(op);
-    if (typedRcPtr)
+    if (typedRcPtr && !hasFusedOps() && !typedRcPtr->hasFusedOps())
     {
         ConstLut3DOpDataRcPtr lutData = typedRcPtr->lut3DData();
         return lut3DData()->isInverse(lutData);
@@ -242,12 +281,13 @@ bool Lut3DOp::isInverse(ConstOpRcPtr & op) const
 
 bool Lut3DOp::canCombineWith(ConstOpRcPtr & op) const
 {
-    if (isSameType(op))
+    if (isSameType(op) && !hasFusedOps())
     {
         if (lut3DData()->getDirection() == TRANSFORM_DIR_FORWARD)
         {
             ConstLut3DOpRcPtr typedRcPtr = DynamicPtrCast<const Lut3DOp>(op);
-            if (typedRcPtr->lut3DData()->getDirection() == TRANSFORM_DIR_FORWARD)
+            if (typedRcPtr->lut3DData()->getDirection() == TRANSFORM_DIR_FORWARD
+                && !typedRcPtr->hasFusedOps())
             {
                 return true;
             }
@@ -276,7 +316,21 @@ void Lut3DOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
 
 bool Lut3DOp::hasChannelCrosstalk() const
 {
-    return lut3DData()->hasChannelCrosstalk();
+    if (lut3DData()->hasChannelCrosstalk())
+    {
+        return true;
+    }
+
+    for (const auto & op : m_preOps)
+    {
+        if (op->hasChannelCrosstalk()) return true;
+    }
+    for (const auto & op : m_postOps)
+    {
+        if (op->hasChannelCrosstalk()) return true;
+    }
+
+    return false;
 }
 
 void Lut3DOp::finalize(OptimizationFlags oFlags)
@@ -291,19 +345,52 @@ void Lut3DOp::finalize(OptimizationFlags oFlags)
     std::ostringstream cacheIDStream;
     cacheIDStream << "<Lut3D ";
     cacheIDStream << lutData->getCacheID() << " ";
+
+    for (auto & op : m_preOps)
+    {
+        op->finalize(oFlags);
+        cacheIDStream << "pre " << op->getCacheID() << " ";
+    }
+    for (auto & op : m_postOps)
+    {
+        op->finalize(oFlags);
+        cacheIDStream << "post " << op->getCacheID() << " ";
+    }
+
     cacheIDStream << ">";
 
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr Lut3DOp::getCPUOp() const
+ConstOpCPURcPtr Lut3DOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     ConstLut3DOpDataRcPtr data = lut3DData();
-    return GetLut3DRenderer(data);
+    if (!hasFusedOps())
+    {
+        return GetLut3DRenderer(data);
+    }
+
+    ConstOpDataVec preOps;
+    for (ConstOpRcPtr op : m_preOps)
+    {
+        preOps.push_back(op->data());
+    }
+    ConstOpDataVec postOps;
+    for (ConstOpRcPtr op : m_postOps)
+    {
+        postOps.push_back(op->data());
+    }
+
+    return GetLut3DRenderer(data, preOps, postOps);
 }
 
 void Lut3DOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
 {
+    for (const auto & op : m_preOps)
+    {
+        op->extractGpuShaderInfo(shaderDesc);
+    }
+
     ConstLut3DOpDataRcPtr lutData = lut3DData();
     if (lutData->getDirection() == TRANSFORM_DIR_INVERSE)
     {
@@ -321,6 +408,23 @@ void Lut3DOp::extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const
     }
 
     GetLut3DGPUShaderProgram(shaderDesc, lutData);
+
+    for (const auto & op : m_postOps)
+    {
+        op->extractGpuShaderInfo(shaderDesc);
+    }
+}
+
+void CreateFusedTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op)
+{
+    if (op->data()->getType() == OpData::MatrixType)
+    {
+        CreateMatrixTransform(group, op);
+    }
+    else
+    {
+        CreateRangeTransform(group, op);
+    }
 }
 }
 
@@ -341,6 +445,54 @@ void CreateLut3DOp(OpRcPtrVec & ops, Lut3DOpDataRcPtr & lut, TransformDirection
     }
 }
 
+void CreateFusedLut3DOp(OpRcPtrVec & ops,
+                        ConstOpRcPtr & lut,
+                        const OpRcPtrVec & preOps,
+                        const OpRcPtrVec & postOps)
+{
+    auto lutOp = DynamicPtrCast<const Lut3DOp>(lut);
+    if (!lutOp)
+    {
+        throw Exception("CreateFusedLut3DOp: op has to be a Lut3DOp");
+    }
+    if (lutOp->hasFusedOps())
+    {
+        throw Exception("CreateFusedLut3DOp: the Lut3DOp already has fused ops");
+    }
+
+    auto lutData = DynamicPtrCast<const Lut3DOpData>(lut->data());
+    if (lutData->getDirection() != TRANSFORM_DIR_FORWARD)
+    {
+        throw Exception("CreateFusedLut3DOp: the Lut3DOp has to be forward");
+    }
+
+    for (ConstOpRcPtr op : preOps)
+    {
+        const OpData::Type type = op->data()->getType();
+        if (type != OpData::MatrixType && type != OpData::RangeType)
+        {
+            throw Exception("CreateFusedLut3DOp: only matrix and range ops can be fused");
+        }
+    }
+    for (ConstOpRcPtr op : postOps)
+    {
+        const OpData::Type type = op->data()->getType();
+        if (type != OpData::MatrixType && type != OpData::RangeType)
+        {
+            throw Exception("CreateFusedLut3DOp: only matrix and range ops can be fused");
+        }
+    }
+
+    Lut3DOpDataRcPtr data = lutData->clone();
+    ops.push_back(std::make_shared<Lut3DOp>(data, preOps, postOps));
+}
+
+bool HasFusedLut3DOps(ConstOpRcPtr & op)
+{
+    auto lutOp = DynamicPtrCast<const Lut3DOp>(op);
+    return lutOp && lutOp->hasFusedOps();
+}
+
 void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op)
 {
     auto lut = DynamicPtrCast<const Lut3DOp>(op);
@@ -348,6 +500,12 @@ void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op)
     {
         throw Exception("CreateLut3DTransform: op has to be a Lut3DOp");
     }
+
+    for (const auto & fusedOp : lut->getPreOps())
+    {
+        ConstOpRcPtr constOp = fusedOp;
+        CreateFusedTransform(group, constOp);
+    }
     auto lutData = DynamicPtrCast<const Lut3DOpData>(op->data());
     auto lutTransform = Lut3DTransform::Create();
     Lut3DOpData & data = dynamic_cast<Lut3DTransformImpl*>(lutTransform.get())->data();
@@ -355,6 +513,12 @@ void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op)
     data = *lutData;
 
     group->appendTransform(lutTransform);
+
+    for (const auto & fusedOp : lut->getPostOps())
+    {
+        ConstOpRcPtr constOp = fusedOp;
+        CreateFusedTransform(group, constOp);
+    }
 }
 
 void BuildLut3DOp(OpRcPtrVec & ops,
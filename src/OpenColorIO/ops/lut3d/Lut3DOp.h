@@ -54,7 +54,20 @@ void CreateLut3DOp(OpRcPtrVec & ops,
                     Lut3DOpDataRcPtr & lut,
                     TransformDirection direction);
 
+// Create a forward Lut3DOp (copy of the Lut3DOp lut) which also applies the matrix and range
+// ops of preOps before the LUT and the ones of postOps after the LUT in a single pass over the
+// pixels (see OPTIMIZATION_FUSE_LUT3D_STAGES).  Each list holds any number of matrix ops not
+// modifying alpha followed by at most one range op.
+void CreateFusedLut3DOp(OpRcPtrVec & ops,
+                        ConstOpRcPtr & lut,
+                        const OpRcPtrVec & preOps,
+                        const OpRcPtrVec & postOps);
+
+// True if the op is a Lut3DOp with fused matrix or range ops.
+bool HasFusedLut3DOps(ConstOpRcPtr & op);
+
 // Create a Lut3DTransform decoupled from op and append it to the GroupTransform.
+// Note: The fused ops are appended as matrix and range transforms.
 void CreateLut3DTransform(GroupTransformRcPtr & group, ConstOpRcPtr & op);
 
 } // namespace OCIO_NAMESPACE
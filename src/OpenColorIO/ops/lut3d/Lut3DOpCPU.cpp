@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <limits>
 #include <math.h>
 #include <stdint.h>
 #include <vector>
@@ -11,7 +12,9 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
+#include "ops/matrix/MatrixOpData.h"
 #include "ops/OpTools.h"
+#include "ops/range/RangeOpData.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -20,12 +23,166 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// A matrix with offsets followed by a clamp, applied to the RGB channels.  It holds the
+// matrix and range ops fused into the input or output of a forward 3D LUT.
+class FusedStage
+{
+public:
+    FusedStage() = default;
+
+    // Fold the matrix and range ops (in that order) into the stage.
+    void fold(const ConstOpDataVec & ops);
+
+    bool isEnabled() const { return m_enabled; }
+
+    inline void apply(const float * in, float * out) const
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        // NaNs become m_lowerBound.
+        out[0] = Clamp(m_matrix[0] * r + m_matrix[1] * g + m_matrix[2] * b + m_offsets[0],
+                       m_lowerBound, m_upperBound);
+        out[1] = Clamp(m_matrix[3] * r + m_matrix[4] * g + m_matrix[5] * b + m_offsets[1],
+                       m_lowerBound, m_upperBound);
+        out[2] = Clamp(m_matrix[6] * r + m_matrix[7] * g + m_matrix[8] * b + m_offsets[2],
+                       m_lowerBound, m_upperBound);
+    }
+
+#ifdef USE_SSE
+    // Load the stage in SSE registers.
+    void load(__m128 * regs) const
+    {
+        regs[0] = _mm_set_ps(0.0f, m_matrix[6], m_matrix[3], m_matrix[0]);
+        regs[1] = _mm_set_ps(0.0f, m_matrix[7], m_matrix[4], m_matrix[1]);
+        regs[2] = _mm_set_ps(0.0f, m_matrix[8], m_matrix[5], m_matrix[2]);
+        regs[3] = _mm_set_ps(0.0f, m_offsets[2], m_offsets[1], m_offsets[0]);
+        regs[4] = _mm_set1_ps(m_lowerBound);
+        regs[5] = _mm_set1_ps(m_upperBound);
+    }
+
+    // Apply the stage loaded by load() to the RGB channels (the alpha channel is lost).
+    static inline __m128 Apply(const __m128 * regs, __m128 rgba)
+    {
+        const __m128 r = _mm_shuffle_ps(rgba, rgba, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 g = _mm_shuffle_ps(rgba, rgba, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 b = _mm_shuffle_ps(rgba, rgba, _MM_SHUFFLE(2, 2, 2, 2));
+
+        __m128 res = _mm_add_ps(_mm_add_ps(_mm_mul_ps(regs[0], r), _mm_mul_ps(regs[1], g)),
+                                _mm_add_ps(_mm_mul_ps(regs[2], b), regs[3]));
+
+        // NaNs become the lower bound.
+        res = _mm_max_ps(res, regs[4]);
+        return _mm_min_ps(res, regs[5]);
+    }
+#endif
+
+private:
+    bool  m_enabled = false;
+    float m_matrix[9] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    float m_offsets[3] = { 0.0f, 0.0f, 0.0f };
+    float m_lowerBound = -std::numeric_limits<float>::infinity();
+    float m_upperBound = std::numeric_limits<float>::infinity();
+};
+
+void FusedStage::fold(const ConstOpDataVec & ops)
+{
+    // Compose in double precision.
+    double matrix[9] = { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+    double offsets[3] = { 0.0, 0.0, 0.0 };
+    bool clamps = false;
+
+    for (const auto & op : ops)
+    {
+        if (clamps)
+        {
+            throw Exception("Lut3D renderer: only a range can end a fused stage.");
+        }
+
+        if (op->getType() == OpData::MatrixType)
+        {
+            ConstMatrixOpDataRcPtr mat = DynamicPtrCast<const MatrixOpData>(op);
+            if (mat->hasAlpha())
+            {
+                throw Exception("Lut3D renderer: a fused matrix can not modify alpha.");
+            }
+
+            const ArrayDouble::Values & m = mat->getArray().getValues();
+            const MatrixOpData::Offsets & o = mat->getOffsets();
+
+            double res[9];
+            double resOffsets[3];
+            for (int row = 0; row < 3; ++row)
+            {
+                for (int col = 0; col < 3; ++col)
+                {
+                    res[row * 3 + col] = m[row * 4 + 0] * matrix[0 * 3 + col]
+                                       + m[row * 4 + 1] * matrix[1 * 3 + col]
+                                       + m[row * 4 + 2] * matrix[2 * 3 + col];
+                }
+                resOffsets[row] = m[row * 4 + 0] * offsets[0]
+                                + m[row * 4 + 1] * offsets[1]
+                                + m[row * 4 + 2] * offsets[2]
+                                + o[row];
+            }
+
+            std::copy(res, res + 9, matrix);
+            std::copy(resOffsets, resOffsets + 3, offsets);
+        }
+        else if (op->getType() == OpData::RangeType)
+        {
+            ConstRangeOpDataRcPtr range = DynamicPtrCast<const RangeOpData>(op);
+
+            const double scale  = range->getScale();
+            const double offset = range->getOffset();
+
+            for (int idx = 0; idx < 9; ++idx)
+            {
+                matrix[idx] *= scale;
+            }
+            for (int idx = 0; idx < 3; ++idx)
+            {
+                offsets[idx] = offsets[idx] * scale + offset;
+            }
+
+            if (!range->minIsEmpty())
+            {
+                m_lowerBound = (float)range->getMinOutValue();
+            }
+            if (!range->maxIsEmpty())
+            {
+                m_upperBound = (float)range->getMaxOutValue();
+            }
+
+            clamps = true;
+        }
+        else
+        {
+            throw Exception("Lut3D renderer: only matrix and range ops can be fused.");
+        }
+
+        m_enabled = true;
+    }
+
+    for (int idx = 0; idx < 9; ++idx)
+    {
+        m_matrix[idx] = (float)matrix[idx];
+    }
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        m_offsets[idx] = (float)offsets[idx];
+    }
+}
+
 class BaseLut3DRenderer : public OpCPU
 {
 public:
     explicit BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~BaseLut3DRenderer();
 
+    void setFusedStages(const ConstOpDataVec & preOps, const ConstOpDataVec & postOps);
+
 protected:
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
@@ -41,6 +198,10 @@ protected:
     unsigned long m_dim;
     float         m_step;
 
+    // Optional matrix & range ops applied before and after the LUT.
+    FusedStage    m_preStage;
+    FusedStage    m_postStage;
+
 private:
     BaseLut3DRenderer() = delete;
     BaseLut3DRenderer(const BaseLut3DRenderer&) = delete;
@@ -325,6 +486,13 @@ void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_optLut = createOptLut(lut->getArray().getValues());
 }
 
+void BaseLut3DRenderer::setFusedStages(const ConstOpDataVec & preOps,
+                                       const ConstOpDataVec & postOps)
+{
+    m_preStage.fold(preOps);
+    m_postStage.fold(postOps);
+}
+
 #ifdef USE_SSE
 // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
 // in order to be able to load the LUT using _mm_load_ps.
@@ -391,12 +559,24 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
     __m128 v[4];
     OCIO_ALIGN(float cmpDelta[4]);
 
+    __m128 preStage[6];
+    __m128 postStage[6];
+    m_preStage.load(preStage);
+    m_postStage.load(postStage);
+    const bool hasPreStage  = m_preStage.isEnabled();
+    const bool hasPostStage = m_postStage.isEnabled();
+
     for (long i = 0; i < numPixels; ++i)
     {
         float newAlpha = (float)in[3];
 
         __m128 data = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
+        if (hasPreStage)
+        {
+            data = FusedStage::Apply(preStage, data);
+        }
+
         __m128 idx = _mm_mul_ps(data, step);
 
         idx = _mm_max_ps(idx, EZERO);  // NaNs become 0
@@ -582,6 +762,11 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
         __m128 result = _mm_add_ps(_mm_add_ps(v[0], _mm_mul_ps(delta0, dv0)),
             _mm_add_ps(_mm_mul_ps(delta1, dv1), _mm_mul_ps(delta2, dv2)));
 
+        if (hasPostStage)
+        {
+            result = FusedStage::Apply(postStage, result);
+        }
+
         _mm_storeu_ps(out, result);
 
         out[3] = newAlpha;
@@ -596,10 +781,16 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
     {
         float newAlpha = (float)in[3];
 
+        float rgb[3] = { in[0], in[1], in[2] };
+        if (m_preStage.isEnabled())
+        {
+            m_preStage.apply(in, rgb);
+        }
+
         float idx[3];
-        idx[0] = in[0] * m_step;
-        idx[1] = in[1] * m_step;
-        idx[2] = in[2] * m_step;
+        idx[0] = rgb[0] * m_step;
+        idx[1] = rgb[1] * m_step;
+        idx[2] = rgb[2] * m_step;
 
         // NaNs become 0.
         idx[0] = Clamp(idx[0], 0.f, dimMinusOne);
@@ -775,6 +966,11 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
             }
         }
 
+        if (m_postStage.isEnabled())
+        {
+            m_postStage.apply(out, out);
+        }
+
         out[3] = newAlpha;
 
         in  += 4;
@@ -805,12 +1001,24 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 
     __m128 v[8];
 
+    __m128 preStage[6];
+    __m128 postStage[6];
+    m_preStage.load(preStage);
+    m_postStage.load(postStage);
+    const bool hasPreStage  = m_preStage.isEnabled();
+    const bool hasPostStage = m_postStage.isEnabled();
+
     for (long i = 0; i < numPixels; ++i)
     {
         float newAlpha = (float)in[3];
 
         __m128 data = _mm_set_ps(in[3], in[2], in[1], in[0]);
 
+        if (hasPreStage)
+        {
+            data = FusedStage::Apply(preStage, data);
+        }
+
         __m128 idx = _mm_mul_ps(data, step);
 
         idx = _mm_max_ps(idx, EZERO);  // NaNs become 0
@@ -890,6 +1098,11 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         __m128 result = _mm_add_ps(_mm_mul_ps(green1, oneMinusWr),
             _mm_mul_ps(green2, wr));
 
+        if (hasPostStage)
+        {
+            result = FusedStage::Apply(postStage, result);
+        }
+
         _mm_storeu_ps(out, result);
 
         out[3] = newAlpha;
@@ -904,10 +1117,16 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     {
         float newAlpha = (float)in[3];
 
+        float rgb[3] = { in[0], in[1], in[2] };
+        if (m_preStage.isEnabled())
+        {
+            m_preStage.apply(in, rgb);
+        }
+
         float idx[3];
-        idx[0] = in[0] * m_step;
-        idx[1] = in[1] * m_step;
-        idx[2] = in[2] * m_step;
+        idx[0] = rgb[0] * m_step;
+        idx[1] = rgb[1] * m_step;
+        idx[2] = rgb[2] * m_step;
 
         // NaNs become 0.
         idx[0] = Clamp(idx[0], 0.f, dimMinusOne);
@@ -971,6 +1190,11 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
                  &m_optLut[n110], &m_optLut[n111],
                  x, y, z);
 
+        if (m_postStage.isEnabled())
+        {
+            m_postStage.apply(out, out);
+        }
+
         out[3] = newAlpha;
 
         in  += 4;
@@ -1931,5 +2155,29 @@ ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     }
 }
 
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut,
+                                 const ConstOpDataVec & preOps,
+                                 const ConstOpDataVec & postOps)
+{
+    if (lut->getDirection() != TRANSFORM_DIR_FORWARD)
+    {
+        throw Exception("Lut3D renderer: only a forward LUT can have fused ops.");
+    }
+
+    const Interpolation interp = lut->getConcreteInterpolation();
+    if (interp == INTERP_TETRAHEDRAL)
+    {
+        auto renderer = std::make_shared<Lut3DTetrahedralRenderer>(lut);
+        renderer->setFusedStages(preOps, postOps);
+        return renderer;
+    }
+    else
+    {
+        auto renderer = std::make_shared<Lut3DRenderer>(lut);
+        renderer->setFusedStages(preOps, postOps);
+        return renderer;
+    }
+}
+
 } // namespace OCIO_NAMESPACE
 
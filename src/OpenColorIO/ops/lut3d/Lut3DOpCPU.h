@@ -14,6 +14,13 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
 
+// Same as above for a forward LUT but the matrix and range ops of preOps (resp. postOps) are
+// applied before (resp. after) the LUT within the same pixel loop.  Each list holds any number
+// of matrices (not modifying alpha) followed by at most one range.
+ConstOpCPURcPtr GetLut3DRenderer(ConstLut3DOpDataRcPtr & lut,
+                                 const ConstOpDataVec & preOps,
+                                 const ConstOpDataVec & postOps);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
\ No newline at end of file
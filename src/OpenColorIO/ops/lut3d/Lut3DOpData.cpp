@@ -126,7 +126,7 @@ void Lut3DOpData::Compose(Lut3DOpDataRcPtr & A,
 
     A->setFileOutputBitDepth(fileOutBD);
 
-    const Array::Values& inValues = domain->getArray().getValues();
+    const Array::Values& inValues = static_cast<const Array &>(domain->getArray()).getValues();
     const long gridSize = domain->getArray().getLength();
     const long numPixels = gridSize * gridSize * gridSize;
 
@@ -463,14 +463,22 @@ void Lut3DOpData::finalize()
     md5_state_t state;
     md5_byte_t digest[16];
 
+    // Read the values through the const accessor not to copy the shared values.
+    const Array::Values & values = static_cast<const Array &>(getArray()).getValues();
+
     md5_init(&state);
     md5_append(&state,
-               (const md5_byte_t *)&(getArray().getValues()[0]),
-               (int)(getArray().getValues().size() * sizeof(float)));
+               (const md5_byte_t *)&(values[0]),
+               (int)(values.size() * sizeof(float)));
     md5_finish(&state, digest);
 
+    const std::string hash = GetPrintableHash(digest);
+
+    // Share the values with the other LUTs having the same values.
+    getArray().internValues(hash);
+
     std::ostringstream cacheIDStream;
-    cacheIDStream << GetPrintableHash(digest) << " ";
+    cacheIDStream << hash << " ";
     cacheIDStream << InterpolationToString(m_interpolation) << " ";
     cacheIDStream << TransformDirectionToString(m_direction) << " ";
     // NB: The m_invQuality is not currently included.
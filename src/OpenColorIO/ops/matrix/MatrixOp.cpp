@@ -61,7 +61,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -225,7 +225,7 @@ void MatrixOffsetOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr MatrixOffsetOp::getCPUOp() const
+ConstOpCPURcPtr MatrixOffsetOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     ConstMatrixOpDataRcPtr data = matrixData();
     return GetMatrixRenderer(data);
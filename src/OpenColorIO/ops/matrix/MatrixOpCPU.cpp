@@ -6,6 +6,7 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
+#include "ops/RendererAVX2.h"
 #include "Platform.h"
 #include "SSE.h"
 
@@ -41,6 +42,20 @@ private:
     float m_offset[4];
 };
 
+// A matrix with only offsets i.e. the diagonal is the identity.
+class OffsetRenderer : public OpCPU
+{
+public:
+    OffsetRenderer() = delete;
+    OffsetRenderer(const OffsetRenderer &) = delete;
+    explicit OffsetRenderer(ConstMatrixOpDataRcPtr & mat);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    float m_offset[4];
+};
+
 class MatrixWithOffsetRenderer : public OpCPU
 {
 public:
@@ -50,6 +65,10 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
 private:
 
     float m_column1[4];
@@ -69,6 +88,10 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
 private:
     float m_column1[4];
     float m_column2[4];
@@ -76,6 +99,109 @@ private:
     float m_column4[4];
 };
 
+#ifdef USE_SSE
+
+// A 3x3 matrix with each coefficient in all the lanes of a register, to process 4 pixels
+// at a time with each register holding one channel.
+struct SSEMatrix3x3
+{
+    SSEMatrix3x3(const float * column1, const float * column2, const float * column3)
+    {
+        for (unsigned idx = 0; idx < 3; ++idx)
+        {
+            m_column1[idx] = _mm_set1_ps(column1[idx]);
+            m_column2[idx] = _mm_set1_ps(column2[idx]);
+            m_column3[idx] = _mm_set1_ps(column3[idx]);
+        }
+    }
+
+    // The computations are done in the order of the per pixel implementations so the
+    // results are identical.
+    inline void apply(__m128 & red, __m128 & grn, __m128 & blu) const
+    {
+        const __m128 r = red;
+        const __m128 g = grn;
+        const __m128 b = blu;
+
+        red = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, m_column1[0]), _mm_mul_ps(g, m_column2[0])),
+                         _mm_mul_ps(b, m_column3[0]));
+        grn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, m_column1[1]), _mm_mul_ps(g, m_column2[1])),
+                         _mm_mul_ps(b, m_column3[1]));
+        blu = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, m_column1[2]), _mm_mul_ps(g, m_column2[2])),
+                         _mm_mul_ps(b, m_column3[2]));
+    }
+
+    __m128 m_column1[3];
+    __m128 m_column2[3];
+    __m128 m_column3[3];
+};
+
+#endif
+
+// The following renderers are used when the alpha channel is independent of the RGB
+// channels (i.e. the matrix is a 3x3 matrix and an alpha scale), which is the case of
+// most of the matrices. They avoid the useless computations of the 4x4 matrix.
+
+// A 3x3 matrix where the alpha channel is unchanged.
+class Matrix3x3Renderer : public OpCPU
+{
+public:
+    Matrix3x3Renderer() = delete;
+    Matrix3x3Renderer(const Matrix3x3Renderer &) = delete;
+    explicit Matrix3x3Renderer(ConstMatrixOpDataRcPtr & mat);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
+protected:
+    // Note that the alpha multipliers are 0.
+    float m_column1[4];
+    float m_column2[4];
+    float m_column3[4];
+};
+
+// A 3x3 matrix with offsets where the alpha channel is unchanged.
+class Matrix3x3WithOffsetRenderer : public Matrix3x3Renderer
+{
+public:
+    Matrix3x3WithOffsetRenderer() = delete;
+    Matrix3x3WithOffsetRenderer(const Matrix3x3WithOffsetRenderer &) = delete;
+    explicit Matrix3x3WithOffsetRenderer(ConstMatrixOpDataRcPtr & mat);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
+protected:
+    // Note that the alpha offset is 0.
+    float m_offset[4];
+};
+
+// A block diagonal matrix i.e. a 3x3 matrix with offsets, and a scale and offset of the
+// alpha channel.
+class BlockDiagonalRenderer : public Matrix3x3WithOffsetRenderer
+{
+public:
+    BlockDiagonalRenderer() = delete;
+    BlockDiagonalRenderer(const BlockDiagonalRenderer &) = delete;
+    explicit BlockDiagonalRenderer(ConstMatrixOpDataRcPtr & mat);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+#ifdef USE_SSE
+    OCIO_TARGET_AVX2 void applyAVX2(const float * in, float * out, long numPixels) const;
+#endif
+
+protected:
+    float m_alphaScale;
+    float m_alphaOffset;
+};
+
 ScaleRenderer::ScaleRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +265,46 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+OffsetRenderer::OffsetRenderer(ConstMatrixOpDataRcPtr & mat)
+    : OpCPU()
+{
+    const MatrixOpData::Offsets & o = mat->getOffsets();
+
+    m_offset[0] = (float)o[0];
+    m_offset[1] = (float)o[1];
+    m_offset[2] = (float)o[2];
+    m_offset[3] = (float)o[3];
+}
+
+void OffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const __m128 o = _mm_loadu_ps(m_offset);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(in), o));
+
+        in  += 4;
+        out += 4;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] + m_offset[0];
+        out[1] = in[1] + m_offset[1];
+        out[2] = in[2] + m_offset[2];
+        out[3] = in[3] + m_offset[3];
+
+        in  += 4;
+        out += 4;
+    }
+#endif
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -395,6 +561,352 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+Matrix3x3Renderer::Matrix3x3Renderer(ConstMatrixOpDataRcPtr & mat)
+    : OpCPU()
+{
+    const unsigned long dim = mat->getArray().getLength();
+    const unsigned long twoDim = 2 * dim;
+    const ArrayDouble::Values & m = mat->getArray().getValues();
+
+    // Red multipliers.
+    m_column1[0] = (float)m[0];
+    m_column1[1] = (float)m[dim];
+    m_column1[2] = (float)m[twoDim];
+    m_column1[3] = 0.0f;
+
+    // Green multipliers.
+    m_column2[0] = (float)m[1];
+    m_column2[1] = (float)m[dim + 1];
+    m_column2[2] = (float)m[twoDim + 1];
+    m_column2[3] = 0.0f;
+
+    // Blue multipliers.
+    m_column3[0] = (float)m[2];
+    m_column3[1] = (float)m[dim + 2];
+    m_column3[2] = (float)m[twoDim + 2];
+    m_column3[3] = 0.0f;
+}
+
+void Matrix3x3Renderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const SSEMatrix3x3 mat(m_column1, m_column2, m_column3);
+
+    for (; numPixels >= 4; numPixels -= 4)
+    {
+        __m128 red, grn, blu, alpha;
+        sseLoadRGBA(in, red, grn, blu, alpha);
+
+        mat.apply(red, grn, blu);
+
+        sseStoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    // The remaining pixels (i.e. all of them when SSE is not available).
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0] + g*m_column2[0] + b*m_column3[0];
+        out[1] = r*m_column1[1] + g*m_column2[1] + b*m_column3[1];
+        out[2] = r*m_column1[2] + g*m_column2[2] + b*m_column3[2];
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+Matrix3x3WithOffsetRenderer::Matrix3x3WithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
+    : Matrix3x3Renderer(mat)
+{
+    const MatrixOpData::Offsets & o = mat->getOffsets();
+
+    m_offset[0] = (float)o[0];
+    m_offset[1] = (float)o[1];
+    m_offset[2] = (float)o[2];
+    m_offset[3] = 0.0f;
+}
+
+void Matrix3x3WithOffsetRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const SSEMatrix3x3 mat(m_column1, m_column2, m_column3);
+
+    const __m128 o0 = _mm_set1_ps(m_offset[0]);
+    const __m128 o1 = _mm_set1_ps(m_offset[1]);
+    const __m128 o2 = _mm_set1_ps(m_offset[2]);
+
+    for (; numPixels >= 4; numPixels -= 4)
+    {
+        __m128 red, grn, blu, alpha;
+        sseLoadRGBA(in, red, grn, blu, alpha);
+
+        mat.apply(red, grn, blu);
+
+        red = _mm_add_ps(red, o0);
+        grn = _mm_add_ps(grn, o1);
+        blu = _mm_add_ps(blu, o2);
+
+        sseStoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    // The remaining pixels (i.e. all of them when SSE is not available).
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0] + g*m_column2[0] + b*m_column3[0] + m_offset[0];
+        out[1] = r*m_column1[1] + g*m_column2[1] + b*m_column3[1] + m_offset[1];
+        out[2] = r*m_column1[2] + g*m_column2[2] + b*m_column3[2] + m_offset[2];
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+BlockDiagonalRenderer::BlockDiagonalRenderer(ConstMatrixOpDataRcPtr & mat)
+    : Matrix3x3WithOffsetRenderer(mat)
+{
+    const unsigned long dim = mat->getArray().getLength();
+    const ArrayDouble::Values & m = mat->getArray().getValues();
+
+    m_alphaScale  = (float)m[3 * dim + 3];
+    m_alphaOffset = (float)mat->getOffsets()[3];
+}
+
+void BlockDiagonalRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    const SSEMatrix3x3 mat(m_column1, m_column2, m_column3);
+
+    const __m128 o0 = _mm_set1_ps(m_offset[0]);
+    const __m128 o1 = _mm_set1_ps(m_offset[1]);
+    const __m128 o2 = _mm_set1_ps(m_offset[2]);
+
+    const __m128 alphaScale  = _mm_set1_ps(m_alphaScale);
+    const __m128 alphaOffset = _mm_set1_ps(m_alphaOffset);
+
+    for (; numPixels >= 4; numPixels -= 4)
+    {
+        __m128 red, grn, blu, alpha;
+        sseLoadRGBA(in, red, grn, blu, alpha);
+
+        mat.apply(red, grn, blu);
+
+        red   = _mm_add_ps(red, o0);
+        grn   = _mm_add_ps(grn, o1);
+        blu   = _mm_add_ps(blu, o2);
+        alpha = _mm_add_ps(_mm_mul_ps(alpha, alphaScale), alphaOffset);
+
+        sseStoreRGBA(out, red, grn, blu, alpha);
+
+        in  += 16;
+        out += 16;
+    }
+#endif
+
+    // The remaining pixels (i.e. all of them when SSE is not available).
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0] + g*m_column2[0] + b*m_column3[0] + m_offset[0];
+        out[1] = r*m_column1[1] + g*m_column2[1] + b*m_column3[1] + m_offset[1];
+        out[2] = r*m_column1[2] + g*m_column2[2] + b*m_column3[2] + m_offset[2];
+        out[3] = in[3] * m_alphaScale + m_alphaOffset;
+
+        in  += 4;
+        out += 4;
+    }
+}
+
+#ifdef USE_SSE
+
+// The AVX2 versions of the renderers process two pixels per register (i.e. one pixel per
+// 128-bit lane) so the computations are the same as the SSE ones, and the results identical.
+
+OCIO_TARGET_AVX2
+void MatrixWithOffsetRenderer::applyAVX2(const float * in, float * out, long numPixels) const
+{
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)m_column1);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)m_column2);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)m_column3);
+    const __m256 m3 = _mm256_broadcast_ps((const __m128 *)m_column4);
+    const __m256 o  = _mm256_broadcast_ps((const __m128 *)m_offset);
+
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pxl = _mm256_loadu_ps(in);
+
+        const __m256 r = _mm256_permute_ps(pxl, 0x00);
+        const __m256 g = _mm256_permute_ps(pxl, 0x55);
+        const __m256 b = _mm256_permute_ps(pxl, 0xAA);
+        const __m256 a = _mm256_permute_ps(pxl, 0xFF);
+
+        __m256 img = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g)),
+                                   _mm256_add_ps(_mm256_mul_ps(m2, b), _mm256_mul_ps(m3, a)));
+        img = _mm256_add_ps(img, o);
+
+        _mm256_storeu_ps(out, img);
+
+        in  += 8;
+        out += 8;
+    }
+
+    MatrixWithOffsetRenderer::apply(in, out, numPixels);
+}
+
+OCIO_TARGET_AVX2
+void MatrixRenderer::applyAVX2(const float * in, float * out, long numPixels) const
+{
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)m_column1);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)m_column2);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)m_column3);
+    const __m256 m3 = _mm256_broadcast_ps((const __m128 *)m_column4);
+
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pxl = _mm256_loadu_ps(in);
+
+        const __m256 r = _mm256_permute_ps(pxl, 0x00);
+        const __m256 g = _mm256_permute_ps(pxl, 0x55);
+        const __m256 b = _mm256_permute_ps(pxl, 0xAA);
+        const __m256 a = _mm256_permute_ps(pxl, 0xFF);
+
+        const __m256 img
+            = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g)),
+                            _mm256_add_ps(_mm256_mul_ps(m2, b), _mm256_mul_ps(m3, a)));
+
+        _mm256_storeu_ps(out, img);
+
+        in  += 8;
+        out += 8;
+    }
+
+    MatrixRenderer::apply(in, out, numPixels);
+}
+
+OCIO_TARGET_AVX2
+void Matrix3x3Renderer::applyAVX2(const float * in, float * out, long numPixels) const
+{
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)m_column1);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)m_column2);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)m_column3);
+
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pxl = _mm256_loadu_ps(in);
+
+        const __m256 r = _mm256_permute_ps(pxl, 0x00);
+        const __m256 g = _mm256_permute_ps(pxl, 0x55);
+        const __m256 b = _mm256_permute_ps(pxl, 0xAA);
+
+        const __m256 img
+            = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g)),
+                            _mm256_mul_ps(m2, b));
+
+        // Keep the alpha values.
+        _mm256_storeu_ps(out, _mm256_blend_ps(img, pxl, 0x88));
+
+        in  += 8;
+        out += 8;
+    }
+
+    Matrix3x3Renderer::apply(in, out, numPixels);
+}
+
+OCIO_TARGET_AVX2
+void Matrix3x3WithOffsetRenderer::applyAVX2(const float * in, float * out, long numPixels) const
+{
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)m_column1);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)m_column2);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)m_column3);
+    const __m256 o  = _mm256_broadcast_ps((const __m128 *)m_offset);
+
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pxl = _mm256_loadu_ps(in);
+
+        const __m256 r = _mm256_permute_ps(pxl, 0x00);
+        const __m256 g = _mm256_permute_ps(pxl, 0x55);
+        const __m256 b = _mm256_permute_ps(pxl, 0xAA);
+
+        __m256 img = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g)),
+                                   _mm256_mul_ps(m2, b));
+        img = _mm256_add_ps(img, o);
+
+        // Keep the alpha values.
+        _mm256_storeu_ps(out, _mm256_blend_ps(img, pxl, 0x88));
+
+        in  += 8;
+        out += 8;
+    }
+
+    Matrix3x3WithOffsetRenderer::apply(in, out, numPixels);
+}
+
+OCIO_TARGET_AVX2
+void BlockDiagonalRenderer::applyAVX2(const float * in, float * out, long numPixels) const
+{
+    const __m256 m0 = _mm256_broadcast_ps((const __m128 *)m_column1);
+    const __m256 m1 = _mm256_broadcast_ps((const __m128 *)m_column2);
+    const __m256 m2 = _mm256_broadcast_ps((const __m128 *)m_column3);
+    const __m256 o  = _mm256_broadcast_ps((const __m128 *)m_offset);
+
+    const __m256 alphaScale  = _mm256_set1_ps(m_alphaScale);
+    const __m256 alphaOffset = _mm256_set1_ps(m_alphaOffset);
+
+    for (; numPixels >= 2; numPixels -= 2)
+    {
+        const __m256 pxl = _mm256_loadu_ps(in);
+
+        const __m256 r = _mm256_permute_ps(pxl, 0x00);
+        const __m256 g = _mm256_permute_ps(pxl, 0x55);
+        const __m256 b = _mm256_permute_ps(pxl, 0xAA);
+
+        __m256 img = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, r), _mm256_mul_ps(m1, g)),
+                                   _mm256_mul_ps(m2, b));
+        img = _mm256_add_ps(img, o);
+
+        // Only the alpha lanes of the scaled pixels are used.
+        const __m256 alpha = _mm256_add_ps(_mm256_mul_ps(pxl, alphaScale), alphaOffset);
+
+        _mm256_storeu_ps(out, _mm256_blend_ps(img, alpha, 0x88));
+
+        in  += 8;
+        out += 8;
+    }
+
+    BlockDiagonalRenderer::apply(in, out, numPixels);
+}
+
+#endif
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
@@ -403,6 +915,10 @@ ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     {
         if (mat->hasOffsets())
         {
+            if (mat->isUnityDiagonal())
+            {
+                return std::make_shared<OffsetRenderer>(mat);
+            }
             return std::make_shared<ScaleWithOffsetRenderer>(mat);
         }
         else
@@ -410,18 +926,42 @@ ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
             return std::make_shared<ScaleRenderer>(mat);
         }
     }
+
+    const unsigned long dim = mat->getArray().getLength();
+    const ArrayDouble::Values & m = mat->getArray().getValues();
+    const MatrixOpData::Offsets & o = mat->getOffsets();
+
+    // Is the alpha channel independent of the RGB channels (i.e. strict comparisons intended)?
+    const bool blockDiagonal
+        = m[3] == 0.0 && m[dim + 3] == 0.0 && m[2 * dim + 3] == 0.0
+            && m[3 * dim] == 0.0 && m[3 * dim + 1] == 0.0 && m[3 * dim + 2] == 0.0;
+
+    if (blockDiagonal)
+    {
+        if (m[3 * dim + 3] != 1.0 || o[3] != 0.0)
+        {
+            return CreateRenderer<BlockDiagonalRenderer>(mat);
+        }
+        else if (mat->hasOffsets())
+        {
+            return CreateRenderer<Matrix3x3WithOffsetRenderer>(mat);
+        }
+        else
+        {
+            return CreateRenderer<Matrix3x3Renderer>(mat);
+        }
+    }
     else
     {
         if (mat->hasOffsets())
         {
-            return std::make_shared<MatrixWithOffsetRenderer>(mat);
+            return CreateRenderer<MatrixWithOffsetRenderer>(mat);
         }
         else
         {
-            return std::make_shared<MatrixRenderer>(mat);
+            return CreateRenderer<MatrixRenderer>(mat);
         }
     }
 }
 
 } // namespace OCIO_NAMESPACE
-
@@ -41,7 +41,7 @@ public:
 
     void finalize(OptimizationFlags /*oFlags*/) override { }
 
-    ConstOpCPURcPtr getCPUOp() const override { return nullptr; }
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags /*oFlags*/) const override { return nullptr; }
 
     void apply(void * img, long numPixels) const override
     { apply(img, img, numPixels); }
@@ -322,7 +322,7 @@ public:
 
     void finalize(OptimizationFlags /*oFlags*/) override {}
 
-    ConstOpCPURcPtr getCPUOp() const override { return nullptr; }
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags /*oFlags*/) const override { return nullptr; }
 
     void apply(void * img, long numPixels) const override
     { apply(img, img, numPixels); }
@@ -404,7 +404,7 @@ public:
 
     void finalize(OptimizationFlags /*oFlags*/) override {}
 
-    ConstOpCPURcPtr getCPUOp() const override { return nullptr; }
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags /*oFlags*/) const override { return nullptr; }
 
     void apply(void * img, long numPixels) const override
     { apply(img, img, numPixels); }
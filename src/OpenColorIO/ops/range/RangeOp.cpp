@@ -49,7 +49,7 @@ public:
 
     void finalize(OptimizationFlags oFlags) override;
 
-    ConstOpCPURcPtr getCPUOp() const override;
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags oFlags) const override;
 
     void extractGpuShaderInfo(GpuShaderDescRcPtr & shaderDesc) const override;
 
@@ -208,7 +208,7 @@ void RangeOp::finalize(OptimizationFlags /*oFlags*/)
     m_cacheID = cacheIDStream.str();
 }
 
-ConstOpCPURcPtr RangeOp::getCPUOp() const
+ConstOpCPURcPtr RangeOp::getCPUOp(OptimizationFlags /*oFlags*/) const
 {
     ConstRangeOpDataRcPtr data = rangeData();
     return GetRangeRenderer(data);
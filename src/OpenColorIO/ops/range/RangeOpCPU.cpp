@@ -9,6 +9,7 @@
 #include "MathUtils.h"
 #include "ops/matrix/MatrixOpCPU.h"
 #include "ops/range/RangeOpCPU.h"
+#include "SSE.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -86,6 +87,50 @@ public:
 };
 
 
+// The scale, offset and clamp of a range, applied to the RGB channels of a block of pixels
+// with the same arithmetic as the range renderers above.
+class RangeStage
+{
+public:
+    RangeStage() = default;
+
+    void set(ConstRangeOpDataRcPtr & range);
+
+    bool isEnabled() const { return m_enabled; }
+
+    void apply(const float * in, float * out, long numPixels) const;
+
+private:
+    bool  m_enabled = false;
+    bool  m_scales = false;
+    bool  m_hasLowerBound = false;
+    bool  m_hasUpperBound = false;
+    float m_scale = 1.0f;
+    float m_offset = 0.0f;
+    float m_lowerBound = 0.0f;
+    float m_upperBound = 0.0f;
+};
+
+// A renderer applying ranges before and/or after another renderer in a single pass over
+// the pixels i.e. the pixels are processed by blocks small enough to stay in the cache
+// between the stages.
+class RangeFusedRenderer : public OpCPU
+{
+public:
+    RangeFusedRenderer() = delete;
+    RangeFusedRenderer(const RangeFusedRenderer &) = delete;
+    RangeFusedRenderer(ConstRangeOpDataRcPtr & preRange,
+                       const ConstOpCPURcPtr & op,
+                       ConstRangeOpDataRcPtr & postRange);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    RangeStage      m_preStage;
+    ConstOpCPURcPtr m_op;
+    RangeStage      m_postStage;
+};
+
 RangeOpCPU::RangeOpCPU(ConstRangeOpDataRcPtr & range)
     :   OpCPU()
     ,   m_scale(0.0f)
@@ -277,6 +322,139 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
 }
 
 
+void RangeStage::set(ConstRangeOpDataRcPtr & range)
+{
+    m_enabled = (bool)range;
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    m_scales        = range->scales();
+    m_hasLowerBound = !range->minIsEmpty();
+    m_hasUpperBound = !range->maxIsEmpty();
+
+    m_scale      = (float)range->getScale();
+    m_offset     = (float)range->getOffset();
+    m_lowerBound = (float)range->getMinOutValue();
+    m_upperBound = (float)range->getMaxOutValue();
+}
+
+void RangeStage::apply(const float * in, float * out, long numPixels) const
+{
+#ifdef USE_SSE
+    const __m128 scale  = _mm_set1_ps(m_scale);
+    const __m128 offset = _mm_set1_ps(m_offset);
+    const __m128 lower  = _mm_set1_ps(m_lowerBound);
+    const __m128 upper  = _mm_set1_ps(m_upperBound);
+
+    // Select the RGB channels, the alpha channel is unchanged.
+    const __m128 rgbMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const __m128 pxl = _mm_loadu_ps(in);
+
+        __m128 res = pxl;
+        if (m_scales)
+        {
+            res = _mm_add_ps(_mm_mul_ps(res, scale), offset);
+        }
+        // NaNs become the lower bound (resp. the upper bound when there is no lower bound).
+        if (m_hasLowerBound)
+        {
+            res = _mm_max_ps(res, lower);
+        }
+        if (m_hasUpperBound)
+        {
+            res = _mm_min_ps(res, upper);
+        }
+
+        res = _mm_or_ps(_mm_and_ps(rgbMask, res), _mm_andnot_ps(rgbMask, pxl));
+        _mm_storeu_ps(out, res);
+
+        in  += 4;
+        out += 4;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float t[3] = { in[0], in[1], in[2] };
+
+        if (m_scales)
+        {
+            t[0] = t[0] * m_scale + m_offset;
+            t[1] = t[1] * m_scale + m_offset;
+            t[2] = t[2] * m_scale + m_offset;
+        }
+        // NaNs become the lower bound (resp. the upper bound when there is no lower bound).
+        if (m_hasLowerBound)
+        {
+            t[0] = std::max(m_lowerBound, t[0]);
+            t[1] = std::max(m_lowerBound, t[1]);
+            t[2] = std::max(m_lowerBound, t[2]);
+        }
+        if (m_hasUpperBound)
+        {
+            t[0] = std::min(m_upperBound, t[0]);
+            t[1] = std::min(m_upperBound, t[1]);
+            t[2] = std::min(m_upperBound, t[2]);
+        }
+
+        out[0] = t[0];
+        out[1] = t[1];
+        out[2] = t[2];
+        out[3] = in[3];
+
+        in  += 4;
+        out += 4;
+    }
+#endif
+}
+
+RangeFusedRenderer::RangeFusedRenderer(ConstRangeOpDataRcPtr & preRange,
+                                       const ConstOpCPURcPtr & op,
+                                       ConstRangeOpDataRcPtr & postRange)
+    :   OpCPU()
+    ,   m_op(op)
+{
+    m_preStage.set(preRange);
+    m_postStage.set(postRange);
+}
+
+void RangeFusedRenderer::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    // 256 RGBA float pixels (i.e. 4 KB) stay in the L1 cache between the stages.
+    static constexpr long BLOCK_SIZE = 256;
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    while (numPixels > 0)
+    {
+        const long num = std::min(numPixels, BLOCK_SIZE);
+
+        if (m_preStage.isEnabled())
+        {
+            m_preStage.apply(in, out, num);
+            m_op->apply(out, out, num);
+        }
+        else
+        {
+            m_op->apply(in, out, num);
+        }
+
+        if (m_postStage.isEnabled())
+        {
+            m_postStage.apply(out, out, num);
+        }
+
+        in  += 4 * num;
+        out += 4 * num;
+        numPixels -= num;
+    }
+}
+
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
     if (range->scales())
@@ -331,5 +509,17 @@ ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
     return GetMatrixRenderer(mat);
 }
 
+ConstOpCPURcPtr GetRangeFusedRenderer(ConstRangeOpDataRcPtr & preRange,
+                                      const ConstOpCPURcPtr & op,
+                                      ConstRangeOpDataRcPtr & postRange)
+{
+    if (!preRange && !postRange)
+    {
+        return op;
+    }
+
+    return std::make_shared<RangeFusedRenderer>(preRange, op, postRange);
+}
+
 } // namespace OCIO_NAMESPACE
 
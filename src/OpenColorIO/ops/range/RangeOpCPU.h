@@ -16,6 +16,13 @@ namespace OCIO_NAMESPACE
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range);
 
+// Get a renderer applying preRange, then op and then postRange in a single pass over the
+// pixels (see OPTIMIZATION_FUSE_RANGE).  Either range can be null, and op must process 32-bit
+// float RGBA pixels.
+ConstOpCPURcPtr GetRangeFusedRenderer(ConstRangeOpDataRcPtr & preRange,
+                                      const ConstOpCPURcPtr & op,
+                                      ConstRangeOpDataRcPtr & postRange);
+
 } // namespace OCIO_NAMESPACE
 
 
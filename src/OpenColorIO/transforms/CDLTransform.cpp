@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string.h>
 
@@ -171,88 +172,46 @@ CDLTransformRcPtr CDLTransform::Create()
 
 namespace
 {
-std::string GetCDLLocalCacheKey(const std::string & src, const std::string & cccid)
+// Content of a loaded CDL source file. It is never modified once loaded so the lookups by id
+// or by index do not need any lock.
+struct CDLFile
 {
-    std::ostringstream os;
-    os << src << " : " << cccid;
-    return os.str();
-}
+    // A pure ColorCorrection element i.e. the cccid is ignored.
+    bool isCC = false;
+    CDLTransformVec transformVec;
+    CDLTransformMap transformMap;
+};
 
-std::string GetCDLLocalCacheKey(const char * src, int cccindex)
-{
-    std::ostringstream os;
-    os << src << " : " << cccindex;
-    return os.str();
-}
+typedef OCIO_SHARED_PTR<const CDLFile> ConstCDLFileRcPtr;
+typedef std::unordered_map<std::string, ConstCDLFileRcPtr> CDLFileMap;
+typedef OCIO_SHARED_PTR<const CDLFileMap> ConstCDLFileMapRcPtr;
 
-CDLTransformMap g_cache;
-StringBoolMap g_cacheSrcIsCC;
+// The loaded files are published as an immutable map (i.e. copied on write) which is read
+// atomically, so the lookups of the files already loaded do not take g_cacheMutex. The mutex
+// only serializes the loads so that a file is parsed once.
+ConstCDLFileMapRcPtr g_cache = std::make_shared<CDLFileMap>();
 Mutex g_cacheMutex;
-} // namespace
 
-void ClearCDLTransformFileCache()
+ConstCDLFileRcPtr FindCDLFile(const std::string & src)
 {
-    AutoMutex lock(g_cacheMutex);
-    g_cache.clear();
-    g_cacheSrcIsCC.clear();
-}
+    const ConstCDLFileMapRcPtr files = std::atomic_load(&g_cache);
 
-// TODO: Expose functions for introspecting in ccc file
-// TODO: Share caching with normal cdl pathway
+    CDLFileMap::const_iterator iter = files->find(src);
+    return iter != files->end() ? iter->second : ConstCDLFileRcPtr();
+}
 
-CDLTransformRcPtr CDLTransform::CreateFromFile(const char * src, const char * cccid_)
+ConstCDLFileRcPtr LoadCDLFile(const std::string & src)
 {
-    if (!src || (strlen(src) == 0))
-    {
-        std::ostringstream os;
-        os << "Error loading CDL xml. ";
-        os << "Source file not specified.";
-        throw Exception(os.str().c_str());
-    }
-
-    std::string cccid;
-    if(cccid_) cccid = cccid_;
-
-    // Check cache
     AutoMutex lock(g_cacheMutex);
 
-    // Use g_cacheSrcIsCC as a proxy for if we have loaded this source
-    // file already (in which case it must be in cache, or an error)
-
-    StringBoolMap::iterator srcIsCCiter = g_cacheSrcIsCC.find(src);
-    if (srcIsCCiter != g_cacheSrcIsCC.end())
+    // Another thread could have loaded the file in the meantime.
+    ConstCDLFileRcPtr cdlFile = FindCDLFile(src);
+    if (cdlFile)
     {
-        // If the source file is known to be a pure ColorCorrection element,
-        // null out the cccid so its ignored.
-        if(srcIsCCiter->second) cccid = "";
-
-        // Search for the cccid by name
-        CDLTransformMap::iterator iter = g_cache.find(GetCDLLocalCacheKey(src, cccid));
-        if(iter != g_cache.end())
-        {
-            return iter->second;
-        }
-
-        // Search for cccid by index
-        int cccindex=0;
-        if (StringToInt(&cccindex, cccid.c_str(), true))
-        {
-            iter = g_cache.find(GetCDLLocalCacheKey(src, cccindex));
-            if (iter != g_cache.end())
-            {
-                return iter->second;
-            }
-        }
-
-        std::ostringstream os;
-        os << "The specified cccid/cccindex '" << cccid;
-        os << "' could not be loaded from the src file '";
-        os << src;
-        os << "'.";
-        throw Exception (os.str().c_str());
+        return cdlFile;
     }
 
-    // Try to read all ccs from the file, into cache
+    // Try to read all ccs from the file.
     std::ifstream istream(src);
     if (istream.fail())
     {
@@ -266,27 +225,24 @@ CDLTransformRcPtr CDLTransform::CreateFromFile(const char * src, const char * cc
     CDLParser parser(src);
     parser.parse(istream);
 
+    auto file = std::make_shared<CDLFile>();
+
     if (parser.isCC())
     {
-        // Load a single ColorCorrection into the cache
+        // Load a single ColorCorrection.
         CDLTransformRcPtr cdl = CDLTransform::Create();
         parser.getCDLTransform(cdl);
 
-        cccid = "";
-        g_cacheSrcIsCC[src] = true;
-        g_cache[GetCDLLocalCacheKey(src, cccid)] = cdl;
+        file->isCC = true;
+        file->transformVec.push_back(cdl);
     }
     else if (parser.isCCC())
     {
-        // Load all CCs from the ColorCorrectionCollection
-        // into the cache
-        CDLTransformMap transformMap;
-        CDLTransformVec transformVec;
+        // Load all CCs from the ColorCorrectionCollection.
         FormatMetadataImpl metadata;
+        parser.getCDLTransforms(file->transformMap, file->transformVec, metadata);
 
-        parser.getCDLTransforms(transformMap, transformVec, metadata);
-
-        if (transformVec.empty())
+        if (file->transformVec.empty())
         {
             std::ostringstream os;
             os << "Error loading ccc xml. ";
@@ -294,45 +250,83 @@ CDLTransformRcPtr CDLTransform::CreateFromFile(const char * src, const char * cc
             os << src << "'.";
             throw Exception(os.str().c_str());
         }
+    }
+    else
+    {
+        return ConstCDLFileRcPtr();
+    }
 
-        g_cacheSrcIsCC[src] = false;
+    // Publish a new map including the file.
+    auto files = std::make_shared<CDLFileMap>(*std::atomic_load(&g_cache));
+    (*files)[src] = file;
+    std::atomic_store(&g_cache, ConstCDLFileMapRcPtr(files));
 
-        // Add all by transforms to cache
-        // First by index, then by id
-        for (unsigned int i = 0; i < transformVec.size(); ++i)
-        {
-            g_cache[GetCDLLocalCacheKey(src, i)] = transformVec[i];
-        }
+    return file;
+}
 
-        for (CDLTransformMap::iterator iter = transformMap.begin();
-             iter != transformMap.end();
-             ++iter)
+CDLTransformRcPtr FindCDLTransform(const ConstCDLFileRcPtr & cdlFile, const std::string & cccid)
+{
+    if (cdlFile)
+    {
+        // If the source file is known to be a pure ColorCorrection element,
+        // the cccid is ignored.
+        if (cdlFile->isCC)
         {
-            g_cache[GetCDLLocalCacheKey(src, iter->first)] = iter->second;
+            return cdlFile->transformVec[0];
         }
-    }
 
-    // The all transforms should be in the cache.  Look it up, and try
-    // to return it.
-    {
-        // Search for the cccid by name
-        CDLTransformMap::iterator iter = g_cache.find(GetCDLLocalCacheKey(src, cccid));
-        if(iter != g_cache.end())
+        // Search for the cccid by name.
+        CDLTransformMap::const_iterator iter = cdlFile->transformMap.find(cccid);
+        if (iter != cdlFile->transformMap.end())
         {
             return iter->second;
         }
 
-        // Search for cccid by index
-        int cccindex=0;
-        if (StringToInt(&cccindex, cccid.c_str(), true))
+        // Search for cccid by index.
+        int cccindex = 0;
+        if (StringToInt(&cccindex, cccid.c_str(), true)
+            && cccindex >= 0 && size_t(cccindex) < cdlFile->transformVec.size())
         {
-            iter = g_cache.find(GetCDLLocalCacheKey(src, cccindex));
-            if (iter != g_cache.end())
-            {
-                return iter->second;
-            }
+            return cdlFile->transformVec[cccindex];
         }
+    }
+
+    return CDLTransformRcPtr();
+}
+} // namespace
+
+void ClearCDLTransformFileCache()
+{
+    AutoMutex lock(g_cacheMutex);
+    std::atomic_store(&g_cache, ConstCDLFileMapRcPtr(std::make_shared<CDLFileMap>()));
+}
 
+// TODO: Expose functions for introspecting in ccc file
+// TODO: Share caching with normal cdl pathway
+
+CDLTransformRcPtr CDLTransform::CreateFromFile(const char * src, const char * cccid_)
+{
+    if (!src || (strlen(src) == 0))
+    {
+        std::ostringstream os;
+        os << "Error loading CDL xml. ";
+        os << "Source file not specified.";
+        throw Exception(os.str().c_str());
+    }
+
+    std::string cccid;
+    if(cccid_) cccid = cccid_;
+
+    // Check cache, the file is only loaded (i.e. parsed) once.
+    ConstCDLFileRcPtr cdlFile = FindCDLFile(src);
+    if (!cdlFile)
+    {
+        cdlFile = LoadCDLFile(src);
+    }
+
+    CDLTransformRcPtr cdl = FindCDLTransform(cdlFile, cccid);
+    if (!cdl)
+    {
         std::ostringstream os;
         os << "The specified cccid/cccindex '" << cccid;
         os << "' could not be loaded from the src file '";
@@ -340,6 +334,8 @@ CDLTransformRcPtr CDLTransform::CreateFromFile(const char * src, const char * cc
         os << "'.";
         throw Exception (os.str().c_str());
     }
+
+    return cdl;
 }
 
 void CDLTransformImpl::deleter(CDLTransform * t)
@@ -5,7 +5,7 @@
 #ifndef INCLUDED_OCIO_CDLTRANSFORM_H
 #define INCLUDED_OCIO_CDLTRANSFORM_H
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -19,7 +19,8 @@ static constexpr const char * METADATA_VIEWING_DESCRIPTION = "ViewingDescription
 static constexpr const char * METADATA_SOP_DESCRIPTION = "SOPDescription";
 static constexpr const char * METADATA_SAT_DESCRIPTION = "SATDescription";
 
-typedef std::map<std::string,CDLTransformRcPtr> CDLTransformMap;
+// The transforms are hashed by id so that the lookups in very large collections stay fast.
+typedef std::unordered_map<std::string,CDLTransformRcPtr> CDLTransformMap;
 typedef std::vector<CDLTransformRcPtr> CDLTransformVec;
 
 void ClearCDLTransformFileCache();
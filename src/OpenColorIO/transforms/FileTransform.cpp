@@ -12,6 +12,7 @@
 #include "Logging.h"
 #include "Mutex.h"
 #include "ops/noop/NoOps.h"
+#include "ParseUtils.h"
 #include "PathUtils.h"
 #include "Platform.h"
 #include "pystring/pystring.h"
@@ -278,7 +279,12 @@ void FormatRegistry::registerFileFormat(FileFormat* format)
 
         m_formatsByName[pystring::lower(formatInfoVec[i].name)] = format;
 
-        m_formatsByExtension[formatInfoVec[i].extension].push_back(format);
+        // A format handling several "formats" with the same extension is only tried once.
+        FileFormatVector & formats = m_formatsByExtension[formatInfoVec[i].extension];
+        if (std::find(formats.begin(), formats.end(), format) == formats.end())
+        {
+            formats.push_back(format);
+        }
 
         if(formatInfoVec[i].capabilities & FORMAT_CAPABILITY_READ)
         {
@@ -434,6 +440,19 @@ void FileFormat::write(const OpRcPtrVec & /*ops*/,
     throw Exception(os.str().c_str());
 }
 
+bool FileFormat::serializeCachedFile(LutCacheWriter & /*writer*/,
+                                     const CachedFileRcPtr & /*cachedFile*/) const
+{
+    return false;
+}
+
+CachedFileRcPtr FileFormat::deserializeCachedFile(LutCacheReader & /*reader*/) const
+{
+    std::ostringstream os;
+    os << "Format " << getName() << " does not support the LUT cache.";
+    throw Exception(os.str().c_str());
+}
+
 namespace
 {
 
@@ -676,9 +695,15 @@ void GetCachedFileAndFormat(FileFormat * & format,
 
         try
         {
-            LoadFileUncached(result->format,
-                result->cachedFile,
-                filepath);
+            // Parse the file only if it is not in the on-disk LUT cache.
+            if (!LoadFromLutCache(result->format, result->cachedFile, filepath))
+            {
+                LoadFileUncached(result->format,
+                    result->cachedFile,
+                    filepath);
+
+                SaveToLutCache(result->format, result->cachedFile, filepath);
+            }
         }
         catch (std::exception & e)
         {
@@ -730,6 +755,281 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+namespace
+{
+constexpr char OCIO_LAZY_FILE_LOADING_ENVVAR[] = "OCIO_LAZY_FILE_LOADING";
+
+Mutex g_lazyFileLoadingMutex;
+bool g_lazyFileLoadingInitialized = false;
+bool g_lazyFileLoading = false;
+
+// You must manually acquire the lazy file loading mutex before calling this.
+void InitLazyFileLoading()
+{
+    if (g_lazyFileLoadingInitialized) return;
+
+    g_lazyFileLoadingInitialized = true;
+
+    std::string lazy;
+    Platform::Getenv(OCIO_LAZY_FILE_LOADING_ENVVAR, lazy);
+    g_lazyFileLoading = lazy == "1" || StrEqualsCaseIgnore(lazy, "true")
+                        || StrEqualsCaseIgnore(lazy, "yes");
+}
+
+// Load the file and add its ops.
+void LoadFileOps(OpRcPtrVec & ops,
+                 const Config & config,
+                 const ConstContextRcPtr & context,
+                 const FileTransform & fileTransform,
+                 TransformDirection dir,
+                 const std::string & filepath)
+{
+    FileFormat* format = NULL;
+    CachedFileRcPtr cachedFile;
+
+    try
+    {
+        GetCachedFileAndFormat(format, cachedFile, filepath);
+        // Add FileNoOp and keep track of it.
+        CreateFileNoOp(ops, filepath);
+        ConstOpRcPtr fileNoOpConst = ops.back();
+        OpRcPtr fileNoOp = ops.back();
+
+        // CTF implementation of FileFormat::buildFileOps might call
+        // BuildFileTransformOps for References.
+        format->buildFileOps(ops,
+                                config, context,
+                                cachedFile, fileTransform,
+                                dir);
+
+        // File has been loaded completely. It may now be referenced again.
+        ConstOpDataRcPtr data = fileNoOpConst->data();
+        auto fileData = DynamicPtrCast<const FileNoOpData>(data);
+        if (fileData)
+        {
+            fileData->setComplete();
+        }
+    }
+    catch (Exception & e)
+    {
+        std::ostringstream err;
+        err << "The transform file: " << filepath;
+        err << " failed while loading ops with this error: ";
+        err << e.what();
+        throw Exception(err.str().c_str());
+    }
+}
+
+class LazyFileOpData : public NoOpData
+{
+public:
+    LazyFileOpData() : NoOpData() { }
+    LazyFileOpData(const LazyFileOpData &) = delete;
+
+    // The file content is not known until it is loaded.
+    bool isNoOp() const override { return false; }
+    bool isIdentity() const override { return false; }
+    bool hasChannelCrosstalk() const override { return true; }
+};
+
+// Placeholder of the ops of a file which is not loaded yet (refer to SetLazyFileLoading()).
+// It only holds what is needed to build the file ops later.
+class LazyFileOp : public Op
+{
+public:
+    LazyFileOp() = delete;
+    LazyFileOp(const LazyFileOp &) = delete;
+    LazyFileOp& operator=(const LazyFileOp &) = delete;
+
+    LazyFileOp(const Config & config,
+               const ConstContextRcPtr & context,
+               const FileTransform & fileTransform,
+               TransformDirection dir,
+               const std::string & filepath)
+        :   Op()
+        ,   m_context(context)
+        ,   m_fileTransform(OCIO_DYNAMIC_POINTER_CAST<const FileTransform>(
+                                fileTransform.createEditableCopy()))
+        ,   m_dir(dir)
+        ,   m_filepath(filepath)
+    {
+        data().reset(new LazyFileOpData());
+
+        // The file formats only depend on the major version of the config to build their
+        // ops, so the op does not keep a reference to the config.
+        ConfigRcPtr fileConfig = Config::Create();
+        fileConfig->setMajorVersion(config.getMajorVersion());
+        m_config = fileConfig;
+
+        // The file is identified by its fast hash i.e. the file is not read.
+        std::ostringstream cacheid;
+        cacheid << "<LazyFileOp " << m_filepath << " " << GetFastFileHash(m_filepath) << " "
+                << context->resolveStringVar(fileTransform.getCCCId()) << " "
+                << InterpolationToString(fileTransform.getInterpolation()) << " "
+                << TransformDirectionToString(
+                       CombineTransformDirections(dir, fileTransform.getDirection()))
+                << ">";
+        m_cacheID = cacheid.str();
+    }
+
+    OpRcPtr clone() const override
+    {
+        return std::make_shared<LazyFileOp>(*m_config, m_context, *m_fileTransform,
+                                            m_dir, m_filepath);
+    }
+
+    std::string getInfo() const override { return "<LazyFileOp>"; }
+
+    // The op must not be removed as a no-op.
+    bool isNoOpType() const override { return false; }
+
+    bool isSameType(ConstOpRcPtr & op) const override
+    {
+        return (bool)DynamicPtrCast<const LazyFileOp>(op);
+    }
+
+    bool isInverse(ConstOpRcPtr & /*op*/) const override { return false; }
+
+    void dumpMetadata(ProcessorMetadataRcPtr & metadata) const override
+    {
+        metadata->addFile(m_filepath.c_str());
+    }
+
+    void finalize(OptimizationFlags /*oFlags*/) override {}
+
+    ConstOpCPURcPtr getCPUOp(OptimizationFlags /*oFlags*/) const override
+    {
+        throwNotLoaded();
+        return nullptr;
+    }
+
+    void extractGpuShaderInfo(GpuShaderDescRcPtr & /*shaderDesc*/) const override
+    {
+        throwNotLoaded();
+    }
+
+    const std::string & getFilepath() const { return m_filepath; }
+
+    void buildFileOps(OpRcPtrVec & ops) const
+    {
+        LoadFileOps(ops, *m_config, m_context, *m_fileTransform, m_dir, m_filepath);
+    }
+
+private:
+    void throwNotLoaded() const
+    {
+        std::ostringstream os;
+        os << "The transform file: " << m_filepath << " is not loaded.";
+        throw Exception(os.str().c_str());
+    }
+
+    ConstConfigRcPtr m_config;
+    ConstContextRcPtr m_context;
+    ConstFileTransformRcPtr m_fileTransform;
+    TransformDirection m_dir;
+    std::string m_filepath;
+};
+
+typedef OCIO_SHARED_PTR<const LazyFileOp> ConstLazyFileOpRcPtr;
+
+// Load (i.e. parse) the files in the file cache, concurrently when there are several files.
+void PreloadFiles(const StringVec & filepaths)
+{
+    // The readers share the same thread budget (i.e. the large files are not split in more
+    // parts while all the threads already load files).
+    Platform::ParallelFor(filepaths.size(), [&](size_t idx)
+    {
+        try
+        {
+            FileFormat * format = nullptr;
+            CachedFileRcPtr cachedFile;
+            GetCachedFileAndFormat(format, cachedFile, filepaths[idx]);
+        }
+        catch (const Exception &)
+        {
+            // The file cache keeps the error which is reported when the ops are built.
+        }
+    });
+}
+
+} // namespace
+
+void SetLazyFileLoading(bool lazy)
+{
+    AutoMutex lock(g_lazyFileLoadingMutex);
+    InitLazyFileLoading();
+
+    g_lazyFileLoading = lazy;
+}
+
+bool IsLazyFileLoading()
+{
+    AutoMutex lock(g_lazyFileLoadingMutex);
+    InitLazyFileLoading();
+
+    return g_lazyFileLoading;
+}
+
+bool HasLazyFileOps(const OpRcPtrVec & ops)
+{
+    for (const auto & op : ops)
+    {
+        if (DynamicPtrCast<const LazyFileOp>(op))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LoadLazyFileOps(OpRcPtrVec & ops)
+{
+    // Load all the pending files at once.
+    StringVec filepaths;
+    for (const auto & op : ops)
+    {
+        ConstLazyFileOpRcPtr lazyOp = DynamicPtrCast<const LazyFileOp>(op);
+        if (lazyOp && std::find(filepaths.begin(), filepaths.end(),
+                                lazyOp->getFilepath()) == filepaths.end())
+        {
+            filepaths.push_back(lazyOp->getFilepath());
+        }
+    }
+
+    if (filepaths.empty())
+    {
+        return;
+    }
+
+    PreloadFiles(filepaths);
+
+    // Replace the placeholders by the file ops, in order.
+    OpRcPtrVec result;
+    result.getFormatMetadata() = ops.getFormatMetadata();
+
+    for (const auto & op : ops)
+    {
+        ConstLazyFileOpRcPtr lazyOp = DynamicPtrCast<const LazyFileOp>(op);
+        if (!lazyOp)
+        {
+            result.push_back(op);
+            continue;
+        }
+
+        const size_t first = result.size();
+        lazyOp->buildFileOps(result);
+
+        for (size_t idx = first; idx < result.size(); ++idx)
+        {
+            result[idx]->finalize(OPTIMIZATION_NONE);
+        }
+    }
+
+    UnifyDynamicProperties(result);
+
+    ops = result;
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -747,12 +1047,15 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
     std::string filepath = context->resolveFileLocation(src.c_str());
 
     // Verify the recursion is valid, FileNoOp is added for each file.
+    bool loadingFile = false;
     for (ConstOpRcPtr&& op : ops)
     {
         ConstOpDataRcPtr data = op->data();
         auto fileData = DynamicPtrCast<const FileNoOpData>(data);
         if (fileData)
         {
+            loadingFile = loadingFile || !fileData->getComplete();
+
             // Error if file is still being loaded and is the same as the
             // one about to be loaded.
             if (!fileData->getComplete() &&
@@ -768,39 +1071,14 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         }
     }
 
-    FileFormat* format = NULL;
-    CachedFileRcPtr cachedFile;
-
-    try
-    {
-        GetCachedFileAndFormat(format, cachedFile, filepath);
-        // Add FileNoOp and keep track of it.
-        CreateFileNoOp(ops, filepath);
-        ConstOpRcPtr fileNoOpConst = ops.back();
-        OpRcPtr fileNoOp = ops.back();
-
-        // CTF implementation of FileFormat::buildFileOps might call
-        // BuildFileTransformOps for References.
-        format->buildFileOps(ops,
-                                config, context,
-                                cachedFile, fileTransform,
-                                dir);
-
-        // File has been loaded completely. It may now be referenced again.
-        ConstOpDataRcPtr data = fileNoOpConst->data();
-        auto fileData = DynamicPtrCast<const FileNoOpData>(data);
-        if (fileData)
-        {
-            fileData->setComplete();
-        }
-    }
-    catch (Exception & e)
+    // Only keep a reference to the file if the lazy loading is enabled. The files referenced
+    // by a file being loaded are loaded right away, so the recursion is always detected.
+    if (!loadingFile && IsLazyFileLoading())
     {
-        std::ostringstream err;
-        err << "The transform file: " << filepath;
-        err << " failed while loading ops with this error: ";
-        err << e.what();
-        throw Exception(err.str().c_str());
+        ops.push_back(std::make_shared<LazyFileOp>(config, context, fileTransform, dir, filepath));
+        return;
     }
+
+    LoadFileOps(ops, config, context, fileTransform, dir, filepath);
 }
 } // namespace OCIO_NAMESPACE
@@ -9,6 +9,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "LutCache.h"
 #include "Op.h"
 #include "ops/noop/NoOps.h"
 #include "PrivateTypes.h"
@@ -18,6 +19,13 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+// Return true if some file ops are not loaded yet (refer to SetLazyFileLoading()).
+bool HasLazyFileOps(const OpRcPtrVec & ops);
+
+// Replace the file ops not loaded yet by the ops of their files. The distinct files are
+// loaded concurrently.
+void LoadLazyFileOps(OpRcPtrVec & ops);
+
 class CachedFile
 {
 public:
@@ -75,6 +83,15 @@ public:
                                 const FileTransform & fileTransform,
                                 TransformDirection dir) const = 0;
 
+    // Serialize the cached file in the on-disk LUT cache. Return false if the format does
+    // not support it.
+    virtual bool serializeCachedFile(LutCacheWriter & writer,
+                                     const CachedFileRcPtr & cachedFile) const;
+
+    // Rebuild the cached file serialized by serializeCachedFile(). An exception is thrown
+    // if the data is invalid.
+    virtual CachedFileRcPtr deserializeCachedFile(LutCacheReader & reader) const;
+
     // True if the file is a binary rather than text-based format.
     virtual bool isBinary() const
     {
@@ -151,6 +168,8 @@ FileFormat * CreateFileFormatVF();
 
 static constexpr const char * FILEFORMAT_CLF = "Academy/ASC Common LUT Format";
 static constexpr const char * FILEFORMAT_CTF = "Color Transform Format";
+// Write only format: CTF with the LUT arrays encoded in base64.
+static constexpr const char * FILEFORMAT_CTF_BASE64 = "Color Transform Format base64";
 
 } // namespace OCIO_NAMESPACE
 
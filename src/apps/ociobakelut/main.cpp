@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -36,6 +37,7 @@ int main (int argc, const char* argv[])
     bool help = false;
     int cubesize = -1;
     int shapersize = -1; // cubsize^2
+    int numthreads = 0;
     std::string format;
     std::string inputconfig;
     std::string inputspace;
@@ -96,8 +98,9 @@ int main (int argc, const char* argv[])
                "--format %s", &format, formatstr.c_str(),
                "--shapersize %d", &shapersize, "size of the shaper (default: format specific)",
                "--cubesize %d", &cubesize, "size of the cube (default: format specific)",
+               "--threads %d", &numthreads, "number of threads evaluating the LUT (default: 0 i.e. all the cores)",
                "--stdout", &usestdout, "Write to stdout (rather than file)",
-               "--v", &verbose, "Verbose",
+               "--v", &verbose, "Verbose (also reports the baking time)",
                "--help", &help, "Print help message\n",
                "<SEPARATOR>", "ICC Options",
                //"--cubesize %d", &cubesize, "size of the ICC CLUT cube (default: 32)",
@@ -333,6 +336,7 @@ int main (int argc, const char* argv[])
             baker->setTargetSpace(outputspace.c_str());
             if(shapersize!=-1) baker->setShaperSize(shapersize);
             if(cubesize!=-1) baker->setCubeSize(cubesize);
+            baker->setNumThreads(numthreads);
 
             // output LUT
             std::ostringstream output;
@@ -352,9 +356,22 @@ int main (int argc, const char* argv[])
                     std::cerr << "ERROR: Non-writable file path " << outputfile << " specified." << std::endl;
                     return 1;
                 }
+                const auto start = std::chrono::steady_clock::now();
+
                 baker->bake(f);
+
+                const std::chrono::duration<double, std::milli> duration
+                    = std::chrono::steady_clock::now() - start;
+
                 if(verbose)
+                {
                     std::cout << "[OpenColorIO INFO]: Wrote '" << outputfile << "'" << std::endl;
+                    std::cout << "[OpenColorIO INFO]: Baked in " << duration.count() << " ms";
+                    std::cout << " (threads: ";
+                    if(numthreads > 0) std::cout << numthreads;
+                    else std::cout << "all the cores";
+                    std::cout << ")" << std::endl;
+                }
             }
         }
     }
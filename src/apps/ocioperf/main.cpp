@@ -1,7 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <sstream>
+#include <thread>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -154,6 +158,37 @@ void LoadImage(const std::string & filepath,
     }
 }
 
+// Create in memory a RGBA 32-bit float image spreading the values over [-0.1, 1.1].
+void CreateImage(int width, int height,
+                 OIIO::ImageSpec & spec, // [out] Image specifications.
+                 OCIO::ImgBuffer & img)  // [out] In memory image buffer.
+{
+    if(width<=0 || height<=0)
+    {
+        std::cerr << std::endl;
+        std::cerr << "Invalid synthetic image size." << std::endl;
+        exit(1);
+    }
+
+    std::cout << std::endl;
+    std::cout << "Creating a synthetic image of " << width << "x" << height << std::endl;
+
+    spec = OIIO::ImageSpec(width, height, 4, OIIO::TypeDesc::FLOAT);
+    img.allocate(spec);
+
+    // The channels use different steps so that neighbouring pixels do not hit the same
+    // LUT entries.
+    float * pixels = reinterpret_cast<float *>(img.getBuffer());
+    const size_t numPixels = size_t(width) * size_t(height);
+    for(size_t idx=0; idx<numPixels; ++idx)
+    {
+        pixels[4*idx + 0] = float((idx *  7) % 4096) / 3413.0f - 0.1f;
+        pixels[4*idx + 1] = float((idx * 13) % 4096) / 3413.0f - 0.1f;
+        pixels[4*idx + 2] = float((idx * 31) % 4096) / 3413.0f - 0.1f;
+        pixels[4*idx + 3] = 1.0f;
+    }
+}
+
 // Process the complete image in one shot.
 void ProcessImage(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
                   const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img)
@@ -201,6 +236,40 @@ void ProcessLines(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
     }
 }
 
+// Process the complete image tile by tile, a tile being a group of lines.
+void ProcessTiles(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
+                  const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img,
+                  int tileHeight)
+{
+    // Always process the same complete image.
+    OCIO::ImgBuffer srcImg(img);
+    char * tileToProcess = reinterpret_cast<char *>(srcImg.getBuffer());
+
+    for(int h=0; h<spec.height; h+=tileHeight)
+    {
+        const int numLines = std::min(tileHeight, spec.height - h);
+
+        OCIO::PackedImageDesc imageDesc((void*)tileToProcess,
+                                        spec.width,
+                                        numLines,
+                                        spec.nchannels,
+                                        OCIO::GetBitDepth(spec),
+                                        spec.channel_bytes(),
+                                        spec.pixel_bytes(),
+                                        spec.scanline_bytes());
+
+        m.resume();
+
+        // Apply the color transformation (in place).
+        cpuProcessor->apply(imageDesc);
+
+        // Find the next tile.
+        tileToProcess += numLines * spec.scanline_bytes();
+
+        m.pause();
+    }
+}
+
 // Process the complete image pixel per pixel.
 void ProcessPixels(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
                   const OIIO::ImageSpec & spec, const OCIO::ImgBuffer & img)
@@ -247,33 +316,154 @@ void ProcessPixels(Measure & m, OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
     m.pause();
 }
 
+// Resolve the color corrections of a ccc file by id, concurrently from several threads.
+void ResolveCCCIds(const std::string & cccFile, unsigned numThreads, unsigned iterations)
+{
+    static constexpr size_t NumLookups = 10000;
+
+    std::cout << std::endl;
+    std::cout << "Resolving the ids of '" << cccFile << "'" << std::endl;
+
+    // Load the file, the caches are cleared to measure the file parsing.
+    {
+        Measure m("Load the ccc file:", iterations);
+        for(unsigned iter=0; iter<iterations; ++iter)
+        {
+            OCIO::ClearAllCaches();
+
+            m.resume();
+            OCIO::CDLTransform::CreateFromFile(cccFile.c_str(), "0");
+            m.pause();
+        }
+    }
+
+    // Collect the ids by finding the color corrections by index, up to the first invalid one.
+    std::vector<std::string> ids;
+    try
+    {
+        for(size_t idx=0; ; ++idx)
+        {
+            OCIO::CDLTransformRcPtr cdl
+                = OCIO::CDLTransform::CreateFromFile(cccFile.c_str(), std::to_string(idx).c_str());
+            if(*cdl->getID())
+            {
+                ids.push_back(cdl->getID());
+            }
+        }
+    }
+    catch(OCIO::Exception &)
+    {
+    }
+
+    if(ids.empty())
+    {
+        throw OCIO::Exception("The ccc file does not contain any color correction id.");
+    }
+
+    // Spread the lookups over the complete file.
+    std::vector<std::string> lookups(NumLookups);
+    for(size_t idx=0; idx<NumLookups; ++idx)
+    {
+        lookups[idx] = ids[(idx * 7919) % ids.size()];
+    }
+
+    if(numThreads==0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::ostringstream oss;
+    oss << "Resolve " << NumLookups << " ids from each of the " << numThreads << " thread(s):";
+
+    std::atomic<bool> failed{ false };
+
+    Measure m(oss.str().c_str(), iterations);
+    for(unsigned iter=0; iter<iterations; ++iter)
+    {
+        std::vector<std::thread> threads;
+
+        m.resume();
+        for(unsigned idx=0; idx<numThreads; ++idx)
+        {
+            threads.emplace_back([&]()
+            {
+                try
+                {
+                    for(const auto & id : lookups)
+                    {
+                        OCIO::CDLTransform::CreateFromFile(cccFile.c_str(), id.c_str());
+                    }
+                }
+                catch(...)
+                {
+                    failed = true;
+                }
+            });
+        }
+
+        for(auto & thread : threads)
+        {
+            thread.join();
+        }
+        m.pause();
+    }
+
+    if(failed)
+    {
+        throw OCIO::Exception("Failed to resolve the ids of the ccc file.");
+    }
+}
+
 int main(int argc, const char **argv)
 {
     bool verbose = false;
     signed int testType = 0;
     std::string transformFile;
+    std::string matrixValues;
     std::string inputColorSpace, outputColorSpace;
     std::string filepath;
+    int syntheticWidth = 0, syntheticHeight = 0;
+    bool inverse = false;
     unsigned iterations = 10;
     std::string outBitDepthStr("auto");
+    std::string optimizationStr("default");
+    std::string cccFile;
+    unsigned numThreads = 0;
 
     bool help = false;
 
     ArgParse ap;
     ap.options("ocioperf -- apply and measure a color transformation processing\n\n"
-               "usage: ocioperf [options] --image inputimage\n\n",
+               "usage: ocioperf [options] --image inputimage\n"
+               "   or: ocioperf [options] --synthetic width height\n"
+               "   or: ocioperf [options] --ccc cccfile\n\n",
                "--h", &help, "Display the help and exit",
                "--v", &verbose, "Display some general information",
                "--test %d", &testType, "Define the type of processing to measure: "\
                                        "0 means on the complete image (the default), 1 is line-by-line, "\
-                                       "2 is pixel-per-pixel and -1 performs all the test types",
+                                       "2 is pixel-per-pixel, 3 is tile-by-tile (i.e. 16, 64 "\
+                                       "and 256 lines) and -1 performs all the test types",
                "--transform %s", &transformFile, "Provide the transform file to apply on the image",
+               "--inverse", &inverse, "Apply the inverse of the transform file",
+               "--matrix %s", &matrixValues, "Provide the comma separated values of a matrix to apply "\
+                                             "on the image i.e. 9 values (3x3), 12 values (3x3 and "\
+                                             "offsets), 16 values (4x4) or 20 values (4x4 and offsets)",
                "--colorspaces %s %s", &inputColorSpace, &outputColorSpace,
                                       "Provide the input and output color spaces to apply on the image",
                "--image %s", &filepath, "Provide the filepath of the image to process",
+               "--synthetic %d %d", &syntheticWidth, &syntheticHeight,
+                                    "Process a generated RGBA 32-bit float image of the given size "\
+                                    "instead of an image file",
                "--iter %d", &iterations, "Provide the number of iterations on the processing. Default is 10",
                "--out %s", &outBitDepthStr, "Provide an output bit-depth (auto, ui16, f32)"\
                                             " where auto preserves the input bit-depth",
+               "--optim %s", &optimizationStr, "Provide the optimization level (none, lossless, "\
+                                               "verygood, good, draft or default) e.g. lossless "\
+                                               "uses the exact inverse of the 1D LUTs",
+               "--ccc %s", &cccFile, "Measure the concurrent lookups of the color corrections of a "\
+                                     "ccc file by id, instead of processing an image",
+               "--threads %d", &numThreads, "Provide the number of threads resolving the ccc ids. "\
+                                            "Default is 0 i.e. all the cores",
                NULL);
 
     if(ap.parse (argc, argv) < 0) {
@@ -312,11 +502,34 @@ int main(int argc, const char **argv)
         }
     }
 
+    if(!cccFile.empty())
+    {
+        try
+        {
+            ResolveCCCIds(cccFile, numThreads, iterations);
+        }
+        catch(OCIO::Exception & exception)
+        {
+            std::cerr << "OCIO Error: " << exception.what() << std::endl;
+            exit(1);
+        }
+
+        return 0;
+    }
+
     OIIO::ImageSpec spec;
     OCIO::ImgBuffer img;
-    LoadImage(filepath, verbose, spec, img);
+    if(syntheticWidth!=0 || syntheticHeight!=0)
+    {
+        CreateImage(syntheticWidth, syntheticHeight, spec, img);
+    }
+    else
+    {
+        LoadImage(filepath, verbose, spec, img);
+    }
 
     outBitDepthStr = pystring::lower(outBitDepthStr);
+    optimizationStr = pystring::lower(optimizationStr);
 
     // Process the image.
     try
@@ -334,8 +547,63 @@ int main(int argc, const char **argv)
             // Get the transform.
             OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
             transform->setSrc(transformFile.c_str());
+            if(inverse)
+            {
+                transform->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+            }
 
-            // Get the processor
+            // Get the processor, the caches are cleared to measure the file parsing.
+            {
+                Measure m("Load the transform file:", iterations);
+                for(unsigned iter=0; iter<iterations; ++iter)
+                {
+                    OCIO::ClearAllCaches();
+
+                    m.resume();
+                    processor = config->getProcessor(transform);
+                    m.pause();
+                }
+            }
+        }
+        else if(!matrixValues.empty())
+        {
+            std::vector<std::string> values;
+            pystring::split(matrixValues, values, ",");
+
+            double m44[16] = { 1.0, 0.0, 0.0, 0.0,
+                               0.0, 1.0, 0.0, 0.0,
+                               0.0, 0.0, 1.0, 0.0,
+                               0.0, 0.0, 0.0, 1.0 };
+            double offset4[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+            const size_t dim = (values.size() == 9 || values.size() == 12) ? 3 : 4;
+            if (values.size() != 9 && values.size() != 12
+                && values.size() != 16 && values.size() != 20)
+            {
+                throw OCIO::Exception("The matrix needs 9, 12, 16 or 20 values.");
+            }
+
+            for (size_t idx = 0; idx < values.size(); ++idx)
+            {
+                const double val = std::stod(values[idx]);
+                if (idx < dim * dim)
+                {
+                    m44[4 * (idx / dim) + idx % dim] = val;
+                }
+                else
+                {
+                    offset4[idx - dim * dim] = val;
+                }
+            }
+
+            std::cout << std::endl;
+            std::cout << "Processing using the matrix '" << matrixValues << "'" << std::endl;
+
+            OCIO::MatrixTransformRcPtr transform = OCIO::MatrixTransform::Create();
+            transform->setMatrix(m44);
+            transform->setOffset(offset4);
+
+            OCIO::ConstConfigRcPtr config = OCIO::Config::Create();
             processor = config->getProcessor(transform);
         }
         else if(!inputColorSpace.empty() && !outputColorSpace.empty())
@@ -382,10 +650,47 @@ int main(int argc, const char **argv)
             throw OCIO::Exception(err.c_str());
         }
 
+        OCIO::OptimizationFlags optimization = OCIO::OPTIMIZATION_DEFAULT;
+        if(optimizationStr=="none")
+        {
+            optimization = OCIO::OPTIMIZATION_NONE;
+        }
+        else if(optimizationStr=="lossless")
+        {
+            optimization = OCIO::OPTIMIZATION_LOSSLESS;
+        }
+        else if(optimizationStr=="verygood")
+        {
+            optimization = OCIO::OPTIMIZATION_VERY_GOOD;
+        }
+        else if(optimizationStr=="good")
+        {
+            optimization = OCIO::OPTIMIZATION_GOOD;
+        }
+        else if(optimizationStr=="draft")
+        {
+            optimization = OCIO::OPTIMIZATION_DRAFT;
+        }
+        else if(optimizationStr!="default")
+        {
+            std::string err("Unsupported optimization level: ");
+            err += optimizationStr;
+            throw OCIO::Exception(err.c_str());
+        }
+
         // Get the CPU processor.
         OCIO::ConstCPUProcessorRcPtr cpuProcessor
-            = processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth,
-                                                  OCIO::OPTIMIZATION_DEFAULT);
+            = processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth, optimization);
+
+        if(verbose)
+        {
+            unsigned long long uniqueSize = 0, logicalSize = 0;
+            OCIO::GetLutMemoryUsage(uniqueSize, logicalSize);
+
+            std::cout << std::endl;
+            std::cout << "LUT memory: " << uniqueSize << " bytes ("
+                      << logicalSize << " bytes without sharing)" << std::endl;
+        }
 
         if(testType==0 || testType==-1)
         {
@@ -452,6 +757,26 @@ int main(int argc, const char **argv)
             }
         }
 
+        if((testType==3 || testType==-1) && (inBitDepth==outBitDepth))
+        {
+            // Process tile by tile, for example like an interactive viewer changing the
+            // dynamic properties (refer to the ExposureContrastTransform).
+
+            for(int tileHeight : { 16, 64, 256 })
+            {
+                std::ostringstream oss;
+                oss << "Process the complete image (in place) but tile by tile of "
+                    << tileHeight << " lines:";
+
+                Measure m(oss.str().c_str(), iterations);
+
+                for(unsigned iter=0; iter<iterations; ++iter)
+                {
+                    ProcessTiles(m, cpuProcessor, spec, img, tileHeight);
+                }
+            }
+        }
+
         if((testType==2 || testType==-1) && inBitDepth==outBitDepth)
         {
             // Process pixel per pixel if the image buffer is packed RGBA 32-bit float.
@@ -277,6 +277,29 @@ class Baker:
         """
         pass
 
+    def setNumThreads(self, numThreads):
+        """
+        setNumThreads(numThreads)
+
+        Set the number of threads used to evaluate the baked LUT values. The
+        default value 0 uses the number of hardware threads.
+
+        :param numThreads: number of threads
+        :type numThreads: int
+        """
+        pass
+
+    def getNumThreads(self):
+        """
+        getNumThreads()
+
+        Get the number of threads used to evaluate the baked LUT values.
+
+        :return: number of threads
+        :rtype: int
+        """
+        pass
+
     def bake(self):
         """
         bake()
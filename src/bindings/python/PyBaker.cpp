@@ -54,6 +54,8 @@ PyObject * PyOCIO_Baker_setShaperSize(PyObject * self, PyObject * args);
 PyObject * PyOCIO_Baker_getShaperSize(PyObject * self, PyObject *);
 PyObject * PyOCIO_Baker_setCubeSize(PyObject * self, PyObject * args);
 PyObject * PyOCIO_Baker_getCubeSize(PyObject * self, PyObject *);
+PyObject * PyOCIO_Baker_setNumThreads(PyObject * self, PyObject * args);
+PyObject * PyOCIO_Baker_getNumThreads(PyObject * self, PyObject *);
 PyObject * PyOCIO_Baker_bake(PyObject * self, PyObject *);
 PyObject * PyOCIO_Baker_getNumFormats(PyObject * self, PyObject *);
 PyObject * PyOCIO_Baker_getFormatNameByIndex(PyObject * self, PyObject * args);
@@ -99,6 +101,10 @@ PyMethodDef PyOCIO_Baker_methods[] = {
     PyOCIO_Baker_setCubeSize, METH_VARARGS, BAKER_SETCUBESIZE__DOC__ },
     { "getCubeSize",
     (PyCFunction) PyOCIO_Baker_getCubeSize, METH_NOARGS, BAKER_GETCUBESIZE__DOC__ },
+    { "setNumThreads",
+    PyOCIO_Baker_setNumThreads, METH_VARARGS, BAKER_SETNUMTHREADS__DOC__ },
+    { "getNumThreads",
+    (PyCFunction) PyOCIO_Baker_getNumThreads, METH_NOARGS, BAKER_GETNUMTHREADS__DOC__ },
     { "bake",
     (PyCFunction) PyOCIO_Baker_bake, METH_NOARGS, BAKER_BAKE__DOC__ },
     { "getNumFormats",
@@ -351,6 +357,26 @@ PyObject * PyOCIO_Baker_getCubeSize(PyObject * self, PyObject *)
     OCIO_PYTRY_EXIT(NULL)
 }
 
+PyObject * PyOCIO_Baker_setNumThreads(PyObject * self, PyObject * args)
+{
+    OCIO_PYTRY_ENTER()
+    int numThreads = 0;
+    if (!PyArg_ParseTuple(args,"i:setNumThreads",
+        &numThreads)) return NULL;
+    BakerRcPtr baker = GetEditableBaker(self);
+    baker->setNumThreads(numThreads);
+    Py_RETURN_NONE;
+    OCIO_PYTRY_EXIT(NULL)
+}
+
+PyObject * PyOCIO_Baker_getNumThreads(PyObject * self, PyObject *)
+{
+    OCIO_PYTRY_ENTER()
+    ConstBakerRcPtr baker = GetConstBaker(self);
+    return PyInt_FromLong(baker->getNumThreads());
+    OCIO_PYTRY_EXIT(NULL)
+}
+
 PyObject * PyOCIO_Baker_bake(PyObject * self, PyObject *)
 {
     OCIO_PYTRY_ENTER()
@@ -3,6 +3,8 @@
 
 #include "Baker.cpp"
 
+#include "BakingUtils.h"
+
 #include "UnitTest.h"
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -146,3 +148,74 @@ OCIO_ADD_TEST(Baker, empty_config)
     std::ostringstream os;
     OCIO_CHECK_THROW_WHAT(bake->bake(os), OCIO::Exception, "No OCIO config has been set");
 }
+
+OCIO_ADD_TEST(Baker, num_threads)
+{
+    static const std::string myProfile =
+        "ocio_profile_version: 1\n"
+        "\n"
+        "strictparsing: false\n"
+        "\n"
+        "colorspaces :\n"
+        "  - !<ColorSpace>\n"
+        "    name : lnh\n"
+        "    isdata : false\n"
+        "    allocation : lg2\n"
+        "    allocationvars : [-8, 5]\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name : test\n"
+        "    isdata : false\n"
+        "    to_reference : !<GroupTransform>\n"
+        "      children:\n"
+        "        - !<MatrixTransform> {matrix: [0.5, 0.3, 0.2, 0, 0.1, 0.8, 0.1, 0, 0.2, 0.1, 0.7, 0, 0, 0, 0, 1]}\n"
+        "        - !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}\n";
+
+    std::istringstream is(myProfile);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+
+    OCIO::BakerRcPtr bake = OCIO::Baker::Create();
+    OCIO_CHECK_EQUAL(bake->getNumThreads(), 0);
+    OCIO_CHECK_THROW_WHAT(bake->setNumThreads(-1), OCIO::Exception, "cannot be negative");
+
+    bake->setConfig(config);
+    bake->setInputSpace("lnh");
+    bake->setTargetSpace("test");
+    bake->setShaperSize(1024);
+    // Large enough to be split across several threads.
+    bake->setCubeSize(33);
+
+    // The baked LUTs do not depend on the number of threads.
+    for (const char * format : { "cinespace", "flame", "iridas_cube", "resolve_cube",
+                                 OCIO::FILEFORMAT_CTF })
+    {
+        bake->setFormat(format);
+
+        bake->setNumThreads(1);
+        std::ostringstream ref;
+        OCIO_CHECK_NO_THROW(bake->bake(ref));
+
+        bake->setNumThreads(4);
+        OCIO_CHECK_EQUAL(bake->getNumThreads(), 4);
+        std::ostringstream res;
+        OCIO_CHECK_NO_THROW(bake->bake(res));
+
+        OCIO_CHECK_ASSERT(ref.str() == res.str());
+        OCIO_CHECK_ASSERT(ref.str().size() > 35937 * 3);
+    }
+
+    // The cube domain matches the identity LUT.
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = config->getProcessor("lnh", "test")->getDefaultCPUProcessor());
+
+    for (const auto order : { OCIO::LUT3DORDER_FAST_RED, OCIO::LUT3DORDER_FAST_BLUE })
+    {
+        std::vector<float> ref(33 * 33 * 33 * 3);
+        OCIO::GenerateIdentityLut3D(ref.data(), 33, 3, order);
+        OCIO::PackedImageDesc img(ref.data(), 33 * 33 * 33, 1, 3);
+        cpu->apply(img);
+
+        OCIO_CHECK_ASSERT(OCIO::BakeLut3D(*bake, 33, order, { cpu }) == ref);
+    }
+}
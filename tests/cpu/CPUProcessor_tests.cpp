@@ -816,7 +816,7 @@ OCIO_ADD_TEST(CPUProcessor, with_several_ops)
 
             const std::string cacheID{ cpuProcessor->getCacheID() };
 
-            const std::string expectedID("CPU Processor: from 16ui to 32f oFlags 122879 ops"
+            const std::string expectedID("CPU Processor: from 16ui to 32f oFlags 36823039 ops"
                 ": <Lut1D $a57d7444e629d796d2234c18a0539c74 forward default standard domain none >");
 
             // Test integer optimization. The ops should be optimized into a single LUT
@@ -2008,6 +2008,56 @@ OCIO_ADD_TEST(CPUProcessor, one_pixel)
     }
 }
 
+OCIO_ADD_TEST(CPUProcessor, one_pixel_several_ops)
+{
+    // The first and last ops are applied by the bit-depth conversions so only the middle op
+    // remains in the list of CPU ops. Check that applyRGB() applies it to the processed values.
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr offset = OCIO::MatrixTransform::Create();
+    constexpr double offset4[4] = { 0.1, 0.2, 0.3, 0.0 };
+    offset->setOffset(offset4);
+    group->appendTransform(offset);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    constexpr double exp4[4] = { 2.0, 2.0, 2.0, 1.0 };
+    exponent->setValue(exp4);
+    group->appendTransform(exponent);
+
+    OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+    constexpr double m44[16] = { 0.5, 0.0, 0.0, 0.0,
+                                 0.0, 0.5, 0.0, 0.0,
+                                 0.0, 0.0, 0.5, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+    scale->setMatrix(m44);
+    group->appendTransform(scale);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor
+        = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                              OCIO::OPTIMIZATION_NONE));
+
+    float rgba[4]{ 0.1f, 0.3f, 0.9f, 1.0f };
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGBA(rgba));
+
+    OCIO_CHECK_CLOSE(rgba[0], 0.5f * 0.2f * 0.2f, 1e-6f);
+    OCIO_CHECK_CLOSE(rgba[1], 0.5f * 0.5f * 0.5f, 1e-6f);
+    OCIO_CHECK_CLOSE(rgba[2], 0.5f * 1.2f * 1.2f, 1e-6f);
+
+    float rgb[3]{ 0.1f, 0.3f, 0.9f };
+    OCIO_CHECK_NO_THROW(cpuProcessor->applyRGB(rgb));
+
+    OCIO_CHECK_EQUAL(rgb[0], rgba[0]);
+    OCIO_CHECK_EQUAL(rgb[1], rgba[1]);
+    OCIO_CHECK_EQUAL(rgb[2], rgba[2]);
+}
+
 namespace
 {
 
@@ -2186,3 +2236,277 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
     }
 }
 
+namespace
+{
+
+OCIO::ConstProcessorRcPtr BuildNeutralAxisProcessor()
+{
+    // A color processing with crosstalk between the channels.
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.2, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+
+    OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+    const double slope[3]  = { 1.1, 1.0, 0.9 };
+    const double offset[3] = { 0.01, 0.0, -0.01 };
+    const double power[3]  = { 1.2, 1.0, 0.8 };
+    cdl->setSlope(slope);
+    cdl->setOffset(offset);
+    cdl->setPower(power);
+    cdl->setSat(1.3);
+    group->appendTransform(cdl);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    return config->getProcessor(group);
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ApplyProcessor(const OCIO::ConstProcessorRcPtr & processor,
+                    OCIO::OptimizationFlags flags,
+                    const std::vector<typename OCIO::BitDepthInfo<inBD>::Type> & inImg,
+                    std::vector<typename OCIO::BitDepthInfo<outBD>::Type> & outImg,
+                    OCIO::ConstCPUProcessorRcPtr & cpu)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    OCIO_CHECK_NO_THROW(cpu = processor->getOptimizedCPUProcessor(inBD, outBD, flags));
+
+    const long numPixels = long(inImg.size() / 4);
+    outImg.resize(inImg.size());
+
+    const OCIO::PackedImageDesc srcImgDesc((void *)&inImg[0], numPixels, 1, 4,
+                                           inBD, sizeof(InType),
+                                           OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc dstImgDesc(&outImg[0], numPixels, 1, 4,
+                                     outBD, sizeof(OutType),
+                                     OCIO::AutoStride, OCIO::AutoStride);
+
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImgDesc, dstImgDesc));
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ApplyNeutralAxis(const OCIO::ConstProcessorRcPtr & processor,
+                      OCIO::OptimizationFlags flags,
+                      const std::vector<typename OCIO::BitDepthInfo<inBD>::Type> & inImg,
+                      std::vector<typename OCIO::BitDepthInfo<outBD>::Type> & outImg,
+                      size_t & numNeutralAxisPixels)
+{
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    ApplyProcessor<inBD, outBD>(processor, flags, inImg, outImg, cpu);
+
+    numNeutralAxisPixels = cpu->getNumNeutralAxisPixels();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, neutral_axis)
+{
+    OCIO::ConstProcessorRcPtr processor = BuildNeutralAxisProcessor();
+
+    const OCIO::OptimizationFlags defaultFlags = OCIO::OPTIMIZATION_DEFAULT;
+    const OCIO::OptimizationFlags neutralFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_NEUTRAL_AXIS);
+    const OCIO::OptimizationFlags interpFlags
+        = OCIO::OptimizationFlags(neutralFlags | OCIO::OPTIMIZATION_NEUTRAL_AXIS_INTERPOLATION);
+
+    // Runs of 20 achromatic pixels alternating with runs of 20 colored pixels, and a run of
+    // achromatic pixels too short to be processed by the table.
+    std::vector<float> inImg;
+    for (int idx = 0; idx < 203; ++idx)
+    {
+        // The values are exact half floats.
+        const float val = float(idx % 64) / 32.0f - 0.5f;
+        if ((idx / 20) % 2 == 0 || idx >= 200)
+        {
+            inImg.insert(inImg.end(), { val, val, val, 0.5f });
+        }
+        else
+        {
+            inImg.insert(inImg.end(), { val, 0.3f, 0.9f - val, 1.0f });
+        }
+    }
+
+    // The achromatic pixels are exact half float values so the results are identical.
+    {
+        std::vector<float> ref, res;
+        size_t numRef = 0, numRes = 0;
+
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, defaultFlags,
+                                                                   inImg, ref, numRef);
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, neutralFlags,
+                                                                   inImg, res, numRes);
+
+        OCIO_CHECK_EQUAL(numRef, 0);
+        OCIO_CHECK_EQUAL(numRes, 100);
+
+        for (size_t idx = 0; idx < ref.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(res[idx], ref[idx], 1e-6f);
+        }
+    }
+
+    // The other values are only processed by the table when the interpolation is allowed.
+    {
+        std::vector<float> img(inImg);
+        for (auto & val : img)
+        {
+            val *= 1.001f;
+        }
+
+        std::vector<float> ref, res;
+        size_t numRef = 0, numRes = 0;
+
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, defaultFlags,
+                                                                   img, ref, numRef);
+
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, neutralFlags,
+                                                                   img, res, numRes);
+        OCIO_CHECK_EQUAL(numRes, 0);
+
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, interpFlags,
+                                                                   img, res, numRes);
+        OCIO_CHECK_EQUAL(numRes, 100);
+
+        for (size_t idx = 0; idx < ref.size(); ++idx)
+        {
+            OCIO_CHECK_CLOSE(res[idx], ref[idx], 1e-4f);
+        }
+    }
+
+    // All the integer code values are in the table.
+    {
+        std::vector<uint16_t> img(inImg.size());
+        for (size_t idx = 0; idx < img.size(); ++idx)
+        {
+            img[idx] = uint16_t(OCIO::Clamp(inImg[idx], 0.0f, 1.0f) * 65535.0f + 0.5f);
+        }
+
+        std::vector<uint8_t> ref, res;
+        size_t numRef = 0, numRes = 0;
+
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT8>(processor, defaultFlags,
+                                                                        img, ref, numRef);
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT8>(processor, neutralFlags,
+                                                                        img, res, numRes);
+        OCIO_CHECK_EQUAL(numRes, 100);
+
+        for (size_t idx = 0; idx < ref.size(); ++idx)
+        {
+            OCIO_CHECK_EQUAL(res[idx], ref[idx]);
+        }
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, neutral_axis_disabled)
+{
+    const OCIO::OptimizationFlags neutralFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_NEUTRAL_AXIS);
+
+    const std::vector<float> inImg(4 * 64, 0.5f);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    // The alpha channel is modified.
+    {
+        OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+        const double offset[4] = { 0.1, 0.1, 0.1, 0.1 };
+        matrix->setOffset(offset);
+
+        std::vector<float> res;
+        size_t numRes = 0;
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(config->getProcessor(matrix),
+                                                                   neutralFlags,
+                                                                   inImg, res, numRes);
+        OCIO_CHECK_EQUAL(numRes, 0);
+        OCIO_CHECK_CLOSE(res[0], 0.6f, 1e-6f);
+        OCIO_CHECK_CLOSE(res[3], 0.6f, 1e-6f);
+    }
+
+    // The dynamic properties could change the color processing.
+    {
+        OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+        ec->setExposure(1.0);
+        ec->makeExposureDynamic();
+
+        std::vector<float> res;
+        size_t numRes = 0;
+        ApplyNeutralAxis<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(config->getProcessor(ec),
+                                                                   neutralFlags,
+                                                                   inImg, res, numRes);
+        OCIO_CHECK_EQUAL(numRes, 0);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, run_length)
+{
+    OCIO::ConstProcessorRcPtr processor = BuildNeutralAxisProcessor();
+
+    const OCIO::OptimizationFlags defaultFlags = OCIO::OPTIMIZATION_DEFAULT;
+    const OCIO::OptimizationFlags runLengthFlags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_RUN_LENGTH);
+
+    // A run of 10 identical pixels, a run too short to be skipped, distinct pixels, and
+    // a run of 20 identical achromatic pixels ending the scanline.
+    std::vector<float> inImg;
+    for (int idx = 0; idx < 10; ++idx)
+    {
+        inImg.insert(inImg.end(), { 0.1f, 0.4f, 0.8f, 1.0f });
+    }
+    for (int idx = 0; idx < 3; ++idx)
+    {
+        inImg.insert(inImg.end(), { 0.7f, 0.2f, 0.3f, 0.5f });
+    }
+    for (int idx = 0; idx < 7; ++idx)
+    {
+        inImg.insert(inImg.end(), { 0.1f * idx, 0.2f, 0.3f, 1.0f });
+    }
+    for (int idx = 0; idx < 20; ++idx)
+    {
+        inImg.insert(inImg.end(), { 0.5f, 0.5f, 0.5f, 1.0f });
+    }
+
+    std::vector<float> ref, res;
+    OCIO::ConstCPUProcessorRcPtr cpu;
+
+    ApplyProcessor<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, defaultFlags,
+                                                             inImg, ref, cpu);
+    OCIO_CHECK_EQUAL(cpu->getNumSkippedPixels(), 0);
+
+    ApplyProcessor<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, runLengthFlags,
+                                                             inImg, res, cpu);
+    OCIO_CHECK_EQUAL(cpu->getNumSkippedPixels(), 9 + 19);
+
+    for (size_t idx = 0; idx < ref.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], ref[idx], 1e-6f);
+    }
+
+    // The count accumulates over the calls.
+    std::vector<float> outImg(inImg.size());
+    OCIO::PackedImageDesc srcImgDesc(&inImg[0], 40, 1, 4);
+    OCIO::PackedImageDesc dstImgDesc(&outImg[0], 40, 1, 4);
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImgDesc, dstImgDesc));
+    OCIO_CHECK_EQUAL(cpu->getNumSkippedPixels(), 2 * (9 + 19));
+
+    // The runs of achromatic pixels use the neutral axis table instead.
+    const OCIO::OptimizationFlags neutralFlags
+        = OCIO::OptimizationFlags(runLengthFlags | OCIO::OPTIMIZATION_NEUTRAL_AXIS);
+
+    ApplyProcessor<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(processor, neutralFlags,
+                                                             inImg, res, cpu);
+    OCIO_CHECK_EQUAL(cpu->getNumSkippedPixels(), 9);
+    OCIO_CHECK_EQUAL(cpu->getNumNeutralAxisPixels(), 20);
+
+    for (size_t idx = 0; idx < ref.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], ref[idx], 1e-6f);
+    }
+}
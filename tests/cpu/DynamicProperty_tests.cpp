@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <atomic>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "DynamicProperty.cpp"
 
@@ -65,6 +68,136 @@ OCIO_ADD_TEST(DynamicPropertyImpl, equal)
     OCIO_CHECK_ASSERT(*dp0 == *dp1);
 }
 
+OCIO_ADD_TEST(DynamicPropertyImpl, version)
+{
+    OCIO::DynamicPropertyImplRcPtr dpImpl =
+        std::make_shared<OCIO::DynamicPropertyImpl>(OCIO::DYNAMIC_PROPERTY_EXPOSURE, 1.0, true);
+
+    unsigned version = 1;
+    OCIO_CHECK_EQUAL(dpImpl->getDoubleValue(version), 1.0);
+    OCIO_CHECK_EQUAL(version, 0);
+
+    // Each change of the value increments the version, which is even when the value is stable.
+    dpImpl->setValue(2.0);
+    OCIO_CHECK_EQUAL(dpImpl->getDoubleValue(version), 2.0);
+    OCIO_CHECK_EQUAL(version, 2);
+
+    dpImpl->setValue(2.0);
+    OCIO_CHECK_EQUAL(dpImpl->getDoubleValue(version), 2.0);
+    OCIO_CHECK_EQUAL(version, 4);
+
+    // The copy has the same value.
+    OCIO::DynamicPropertyImpl copy(*dpImpl);
+    OCIO_CHECK_EQUAL(copy.getDoubleValue(), 2.0);
+}
+
+OCIO_ADD_TEST(DynamicPropertySnapshot, latch)
+{
+    OCIO::DynamicPropertyImplRcPtr exposure =
+        std::make_shared<OCIO::DynamicPropertyImpl>(OCIO::DYNAMIC_PROPERTY_EXPOSURE, 1.0, true);
+    OCIO::DynamicPropertyImplRcPtr contrast =
+        std::make_shared<OCIO::DynamicPropertyImpl>(OCIO::DYNAMIC_PROPERTY_CONTRAST, 0.5, true);
+
+    OCIO::DynamicPropertySnapshot snapshot;
+    snapshot.latch(*exposure);
+
+    exposure->setValue(3.0);
+    contrast->setValue(0.8);
+
+    // The latched value is not changed, the other property is not latched.
+    unsigned version = 1;
+    OCIO_CHECK_EQUAL(snapshot.getDoubleValue(*exposure, version), 1.0);
+    OCIO_CHECK_EQUAL(version, 0);
+    OCIO_CHECK_EQUAL(snapshot.getDoubleValue(*contrast), 0.8);
+
+    // Latch again.
+    snapshot.latch(*exposure);
+    OCIO_CHECK_EQUAL(snapshot.getDoubleValue(*exposure, version), 3.0);
+    OCIO_CHECK_EQUAL(version, 2);
+}
+
+OCIO_ADD_TEST(DynamicPropertyCache, get_set)
+{
+    OCIO::DynamicPropertyCache<2, 1> cache;
+
+    const unsigned versions[2] = { 0, 2 };
+    float values[1] = { 0.f };
+
+    // Empty cache.
+    OCIO_CHECK_ASSERT(!cache.get(versions, values));
+
+    values[0] = 1.5f;
+    cache.set(versions, values);
+
+    values[0] = 0.f;
+    OCIO_CHECK_ASSERT(cache.get(versions, values));
+    OCIO_CHECK_EQUAL(values[0], 1.5f);
+
+    // A property changed.
+    const unsigned newVersions[2] = { 0, 4 };
+    OCIO_CHECK_ASSERT(!cache.get(newVersions, values));
+
+    // The values computed while a property is being changed are never cached.
+    const unsigned oddVersions[2] = { 1, 4 };
+    values[0] = 2.5f;
+    cache.set(oddVersions, values);
+    OCIO_CHECK_ASSERT(!cache.get(oddVersions, values));
+    OCIO_CHECK_ASSERT(cache.get(versions, values));
+    OCIO_CHECK_EQUAL(values[0], 1.5f);
+}
+
+OCIO_ADD_TEST(DynamicPropertyCache, concurrent_get_set)
+{
+    // The readers must never get the values of an entry partially updated by a writer, i.e.
+    // the values must always match the versions they were stored with.
+
+    OCIO::DynamicPropertyCache<2, 2> cache;
+
+    static constexpr unsigned NumThreads    = 4;
+    static constexpr unsigned NumIterations = 200000;
+    static constexpr unsigned NumVersions   = 8;
+
+    std::atomic<unsigned> numMismatches{ 0 };
+    std::atomic<unsigned> numHits{ 0 };
+
+    std::vector<std::thread> threads;
+    for (unsigned thread = 0; thread < NumThreads; ++thread)
+    {
+        threads.emplace_back([&, thread]()
+        {
+            for (unsigned iter = 0; iter < NumIterations; ++iter)
+            {
+                const unsigned key = (iter / 4 + thread) % NumVersions;
+                const unsigned versions[2] = { 2 * key, 4 * key };
+
+                float values[2] = { -1.f, -1.f };
+                if (cache.get(versions, values))
+                {
+                    ++numHits;
+                    if (values[0] != (float)key || values[1] != -(float)key)
+                    {
+                        ++numMismatches;
+                    }
+                }
+                else
+                {
+                    values[0] = (float)key;
+                    values[1] = -(float)key;
+                    cache.set(versions, values);
+                }
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(numMismatches.load(), 0u);
+    OCIO_CHECK_ASSERT(numHits.load() > 0u);
+}
+
 namespace
 {
 OCIO::ConstProcessorRcPtr LoadTransformFile(const std::string & fileName)
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "LutCache.cpp"
+
+#include "UnitTest.h"
+#include "UnitTestUtils.h"
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace OCIO = OCIO_NAMESPACE;
+
+OCIO_ADD_TEST(LutCache, serialization)
+{
+    auto lut1d = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_STANDARD, 33);
+    lut1d->setHueAdjust(OCIO::HUE_DW3);
+    lut1d->setInterpolation(OCIO::INTERP_LINEAR);
+    lut1d->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    lut1d->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    lut1d->getArray()[50] = 0.25f;
+
+    auto lut3d = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 5);
+    lut3d->setFileOutputBitDepth(OCIO::BIT_DEPTH_F16);
+    lut3d->getArray()[10] = -1.5f;
+
+    OCIO::LutCacheWriter writer;
+    writer.writeLut1D(lut1d);
+    writer.writeLut1D(OCIO::ConstLut1DOpDataRcPtr());
+    writer.writeLut3D(lut3d);
+    writer.writeString("text");
+    writer.write<float>(0.5f);
+
+    const std::string & buffer = writer.getBuffer();
+
+    OCIO::LutCacheReader reader(buffer.c_str(), buffer.size());
+
+    OCIO::Lut1DOpDataRcPtr res1d;
+    OCIO_CHECK_NO_THROW(res1d = reader.readLut1D());
+    OCIO_REQUIRE_ASSERT(res1d);
+    OCIO_CHECK_ASSERT(*res1d == *lut1d);
+    OCIO_CHECK_EQUAL(res1d->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+    OCIO_CHECK_EQUAL(res1d->getArray()[50], 0.25f);
+
+    OCIO_CHECK_ASSERT(!reader.readLut1D());
+
+    OCIO::Lut3DOpDataRcPtr res3d;
+    OCIO_CHECK_NO_THROW(res3d = reader.readLut3D());
+    OCIO_REQUIRE_ASSERT(res3d);
+    OCIO_CHECK_ASSERT(*res3d == *lut3d);
+    OCIO_CHECK_EQUAL(res3d->getFileOutputBitDepth(), OCIO::BIT_DEPTH_F16);
+
+    OCIO_CHECK_EQUAL(reader.readString(), "text");
+    OCIO_CHECK_EQUAL(reader.read<float>(), 0.5f);
+    OCIO_CHECK_ASSERT(reader.atEnd());
+
+    // Truncated data.
+    OCIO::LutCacheReader truncated(buffer.c_str(), buffer.size() - 16);
+    OCIO_CHECK_NO_THROW(truncated.readLut1D());
+    OCIO_CHECK_NO_THROW(truncated.readLut1D());
+    OCIO_CHECK_THROW_WHAT(truncated.readLut3D(), OCIO::Exception, "truncated");
+}
+
+namespace
+{
+void ApplyProcessor(const OCIO::ConstProcessorRcPtr & processor, float * rgb)
+{
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = processor->getDefaultCPUProcessor());
+    OCIO_CHECK_NO_THROW(cpu->applyRGB(rgb));
+}
+} // anon.
+
+OCIO_ADD_TEST(LutCache, load_and_save)
+{
+    const std::string filepath = std::string(OCIO::getTestFilesDir()) + "/iridas_3d.cube";
+
+    // Reference without the cache.
+    OCIO::ClearAllCaches();
+    OCIO::SetLutCacheDirectory("");
+
+    float ref[3]{ 0.1f, 0.5f, 0.9f };
+    ApplyProcessor(OCIO::GetFileTransformProcessor("iridas_3d.cube"), ref);
+
+    std::string directory;
+    OCIO::Platform::CreateTempFilename(directory, "");
+
+    OCIO::ClearAllCaches();
+    OCIO::SetLutCacheDirectory(directory.c_str());
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetLutCacheDirectory()), directory);
+
+    // The file is not in the cache yet.
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr fromCache;
+    OCIO_CHECK_ASSERT(!OCIO::LoadFromLutCache(format, fromCache, filepath));
+
+    // Loading the file stores it in the cache (i.e. the cache directory is created).
+    float res[3]{ 0.1f, 0.5f, 0.9f };
+    ApplyProcessor(OCIO::GetFileTransformProcessor("iridas_3d.cube"), res);
+    OCIO_CHECK_EQUAL(res[0], ref[0]);
+
+    std::vector<OCIO::LutCacheFile> files;
+    OCIO::ListLutCacheFiles(directory, files);
+    OCIO_REQUIRE_EQUAL(files.size(), 1);
+
+    // The cache entry holds the parsed file.
+    OCIO_REQUIRE_ASSERT(OCIO::LoadFromLutCache(format, fromCache, filepath));
+    OCIO_REQUIRE_ASSERT(format);
+    OCIO_CHECK_EQUAL(format->getName(), "iridas_cube");
+
+    OCIO::CachedFileRcPtr parsed;
+    {
+        std::ifstream file(filepath.c_str());
+        OCIO_CHECK_NO_THROW(parsed = format->read(file, filepath));
+    }
+
+    OCIO::LutCacheWriter parsedWriter, cachedWriter;
+    OCIO_CHECK_ASSERT(format->serializeCachedFile(parsedWriter, parsed));
+    OCIO_CHECK_ASSERT(format->serializeCachedFile(cachedWriter, fromCache));
+    OCIO_CHECK_ASSERT(parsedWriter.getBuffer() == cachedWriter.getBuffer());
+
+    // Another process uses the cache entry.
+    OCIO::ClearAllCaches();
+    float res2[3]{ 0.1f, 0.5f, 0.9f };
+    ApplyProcessor(OCIO::GetFileTransformProcessor("iridas_3d.cube"), res2);
+    OCIO_CHECK_EQUAL(res2[0], ref[0]);
+    OCIO_CHECK_EQUAL(res2[1], ref[1]);
+    OCIO_CHECK_EQUAL(res2[2], ref[2]);
+
+    // A truncated entry is ignored.
+    {
+        std::ofstream file(files[0].path.c_str(), std::ios_base::binary | std::ios_base::trunc);
+        file << "OCIOLUTC";
+    }
+    OCIO_CHECK_ASSERT(!OCIO::LoadFromLutCache(format, fromCache, filepath));
+
+    // The oldest entries are removed when the cache is too large.
+    OCIO::TrimLutCache(directory, 0);
+
+    files.clear();
+    OCIO::ListLutCacheFiles(directory, files);
+    OCIO_CHECK_EQUAL(files.size(), 0);
+
+    // An entry larger than the maximum size is not stored.
+    OCIO::SetLutCacheMaxSize(16);
+    OCIO_CHECK_EQUAL(OCIO::GetLutCacheMaxSize(), 16);
+
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor("iridas_3d.cube"));
+
+    OCIO::ListLutCacheFiles(directory, files);
+    OCIO_CHECK_EQUAL(files.size(), 0);
+
+    OCIO::SetLutCacheDirectory("");
+    OCIO::SetLutCacheMaxSize(OCIO::DEFAULT_LUT_CACHE_MAX_SIZE);
+    OCIO::ClearAllCaches();
+
+#if defined(_WIN32)
+    _rmdir(directory.c_str());
+#else
+    rmdir(directory.c_str());
+#endif
+}
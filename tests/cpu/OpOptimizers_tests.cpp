@@ -24,6 +24,11 @@ OCIO::OptimizationFlags AllBut(OCIO::OptimizationFlags notFlag)
     return static_cast<OCIO::OptimizationFlags>(OCIO::OPTIMIZATION_ALL & ~notFlag);
 }
 
+OCIO::OptimizationFlags DefaultBut(OCIO::OptimizationFlags notFlag)
+{
+    return static_cast<OCIO::OptimizationFlags>(OCIO::OPTIMIZATION_DEFAULT & ~notFlag);
+}
+
 void Clone(OCIO::OpRcPtrVec & cloned, const OCIO::OpRcPtrVec toClone)
 {
     cloned.clear();
@@ -517,8 +522,11 @@ OCIO_ADD_TEST(OpOptimizers, optimization2)
     OCIO_CHECK_EQUAL(optOps.size(), 13);
 
     // No need to remove OPTIMIZATION_COMP_SEPARABLE_PREFIX because optimization is for F32.
+    // The fusion of the ops around the Lut3D is disabled to validate each op.
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_GOOD & ~OCIO::OPTIMIZATION_FUSE_LUT3D_STAGES);
     OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optOps, OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
-                                            OCIO::OPTIMIZATION_GOOD));
+                                            flags));
     OCIO_REQUIRE_EQUAL(optOps.size(), 4);
 
     // Op 1 is exactly an identity except for the first value which is 0.000001. Since the
@@ -1353,6 +1361,401 @@ OCIO_ADD_TEST(OpOptimizers, opt_prefix_test1)
 
     auto lut0 = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut1DOpData>(o0->data());
     OCIO_CHECK_ASSERT(!lut0->isIdentity());
-    OCIO_CHECK_EQUAL(lut0->getArray().getLength(), 65536u);
+    // OPTIMIZATION_ALL contains OPTIMIZATION_COMP_SEPARABLE_LUT1D so the half domain LUT of
+    // the prefix is collapsed into a standard domain keeping the 32 entries of the first LUT
+    // on its grid (i.e. 31 * 1024 + 1 entries).
+    OCIO_CHECK_ASSERT(!lut0->isInputHalfDomain());
+    OCIO_CHECK_EQUAL(lut0->getArray().getLength(), 31745u);
+}
+
+
+OCIO_ADD_TEST(OpOptimizers, separable_lut1d_runs)
+{
+    // Runs of separable ops containing a Lut1D are collapsed into a single Lut1D.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO::Lut1DOpDataRcPtr lut1 = std::make_shared<OCIO::Lut1DOpData>(1024);
+    OCIO::Array::Values & vals1 = lut1->getArray().getValues();
+    for (unsigned long i = 0; i < 1024; ++i)
+    {
+        const float val = std::pow(float(i) / 1023.0f, 2.4f);
+        vals1[3 * i + 0] = val;
+        vals1[3 * i + 1] = val * 0.9f;
+        vals1[3 * i + 2] = val * 1.1f;
+    }
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(originalOps, lut1, OCIO::TRANSFORM_DIR_FORWARD));
+
+    const double scale4[4] = { 0.9, 1.1, 1.0, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateScaleOp(originalOps, scale4, OCIO::TRANSFORM_DIR_FORWARD));
+
+    const double exp4[4] = { 2.2, 2.0, 1.8, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(originalOps, exp4, OCIO::TRANSFORM_DIR_FORWARD));
+
+    // The matrix has channel crosstalk so it splits the ops in two runs.
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.1, 0.9, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0.1, 0.9, 0., 1.,
+                                            OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::Lut1DOpDataRcPtr lut2 = std::make_shared<OCIO::Lut1DOpData>(256);
+    OCIO::Array::Values & vals2 = lut2->getArray().getValues();
+    for (unsigned long i = 0; i < 3 * 256; ++i)
+    {
+        vals2[i] = vals2[i] * vals2[i];
+    }
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(originalOps, lut2, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 6);
+
+    OCIO::OpRcPtrVec optimizedOps;
+    Clone(optimizedOps, originalOps);
+
+    // The optimization is disabled.
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            AllBut(OCIO::OPTIMIZATION_COMP_SEPARABLE_LUT1D)));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 6);
+
+    Clone(optimizedOps, originalOps);
+
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_GOOD));
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 3);
+    OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(optimizedOps[1]->getInfo(), "<MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(optimizedOps[2]->getInfo(), "<Lut1DOp>");
+
+    // The first run starts with a Lut1D so it clamps to [0,1] and a standard domain is used.
+    OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+    auto lutData0 = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_CHECK_ASSERT(!lutData0->isInputHalfDomain());
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 2e-5f, true);
+}
+
+OCIO_ADD_TEST(OpOptimizers, separable_lut1d_runs_extended_range)
+{
+    // Extended range values before the Lut1D are preserved by using a half domain.
+
+    OCIO::OpRcPtrVec originalOps;
+
+    const double scale4[4] = { 0.5, 0.25, 2.0, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateScaleOp(originalOps, scale4, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::Lut1DOpDataRcPtr lut
+        = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE, 65536);
+    OCIO::Array::Values & vals = lut->getArray().getValues();
+    for (unsigned long i = 0; i < 3 * 65536; ++i)
+    {
+        vals[i] = std::isfinite(vals[i]) ? vals[i] * 3.0f : vals[i];
+    }
+    OCIO_CHECK_NO_THROW(OCIO::CreateLut1DOp(originalOps, lut, OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::OpRcPtrVec optimizedOps;
+    Clone(optimizedOps, originalOps);
+
+    // The optimization is lossy so it is not part of the default optimization level.
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 2);
+
+    Clone(optimizedOps, originalOps);
+
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_GOOD));
+
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+    OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+    auto lutData0 = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_CHECK_ASSERT(lutData0->isInputHalfDomain());
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 1e-6f);
+
+    // An op modifying the alpha channel can not be collapsed.
+
+    const double alphaExp4[4] = { 1.0, 1.0, 1.0, 2.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(originalOps, alphaExp4,
+                                               OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 3);
+
+    Clone(optimizedOps, originalOps);
+
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_GOOD));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 3);
+}
+
+OCIO_ADD_TEST(OpOptimizers, eval_samples_accurate)
+{
+    // The reference of the error budgets is computed with the accurate pow function i.e. the
+    // error of the fast one (about 1e-5) is not part of the budgets.
+
+    const OCIO::GammaOpData::Params params = { 2.4 };
+    const OCIO::GammaOpData::Params paramsA = { 1. };
+    auto gamma = std::make_shared<OCIO::GammaOpData>(OCIO::GammaOpData::BASIC_FWD,
+                                                     params, params, params, paramsA);
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gamma, OCIO::TRANSFORM_DIR_FORWARD));
+
+    std::vector<float> samples;
+    OCIO::BuildSeparableLut1DSamples(samples);
+    std::vector<float> res(samples);
+    OCIO::EvalSamples(ops, res);
+
+    for (size_t idx = 0; idx < samples.size(); idx += 4)
+    {
+        const float in = samples[idx];
+        const float expected = in > 0.0f ? powf(in, 2.4f) : 0.0f;
+        OCIO_CHECK_ASSERT(OCIO::EqualWithSafeRelError(res[idx], expected, 1e-6f, 1.0f));
+    }
+}
+
+OCIO_ADD_TEST(OpOptimizers, bake_lut3d)
+{
+    // Expensive ops with channel crosstalk are baked into a Lut3D.
+
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.1, 0.9, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+
+    OCIO::OpRcPtrVec originalOps;
+
+    OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0., 1., 0., 1.,
+                                            OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO::FixedFunctionOpDataRcPtr func = std::make_shared<OCIO::FixedFunctionOpData>(
+        OCIO::FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD);
+    OCIO_CHECK_NO_THROW(OCIO::CreateFixedFunctionOp(originalOps, func,
+                                                    OCIO::TRANSFORM_DIR_FORWARD));
+
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 3);
+
+    OCIO::OpRcPtrVec optimizedOps;
+    Clone(optimizedOps, originalOps);
+
+    // The optimization is disabled.
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            AllBut(OCIO::OPTIMIZATION_BAKE_LUT3D)));
+    OCIO_CHECK_EQUAL(optimizedOps.size(), 3);
+
+    Clone(optimizedOps, originalOps);
+
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_ALL,
+                                            1e-3f));
+
+    // The range clamps to [0,1] so no shaper is needed.
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+    OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<Lut3DOp>");
+
+    OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+    auto lutData = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(o0->data());
+    OCIO_REQUIRE_ASSERT(lutData);
+    OCIO_CHECK_EQUAL(lutData->getArray().getLength(), 33);
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 1e-3f);
+}
+
+OCIO_ADD_TEST(OpOptimizers, bake_lut3d_shaper)
+{
+    // Unbounded values need a shaper Lut1D.
+
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.1, 0.9, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+
+    OCIO::OpRcPtrVec originalOps;
+
+    const double exp4[4] = { 1.2, 1.2, 1.2, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(originalOps, exp4, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(originalOps.size(), 2);
+
+    OCIO::OpRcPtrVec optimizedOps;
+    Clone(optimizedOps, originalOps);
+
+    // The error bound can not be met.
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_ALL,
+                                            1e-3f));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 2);
+    OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<ExponentOp>");
+    OCIO_CHECK_EQUAL(optimizedOps[1]->getInfo(), "<MatrixOffsetOp>");
+
+    OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::BIT_DEPTH_F32,
+                                            OCIO::OPTIMIZATION_ALL,
+                                            2e-2f));
+    OCIO_REQUIRE_EQUAL(optimizedOps.size(), 2);
+    OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<Lut1DOp>");
+    OCIO_CHECK_EQUAL(optimizedOps[1]->getInfo(), "<Lut3DOp>");
+
+    OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+    auto shaperData = OCIO::DynamicPtrCast<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_REQUIRE_ASSERT(shaperData);
+    OCIO_CHECK_ASSERT(shaperData->isInputHalfDomain());
+
+    OCIO::ConstOpRcPtr o1 = optimizedOps[1];
+    auto lutData = OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(o1->data());
+    OCIO_REQUIRE_ASSERT(lutData);
+    OCIO_CHECK_EQUAL(lutData->getArray().getLength(), 65);
+
+    CompareRender(originalOps, optimizedOps, __LINE__, 4e-2f, true);
+}
+
+namespace
+{
+OCIO::Lut3DOpDataRcPtr CreateCrosstalkLut3D(OCIO::Interpolation interp)
+{
+    auto lut = std::make_shared<OCIO::Lut3DOpData>(interp, 17);
+
+    OCIO::Array::Values & values = lut->getArray().getValues();
+    for (size_t idx = 0; idx < values.size(); idx += 3)
+    {
+        const float r = values[idx + 0];
+        const float g = values[idx + 1];
+        const float b = values[idx + 2];
+
+        values[idx + 0] = 0.9f * r * r + 0.1f * g;
+        values[idx + 1] = 0.8f * g + 0.2f * b * r;
+        values[idx + 2] = 0.7f * std::sqrt(b) + 0.3f * r;
+    }
+
+    return lut;
 }
+} // namespace
+
+OCIO_ADD_TEST(OpOptimizers, fuse_lut3d_stages)
+{
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.1, 0.9, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    const double offset4[4] = { 0.05, -0.02, 0.01, 0.0 };
+
+    for (auto interp : { OCIO::INTERP_TETRAHEDRAL, OCIO::INTERP_LINEAR })
+    {
+        OCIO::OpRcPtrVec originalOps;
+
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOffsetOp(originalOps, m44, offset4,
+                                                       OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0.05, 0.95, 0., 1.,
+                                                OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO::Lut3DOpDataRcPtr lut = CreateCrosstalkLut3D(interp);
+        OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(originalOps, lut, OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOffsetOp(originalOps, m44, offset4,
+                                                       OCIO::TRANSFORM_DIR_INVERSE));
+        OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0., 1., 0., 0.5,
+                                                OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_REQUIRE_EQUAL(originalOps.size(), 5);
+
+        OCIO::OpRcPtrVec optimizedOps;
+        Clone(optimizedOps, originalOps);
+
+        // The optimization is disabled.
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::BIT_DEPTH_F32,
+                                                DefaultBut(OCIO::OPTIMIZATION_FUSE_LUT3D_STAGES)));
+        OCIO_CHECK_EQUAL(optimizedOps.size(), 5);
+
+        Clone(optimizedOps, originalOps);
+
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_DEFAULT));
+        OCIO_REQUIRE_EQUAL(optimizedOps.size(), 1);
+        OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<Lut3DOp>");
+
+        OCIO::ConstOpRcPtr o0 = optimizedOps[0];
+        OCIO_CHECK_ASSERT(OCIO::HasFusedLut3DOps(o0));
+        OCIO_CHECK_ASSERT(o0->hasChannelCrosstalk());
+        OCIO_CHECK_ASSERT(!o0->isIdentity());
+
+        // Fused ops are not optimized again.
+        OCIO::OpRcPtrVec clonedOps;
+        Clone(clonedOps, optimizedOps);
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(clonedOps,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_DEFAULT));
+        OCIO_REQUIRE_EQUAL(clonedOps.size(), 1);
+
+        CompareRender(originalOps, optimizedOps, __LINE__, 1e-6f);
+        CompareRender(originalOps, clonedOps, __LINE__, 1e-6f);
+
+        // The fused ops are kept when converting back to transforms.
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        OCIO_CHECK_NO_THROW(OCIO::CreateLut3DTransform(group, o0));
+        OCIO_REQUIRE_EQUAL(group->getNumTransforms(), 5);
+        OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::MatrixTransform>(group->getTransform(0)));
+        OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::RangeTransform>(group->getTransform(1)));
+        OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::Lut3DTransform>(group->getTransform(2)));
+        OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::MatrixTransform>(group->getTransform(3)));
+        OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::RangeTransform>(group->getTransform(4)));
+    }
 
+    // A matrix modifying alpha and a range not ending the stage can not be fused.
+    {
+        const double alpha44[16] = { 1.0, 0.0, 0.0, 0.0,
+                                     0.0, 1.0, 0.0, 0.0,
+                                     0.0, 0.0, 1.0, 0.0,
+                                     0.0, 0.0, 0.5, 0.5 };
+
+        OCIO::OpRcPtrVec originalOps;
+
+        OCIO_CHECK_NO_THROW(OCIO::CreateRangeOp(originalOps, 0.05, 0.95, 0., 1.,
+                                                OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO::Lut3DOpDataRcPtr lut = CreateCrosstalkLut3D(OCIO::INTERP_TETRAHEDRAL);
+        OCIO_CHECK_NO_THROW(OCIO::CreateLut3DOp(originalOps, lut, OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(originalOps, alpha44,
+                                                 OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_REQUIRE_EQUAL(originalOps.size(), 4);
+
+        OCIO::OpRcPtrVec optimizedOps;
+        Clone(optimizedOps, originalOps);
+
+        OCIO_CHECK_NO_THROW(OCIO::OptimizeOpVec(optimizedOps,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::BIT_DEPTH_F32,
+                                                OCIO::OPTIMIZATION_DEFAULT));
+        OCIO_REQUIRE_EQUAL(optimizedOps.size(), 3);
+        OCIO_CHECK_EQUAL(optimizedOps[0]->getInfo(), "<RangeOp>");
+        OCIO_CHECK_EQUAL(optimizedOps[1]->getInfo(), "<Lut3DOp>");
+        OCIO_CHECK_EQUAL(optimizedOps[2]->getInfo(), "<MatrixOffsetOp>");
+
+        CompareRender(originalOps, optimizedOps, __LINE__, 1e-6f);
+    }
+}
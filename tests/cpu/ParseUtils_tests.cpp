@@ -330,6 +330,107 @@ OCIO_ADD_TEST(ParseUtils, string_to_float)
     OCIO_CHECK_EQUAL(fval, 1.0f);
 }
 
+OCIO_ADD_TEST(ParseUtils, parse_number)
+{
+    const std::string str("  -1.25e-3 12 .5x 3.");
+    const char * last = str.c_str() + str.size();
+
+    float fval = 0.0f;
+    const char * next = OCIO::ParseNumber(str.c_str(), last, fval);
+    OCIO_REQUIRE_ASSERT(next);
+    OCIO_CHECK_EQUAL(fval, -1.25e-3f);
+    OCIO_CHECK_EQUAL(*next, ' ');
+
+    int ival = 0;
+    next = OCIO::ParseNumber(next, last, ival);
+    OCIO_REQUIRE_ASSERT(next);
+    OCIO_CHECK_EQUAL(ival, 12);
+
+    next = OCIO::ParseNumber(next, last, fval);
+    OCIO_REQUIRE_ASSERT(next);
+    OCIO_CHECK_EQUAL(fval, 0.5f);
+    OCIO_CHECK_EQUAL(*next, 'x');
+
+    OCIO_CHECK_ASSERT(!OCIO::ParseNumber(next, last, fval));
+
+    next = OCIO::ParseNumber(next + 1, last, fval);
+    OCIO_REQUIRE_ASSERT(next);
+    OCIO_CHECK_EQUAL(fval, 3.0f);
+    OCIO_CHECK_ASSERT(next == last);
+
+    // Invalid or out of range numbers.
+    for (const std::string val : { "", " ", "-", ".", "e5", "nan", "1e40", "-1e40" })
+    {
+        OCIO_CHECK_ASSERT(!OCIO::ParseNumber(val.c_str(), val.c_str() + val.size(), fval));
+    }
+    for (const std::string val : { "", "+", "1.5e10", "2147483648", "-2147483649" })
+    {
+        // Note that "1.5e10" is parsed as 1.
+        const char * end = OCIO::ParseNumber(val.c_str(), val.c_str() + val.size(), ival);
+        OCIO_CHECK_ASSERT(!end || (ival == 1 && *end == '.'));
+    }
+
+    std::string val("-2147483648");
+    OCIO_CHECK_ASSERT(OCIO::ParseNumber(val.c_str(), val.c_str() + val.size(), ival));
+    OCIO_CHECK_EQUAL(ival, std::numeric_limits<int>::min());
+
+    // The results are identical to the standard library ones, including the numbers with
+    // too many digits or large exponents.
+    std::vector<std::string> values{ "0.1", "-0", "1e-45", "3.4028234e38", "123456789012345678901",
+                                     "0.30000000000000004441", "1.0000000000000000000000000001",
+                                     "6.103515625e-05", "65504", "1e-30", "7.038531e-26",
+                                     // The double values are exactly halfway between two floats.
+                                     "0.0078589734621346", "0.0079333302564919",
+                                     "0.0080076870508492", "0.00830232584849" };
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::ostringstream oss;
+        oss.precision(9);
+        oss << std::pow(1.37f, float(i % 200 - 100)) * float(i % 7 - 3);
+        values.push_back(oss.str());
+    }
+
+    for (const auto & value : values)
+    {
+        std::istringstream iss(value);
+        float ref = 0.0f;
+        iss >> ref;
+
+        OCIO_CHECK_ASSERT(OCIO::ParseNumber(value.c_str(), value.c_str() + value.size(), fval));
+        OCIO_CHECK_EQUAL(fval, ref);
+        OCIO_CHECK_EQUAL(std::signbit(fval), std::signbit(ref));
+
+        double dval = 0.0;
+        OCIO_CHECK_ASSERT(OCIO::ParseNumber(value.c_str(), value.c_str() + value.size(), dval));
+        OCIO_CHECK_EQUAL(dval, strtod(value.c_str(), nullptr));
+    }
+}
+
+OCIO_ADD_TEST(ParseUtils, parse_numbers)
+{
+    float fvals[3] = { 0.0f, 0.0f, 0.0f };
+
+    std::string line(" 0.5\t-1  2e1 \r");
+    OCIO_CHECK_EQUAL(OCIO::ParseNumbers(line.c_str(), line.c_str() + line.size(), fvals, 3), 3);
+    OCIO_CHECK_EQUAL(fvals[0], 0.5f);
+    OCIO_CHECK_EQUAL(fvals[1], -1.0f);
+    OCIO_CHECK_EQUAL(fvals[2], 20.0f);
+
+    // Not only numbers or too many numbers.
+    for (const std::string str : { "", "  ", "0.5 1 x", "0.5 1x 2", "# 1 2 3", "1 2 3 4" })
+    {
+        OCIO_CHECK_EQUAL(OCIO::ParseNumbers(str.c_str(), str.c_str() + str.size(), fvals, 3), 0);
+    }
+
+    int ivals[4] = { 0, 0, 0, 0 };
+    line = "1 2 3 4";
+    OCIO_CHECK_EQUAL(OCIO::ParseNumbers(line.c_str(), line.c_str() + line.size(), ivals, 4), 4);
+    OCIO_CHECK_EQUAL(ivals[3], 4);
+
+    line = "1 2 3.5";
+    OCIO_CHECK_EQUAL(OCIO::ParseNumbers(line.c_str(), line.c_str() + line.size(), ivals, 4), 0);
+}
+
 OCIO_ADD_TEST(ParseUtils, float_double)
 {
     std::string resStr;
@@ -474,3 +575,171 @@ OCIO_ADD_TEST(ParseUtils, intersect_string_vecs_case_ignore)
     OCIO_CHECK_EQUAL("test", resInter[3]);
 }
 
+
+OCIO_ADD_TEST(ParseUtils, parse_number_lines)
+{
+    {
+        const std::string text("0 0.5 1\n\n# comment\n  2 3e-1 -4  \r\n5 6 7");
+        std::vector<float> values;
+        OCIO_CHECK_ASSERT(OCIO::ParseNumberLines(text.c_str(), text.c_str() + text.size(),
+                                                 3, true, values));
+        const std::vector<float> expected{ 0.f, 0.5f, 1.f, 2.f, 0.3f, -4.f, 5.f, 6.f, 7.f };
+        OCIO_CHECK_ASSERT(values == expected);
+
+        values.clear();
+        OCIO_CHECK_ASSERT(!OCIO::ParseNumberLines(text.c_str(), text.c_str() + text.size(),
+                                                  3, false, values));
+    }
+
+    const auto parse = [](const std::string & text)
+    {
+        std::vector<float> values;
+        return OCIO::ParseNumberLines(text.c_str(), text.c_str() + text.size(), 3, true, values);
+    };
+
+    OCIO_CHECK_ASSERT(parse(""));
+    OCIO_CHECK_ASSERT(!parse("0 1 2\n3 4\n"));
+    OCIO_CHECK_ASSERT(!parse("0 1 2\n3 4 5 6\n"));
+    OCIO_CHECK_ASSERT(!parse("0 1 2\n3 4 a\n"));
+    OCIO_CHECK_ASSERT(!parse("0 1 2\nLUT_3D_SIZE 2\n"));
+
+    // A text large enough to be split in several parts.
+    {
+        std::ostringstream oss;
+        for (int idx = 0; idx < 100000; ++idx)
+        {
+            oss << idx << " " << idx + 0.5f << " " << -idx << "\n";
+            if (idx % 1000 == 0)
+            {
+                oss << "# comment\n\n";
+            }
+        }
+        const std::string text = oss.str();
+        OCIO_REQUIRE_ASSERT(text.size() > 1024 * 1024);
+
+        std::vector<float> values{ -1.f };
+        OCIO_CHECK_ASSERT(OCIO::ParseNumberLines(text.c_str(), text.c_str() + text.size(),
+                                                 3, true, values));
+        OCIO_REQUIRE_EQUAL(values.size(), 1 + 3 * 100000);
+        OCIO_CHECK_EQUAL(values[0], -1.f);
+        for (int idx = 0; idx < 100000; ++idx)
+        {
+            OCIO_CHECK_EQUAL(values[1 + 3 * idx],     float(idx));
+            OCIO_CHECK_EQUAL(values[1 + 3 * idx + 1], idx + 0.5f);
+            OCIO_CHECK_EQUAL(values[1 + 3 * idx + 2], float(-idx));
+        }
+
+        // A malformed line in the middle of the text.
+        const std::string badText = text + "0 0\n" + text;
+        values.clear();
+        OCIO_CHECK_ASSERT(!OCIO::ParseNumberLines(badText.c_str(),
+                                                  badText.c_str() + badText.size(),
+                                                  3, true, values));
+    }
+}
+
+OCIO_ADD_TEST(ParseUtils, read_remaining_text)
+{
+    std::istringstream istream("first line\nsecond line\nthird line");
+
+    std::string line;
+    std::getline(istream, line);
+    OCIO_CHECK_EQUAL(line, "first line");
+
+    OCIO_CHECK_EQUAL(OCIO::ReadRemainingText(istream), "second line\nthird line");
+    OCIO_CHECK_EQUAL(OCIO::ReadRemainingText(istream), "");
+}
+
+OCIO_ADD_TEST(ParseUtils, number_formatter)
+{
+    std::vector<double> values{ 0.0, -0.0, 1.0, 0.5, -0.25, 1e-4, 9.99999999e-5, 1e8, 99999999.5,
+                                9.9999999, 123456789012345678.0, 1e-300, 4.9e-324, 1e300,
+                                65504.0, 0.1, 1.0 / 3.0, -2.0 / 3.0, -1e-9, 1e22, 1e23,
+                                std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::quiet_NaN() };
+    for (int i = 0; i < 2000; ++i)
+    {
+        values.push_back(std::pow(1.37, double(i % 200 - 100)) * double(i % 7 - 3));
+        values.push_back(double(float(i) / 1999.0f));
+    }
+
+    // The output is identical to the stream one, for the notations and the precisions used
+    // by the file formats.
+    for (const bool fixed : { false, true })
+    {
+        for (const int precision : { 0, 5, 6, 8, 15, 17 })
+        {
+            std::ostringstream oss;
+            oss.precision(precision);
+            if (fixed)
+            {
+                oss.setf(std::ios::fixed, std::ios::floatfield);
+            }
+
+            const OCIO::NumberFormatter formatter(oss);
+            for (const double value : values)
+            {
+                for (const unsigned width : { 0u, 11u })
+                {
+                    oss.str("");
+                    oss.width(width);
+                    oss << value;
+
+                    std::string str("x");
+                    formatter.append(str, value, width);
+                    OCIO_CHECK_EQUAL(str, "x" + oss.str());
+                }
+            }
+        }
+    }
+
+    // Other stream settings are also honored.
+    std::ostringstream oss;
+    oss.setf(std::ios::scientific, std::ios::floatfield);
+    oss.setf(std::ios::showpos);
+
+    std::string str;
+    OCIO::NumberFormatter(oss).append(str, 0.5);
+    OCIO_CHECK_EQUAL(str, "+5.000000e-01");
+}
+
+OCIO_ADD_TEST(ParseUtils, write_number_lines)
+{
+    const float values[]{ 0.0f, 0.5f, 1.0f, -0.125f, 2.0f, 1e-7f };
+
+    std::ostringstream oss;
+    oss.setf(std::ios::fixed, std::ios::floatfield);
+    oss.precision(6);
+
+    OCIO::WriteNumberLines(oss, values, 2, 3, "\t");
+    OCIO_CHECK_EQUAL(oss.str(), "\t0.000000 0.500000 1.000000\n\t-0.125000 2.000000 0.000000\n");
+}
+
+OCIO_ADD_TEST(ParseUtils, base64)
+{
+    OCIO_CHECK_EQUAL(OCIO::EncodeBase64("", 0), "");
+    OCIO_CHECK_EQUAL(OCIO::EncodeBase64("f", 1), "Zg==");
+    OCIO_CHECK_EQUAL(OCIO::EncodeBase64("fo", 2), "Zm8=");
+    OCIO_CHECK_EQUAL(OCIO::EncodeBase64("foobar", 6), "Zm9vYmFy");
+
+    const char data[] = { 0, -1, 127, -128, 10 };
+    const std::string encoded = OCIO::EncodeBase64(data, sizeof(data));
+
+    std::string decoded;
+    OCIO_CHECK_ASSERT(OCIO::DecodeBase64(encoded.c_str(), encoded.c_str() + encoded.size(),
+                                         decoded));
+    OCIO_CHECK_ASSERT(decoded == std::string(data, sizeof(data)));
+
+    // White spaces (e.g. line breaks) are ignored.
+    const std::string lines = " Zm9v\n  YmE=\n";
+    OCIO_CHECK_ASSERT(OCIO::DecodeBase64(lines.c_str(), lines.c_str() + lines.size(), decoded));
+    OCIO_CHECK_EQUAL(decoded, "fooba");
+
+    const std::string invalid = "Zm9v*mFy";
+    OCIO_CHECK_ASSERT(!OCIO::DecodeBase64(invalid.c_str(), invalid.c_str() + invalid.size(),
+                                          decoded));
+
+    const std::string truncated = "Zm9vYmF";
+    OCIO_CHECK_ASSERT(!OCIO::DecodeBase64(truncated.c_str(), truncated.c_str() + truncated.size(),
+                                          decoded));
+}
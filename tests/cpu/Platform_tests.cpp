@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include "Platform.cpp"
 
 #include "UnitTest.h"
@@ -128,3 +133,81 @@ OCIO_ADD_TEST(Platform, create_temp_filename)
     OCIO_CHECK_ASSERT(f1!=f2);
 }
 
+
+OCIO_ADD_TEST(Platform, cpu_info)
+{
+    const OCIO::Platform::CPUInfo & info = OCIO::Platform::GetCPUInfo();
+
+    // The detection is only done once.
+    OCIO_CHECK_EQUAL(&info, &OCIO::Platform::GetCPUInfo());
+
+    // All the extensions rely on the AVX register states.
+    if (!info.hasAVX)
+    {
+        OCIO_CHECK_ASSERT(!info.hasAVX2);
+        OCIO_CHECK_ASSERT(!info.hasF16C);
+        OCIO_CHECK_ASSERT(!info.hasFMA);
+    }
+
+#ifndef USE_SSE
+    OCIO_CHECK_ASSERT(!info.hasAVX);
+#endif
+}
+
+OCIO_ADD_TEST(Platform, parallel_for)
+{
+    // The nested loops share the thread budget.
+    std::vector<std::vector<int>> values(8, std::vector<int>(100, 0));
+    OCIO::Platform::ParallelFor(values.size(), [&](size_t idx)
+    {
+        OCIO::Platform::ParallelFor(values[idx].size(), [&](size_t idx2)
+        {
+            values[idx][idx2] = int(idx * 100 + idx2);
+        });
+    });
+
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        for (size_t idx2 = 0; idx2 < values[idx].size(); ++idx2)
+        {
+            OCIO_CHECK_EQUAL(values[idx][idx2], int(idx * 100 + idx2));
+        }
+    }
+
+    // All the tasks are run even when one of them throws.
+    std::vector<int> done(10, 0);
+    OCIO_CHECK_THROW_WHAT(OCIO::Platform::ParallelFor(done.size(), [&](size_t idx)
+    {
+        done[idx] = 1;
+        if (idx == 3)
+        {
+            throw OCIO::Exception("Task failed.");
+        }
+    }), OCIO::Exception, "Task failed.");
+    OCIO_CHECK_EQUAL(std::count(done.begin(), done.end(), 1), 10);
+
+    OCIO_CHECK_NO_THROW(OCIO::Platform::ParallelFor(0, [](size_t) {}));
+
+    // The number of threads is limited by maxThreads.
+    for (unsigned maxThreads = 1; maxThreads <= 3; ++maxThreads)
+    {
+        std::mutex mutex;
+        std::set<std::thread::id> threadIds;
+        std::vector<int> tasks(64, 0);
+        OCIO::Platform::ParallelFor(tasks.size(), [&](size_t idx)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            tasks[idx] = 1;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            threadIds.insert(std::this_thread::get_id());
+        }, maxThreads);
+
+        OCIO_CHECK_EQUAL(std::count(tasks.begin(), tasks.end(), 1), 64);
+        OCIO_CHECK_ASSERT(threadIds.size() <= maxThreads);
+        if (maxThreads == 1)
+        {
+            OCIO_CHECK_ASSERT(threadIds.count(std::this_thread::get_id()) == 1);
+        }
+    }
+}
@@ -3,11 +3,14 @@
 
 #ifdef USE_SSE
 
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "MathUtils.h"
+#include "Platform.h"
 #include "SSE.h"
 #include "UnitTest.h"
 
@@ -672,4 +675,234 @@ OCIO_ADD_TEST(SSE, scalar_sin_cos_test)
     }
 }
 
+namespace
+{
+
+// The accurate tier is faithfully rounded i.e. within 1 ulp of the exact result computed
+// in double precision.
+void CheckAccurate(const std::string & operation, const double expected, const float * sseResult)
+{
+    const float expectedFloat = (float)expected;
+    OCIO_CHECK_ASSERT_MESSAGE(AreAllClose(sseResult, expectedFloat, 1),
+                              GetErrorMessage(operation, expectedFloat, sseResult));
+}
+
+} // anon.
+
+OCIO_ADD_TEST(SSE, sse2_log2_accurate_test)
+{
+    float sseResult[4];
+
+    // Sweep the whole range of the normalized floats.
+    for (float x = 1e-37f; x < 1e38f; x *= 1.0137f)
+    {
+        _mm_storeu_ps(sseResult, OCIO::sseLog2Accurate(_mm_set1_ps(x)));
+        CheckAccurate(GetOperation("log2", x), std::log2((double)x), sseResult);
+    }
+
+    // The values around one.
+    for (float x = 0.9f; x < 1.1f; x += 0.00123f)
+    {
+        _mm_storeu_ps(sseResult, OCIO::sseLog2Accurate(_mm_set1_ps(x)));
+        CheckAccurate(GetOperation("log2", x), std::log2((double)x), sseResult);
+    }
+
+    _mm_storeu_ps(sseResult, OCIO::sseLog2Accurate(_mm_setr_ps(1.0f, 2.0f, 0.5f, 1024.0f)));
+    OCIO_CHECK_EQUAL(sseResult[0],  0.0f);
+    OCIO_CHECK_EQUAL(sseResult[1],  1.0f);
+    OCIO_CHECK_EQUAL(sseResult[2], -1.0f);
+    OCIO_CHECK_EQUAL(sseResult[3], 10.0f);
+
+    const float posinf = std::numeric_limits<float>::infinity();
+    const float qnan   = std::numeric_limits<float>::quiet_NaN();
+
+    _mm_storeu_ps(sseResult, OCIO::sseLog2Accurate(_mm_setr_ps(0.0f, posinf, -1.0f, qnan)));
+    OCIO_CHECK_EQUAL(sseResult[0], -posinf);
+    OCIO_CHECK_EQUAL(sseResult[1], posinf);
+    OCIO_CHECK_ASSERT(OCIO::IsNan(sseResult[2]));
+    OCIO_CHECK_ASSERT(OCIO::IsNan(sseResult[3]));
+}
+
+OCIO_ADD_TEST(SSE, sse2_exp2_accurate_test)
+{
+    float sseResult[4];
+
+    for (float x = -125.0f; x < 127.0f; x += 0.0173f)
+    {
+        _mm_storeu_ps(sseResult, OCIO::sseExp2Accurate(_mm_set1_ps(x)));
+        CheckAccurate(GetOperation("exp2", x), std::exp2((double)x), sseResult);
+    }
+
+    _mm_storeu_ps(sseResult, OCIO::sseExp2Accurate(_mm_setr_ps(0.0f, 1.0f, -1.0f, 10.0f)));
+    OCIO_CHECK_EQUAL(sseResult[0],    1.0f);
+    OCIO_CHECK_EQUAL(sseResult[1],    2.0f);
+    OCIO_CHECK_EQUAL(sseResult[2],    0.5f);
+    OCIO_CHECK_EQUAL(sseResult[3], 1024.0f);
+
+    const float posinf = std::numeric_limits<float>::infinity();
+    const float qnan   = std::numeric_limits<float>::quiet_NaN();
+
+    _mm_storeu_ps(sseResult, OCIO::sseExp2Accurate(_mm_setr_ps(200.0f, posinf, -200.0f, qnan)));
+    OCIO_CHECK_EQUAL(sseResult[0], posinf);
+    OCIO_CHECK_EQUAL(sseResult[1], posinf);
+    OCIO_CHECK_EQUAL(sseResult[2], 0.0f);
+    OCIO_CHECK_ASSERT(OCIO::IsNan(sseResult[3]));
+}
+
+OCIO_ADD_TEST(SSE, sse2_power_accurate_test)
+{
+    const float exponents[] = {
+        -2.4f, -1.0f, -0.45f, -0.0189f, 0.0189f, 0.333333333f,
+        0.416667f, 0.45f, 1.0f, 1.1f, 2.2f, 2.4f, 10.0f
+    };
+
+    float sseResult[4];
+
+    for (const float exponent : exponents)
+    {
+        for (float base = 1e-6f; base < 1e3f; base *= 1.0213f)
+        {
+            const double expected = std::pow((double)base, (double)exponent);
+            if (expected < std::numeric_limits<float>::min()
+                || expected > std::numeric_limits<float>::max())
+            {
+                continue;
+            }
+
+            _mm_storeu_ps(sseResult, OCIO::ssePowerAccurate(_mm_set1_ps(base),
+                                                            _mm_set1_ps(exponent)));
+            CheckAccurate(GetOperation("power", base, exponent), expected, sseResult);
+
+            // The tier selection.
+            _mm_storeu_ps(sseResult, OCIO::ssePower(_mm_set1_ps(base),
+                                                    _mm_set1_ps(exponent), false));
+            CheckAccurate(GetOperation("power", base, exponent), expected, sseResult);
+        }
+    }
+
+    const float posinf = std::numeric_limits<float>::infinity();
+
+    // Bases smaller than or equal to zero give zero.
+    _mm_storeu_ps(sseResult, OCIO::ssePowerAccurate(_mm_setr_ps(0.0f, -0.0f, -1.0f, -2.0f),
+                                                    _mm_set1_ps(2.2f)));
+    OCIO_CHECK_ASSERT(AreAllZero(sseResult));
+
+    _mm_storeu_ps(sseResult, OCIO::ssePowerAccurate(_mm_set1_ps(posinf),
+                                                    _mm_setr_ps(2.2f, 0.0f, -2.2f, 1.0f)));
+    OCIO_CHECK_EQUAL(sseResult[0], posinf);
+    OCIO_CHECK_EQUAL(sseResult[1], 1.0f);
+    OCIO_CHECK_EQUAL(sseResult[2], 0.0f);
+    OCIO_CHECK_EQUAL(sseResult[3], posinf);
+
+    // The fast tier is the historical approximation.
+    float fastResult[4];
+    _mm_storeu_ps(sseResult, OCIO::ssePower(_mm_set1_ps(0.18f), _mm_set1_ps(2.2f), true));
+    _mm_storeu_ps(fastResult, OCIO::ssePower(_mm_set1_ps(0.18f), _mm_set1_ps(2.2f)));
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        OCIO_CHECK_EQUAL(sseResult[i], fastResult[i]);
+    }
+}
+
+OCIO_ADD_TEST(SSE, scalar_fast_tier_test)
+{
+    // The scalar version of the fast tier gives the results of the SSE version.
+
+    float sseResult[4];
+
+    for (float x = 1e-37f; x < 1e38f; x *= 1.0137f)
+    {
+        _mm_storeu_ps(sseResult, OCIO::sseLog2(_mm_set1_ps(x)));
+        OCIO_CHECK_EQUAL(OCIO::FastLog2(x), sseResult[0]);
+    }
+
+    for (float x = -130.0f; x < 130.0f; x += 0.0173f)
+    {
+        _mm_storeu_ps(sseResult, OCIO::sseExp2(_mm_set1_ps(x)));
+        OCIO_CHECK_EQUAL(OCIO::FastExp2(x), sseResult[0]);
+    }
+
+    const float exponents[] = { -2.4f, -0.45f, 0.0189f, 0.45f, 1.0f, 2.2f, 10.0f };
+    for (const float exponent : exponents)
+    {
+        // The negative bases, zero and the positive bases.
+        for (float base = -1.0f; base < 1e3f;
+             base = (base < 0.001f) ? base + 0.0625f : base * 1.0213f)
+        {
+            _mm_storeu_ps(sseResult, OCIO::ssePower(_mm_set1_ps(base), _mm_set1_ps(exponent)));
+            OCIO_CHECK_EQUAL(OCIO::FastPower(base, exponent), sseResult[0]);
+            OCIO_CHECK_EQUAL(OCIO::Power(base, exponent, true), sseResult[0]);
+        }
+    }
+
+    OCIO_CHECK_EQUAL(OCIO::Power(0.18f, 2.2f, false), powf(0.18f, 2.2f));
+    OCIO_CHECK_EQUAL(OCIO::Log2(0.18f, false), std::log2(0.18f));
+    OCIO_CHECK_EQUAL(OCIO::Exp2(-2.2f, false), std::exp2(-2.2f));
+}
+
+namespace
+{
+
+// Compare both tiers of the AVX2 log2, exp2 and power functions to the SSE ones.
+OCIO_TARGET_AVX2 unsigned CountAVX2Mismatches(const float * base, const float * exponent,
+                                              bool fast)
+{
+    float avx2Log[8], avx2Exp[8], avx2Pow[8];
+    const __m256 b = _mm256_loadu_ps(base);
+    const __m256 e = _mm256_loadu_ps(exponent);
+    _mm256_storeu_ps(avx2Log, OCIO::avx2Log2(b, fast));
+    _mm256_storeu_ps(avx2Exp, OCIO::avx2Exp2(e, fast));
+    _mm256_storeu_ps(avx2Pow, OCIO::avx2Power(b, e, fast));
+
+    float sseLog[8], sseExp[8], ssePow[8];
+    for (unsigned i = 0; i < 8; i += 4)
+    {
+        const __m128 sb = _mm_loadu_ps(base + i);
+        const __m128 se = _mm_loadu_ps(exponent + i);
+        _mm_storeu_ps(sseLog + i, OCIO::sseLog2(sb, fast));
+        _mm_storeu_ps(sseExp + i, OCIO::sseExp2(se, fast));
+        _mm_storeu_ps(ssePow + i, OCIO::ssePower(sb, se, fast));
+    }
+
+    unsigned mismatches = 0;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        // Note that the NaN values are never equal.
+        mismatches += (avx2Log[i] != sseLog[i]) && !OCIO::IsNan(sseLog[i]) ? 1 : 0;
+        mismatches += (avx2Exp[i] != sseExp[i]) ? 1 : 0;
+        mismatches += (avx2Pow[i] != ssePow[i]) ? 1 : 0;
+    }
+    return mismatches;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(SSE, avx2_tiers_test)
+{
+    if (!OCIO::Platform::GetCPUInfo().hasAVX2)
+    {
+        return;
+    }
+
+    float base[8], exponent[8];
+    for (unsigned pass = 0; pass < 2; ++pass)
+    {
+        const bool fast = (pass == 0);
+
+        unsigned idx = 0;
+        unsigned mismatches = 0;
+        for (float x = 1e-30f; x < 1e30f; x *= 1.0213f)
+        {
+            base[idx] = (idx == 3) ? -x : x;
+            exponent[idx] = std::log2(x) * 0.9f;
+            if (++idx == 8)
+            {
+                mismatches += CountAVX2Mismatches(base, exponent, fast);
+                idx = 0;
+            }
+        }
+        OCIO_CHECK_EQUAL(mismatches, 0u);
+    }
+}
+
 #endif
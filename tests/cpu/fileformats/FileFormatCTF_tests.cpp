@@ -823,6 +823,69 @@ OCIO_ADD_TEST(FileFormatCTF, lut3d_inv)
     OCIO_CHECK_EQUAL(array.getValues()[32], 1350.0f / 4095.0f);
 }
 
+OCIO_ADD_TEST(FileFormatCTF, lut3d_large)
+{
+    // The file is larger than the blocks fed to the XML parser.
+    static constexpr unsigned LUT_SIZE = 49;
+    static constexpr unsigned NUM_ENTRIES = LUT_SIZE * LUT_SIZE * LUT_SIZE;
+
+    std::ostringstream oss;
+    oss.precision(9);
+    oss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<ProcessList id=\"none\" compCLFversion=\"2.0\">\n"
+        << "    <LUT3D inBitDepth=\"32f\" outBitDepth=\"32f\">\n"
+        << "        <Array dim=\"" << LUT_SIZE << " " << LUT_SIZE << " " << LUT_SIZE << " 3\">\n";
+    for (unsigned i = 0; i < NUM_ENTRIES; ++i)
+    {
+        oss << float(i) / NUM_ENTRIES << " " << -1.0f / float(i + 1) << " " << i << "\n";
+    }
+    oss << "        </Array>\n"
+        << "    </LUT3D>\n"
+        << "</ProcessList>\n";
+
+    const std::string ctf = oss.str();
+    OCIO_REQUIRE_ASSERT(ctf.size() > 2 * 1024 * 1024);
+
+    std::istringstream ctfStream(ctf);
+
+    std::string emptyString;
+    OCIO::LocalFileFormat tester;
+    OCIO::CachedFileRcPtr file;
+    OCIO_CHECK_NO_THROW(file = tester.read(ctfStream, emptyString));
+    OCIO::LocalCachedFileRcPtr cachedFile = OCIO_DYNAMIC_POINTER_CAST<OCIO::LocalCachedFile>(file);
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    const OCIO::ConstOpDataVec & opList = cachedFile->m_transform->getOps();
+    OCIO_REQUIRE_EQUAL(opList.size(), 1);
+
+    auto pLut = std::dynamic_pointer_cast<const OCIO::Lut3DOpData>(opList[0]);
+    OCIO_REQUIRE_ASSERT(pLut);
+
+    const OCIO::Array::Values & values = pLut->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), NUM_ENTRIES * 3);
+
+    // The LUT entries are stored with the blue index changing fastest, like in the file.
+    for (unsigned i = 0; i < NUM_ENTRIES; i += 997)
+    {
+        OCIO_CHECK_EQUAL(values[3 * i + 0], float(i) / NUM_ENTRIES);
+        OCIO_CHECK_EQUAL(values[3 * i + 1], -1.0f / float(i + 1));
+        OCIO_CHECK_EQUAL(values[3 * i + 2], float(i));
+    }
+
+    // The errors report the line where they occur.
+    std::string badCtf(ctf);
+    const size_t pos = badCtf.find(" 50000\n");
+    OCIO_REQUIRE_ASSERT(pos != std::string::npos);
+    badCtf.insert(pos + 1, "<");
+
+    const size_t line = std::count(badCtf.begin(), badCtf.begin() + pos, '\n') + 1;
+
+    ctfStream.clear();
+    ctfStream.str(badCtf);
+    OCIO_CHECK_THROW_WHAT(tester.read(ctfStream, emptyString), OCIO::Exception,
+                          "At line (" + std::to_string(line) + ")");
+}
+
 OCIO_ADD_TEST(FileFormatCTF, check_utf8)
 {
     OCIO::LocalCachedFileRcPtr cachedFile;
@@ -5364,6 +5427,111 @@ OCIO_ADD_TEST(CTFTransform, lut3d_array_ctf)
     OCIO_CHECK_EQUAL(expected, outputTransform.str());
 }
 
+OCIO_ADD_TEST(CTFTransform, lut_base64_ctf)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setMajorVersion(2);
+
+    OCIO::Lut1DTransformRcPtr lut1d = OCIO::Lut1DTransform::Create();
+    lut1d->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    lut1d->setLength(16);
+    for (unsigned long i = 0; i < 16; ++i)
+    {
+        const float val = float(i * 3) / 1023.0f;
+        lut1d->setValue(i, val, val, val);
+    }
+
+    OCIO::Lut3DTransformRcPtr lut3d = OCIO::Lut3DTransform::Create();
+    lut3d->setGridSize(3);
+    for (unsigned long r = 0; r < 3; ++r)
+    {
+        for (unsigned long g = 0; g < 3; ++g)
+        {
+            for (unsigned long b = 0; b < 3; ++b)
+            {
+                lut3d->setValue(r, g, b, r / 7.0f, g / 11.0f, -b / 13.0f);
+            }
+        }
+    }
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->getFormatMetadata().addAttribute(OCIO::METADATA_ID, "UIDLUT42");
+    group->appendTransform(lut1d);
+    group->appendTransform(lut3d);
+
+    OCIO::ConstProcessorRcPtr processorGroup = config->getProcessor(group);
+    std::ostringstream outputTransform;
+    OCIO_CHECK_NO_THROW(processorGroup->write(OCIO::FILEFORMAT_CTF_BASE64, outputTransform));
+
+    const std::string encoded = outputTransform.str();
+    OCIO_CHECK_NE(encoded.find(R"(<ProcessList version="2.1" id="UIDLUT42">)"),
+                  std::string::npos);
+    OCIO_CHECK_NE(encoded.find(R"(<Array dim="16 1" encoding="base64" encodedBitDepth="32f")"),
+                  std::string::npos);
+    OCIO_CHECK_NE(encoded.find(R"(<Array dim="3 3 3 3" encoding="base64" encodedBitDepth="32f")"),
+                  std::string::npos);
+
+    // The values are read back without any loss.
+    std::istringstream ctfStream(encoded);
+
+    std::string emptyString;
+    OCIO::LocalFileFormat tester;
+    OCIO::CachedFileRcPtr file;
+    OCIO_CHECK_NO_THROW(file = tester.read(ctfStream, emptyString));
+    OCIO::LocalCachedFileRcPtr cachedFile = OCIO_DYNAMIC_POINTER_CAST<OCIO::LocalCachedFile>(file);
+    OCIO_REQUIRE_ASSERT(cachedFile);
+
+    const auto & fileOps = cachedFile->m_transform->getOps();
+    OCIO_REQUIRE_EQUAL(fileOps.size(), 2);
+
+    auto fileLut1d = std::dynamic_pointer_cast<const OCIO::Lut1DOpData>(fileOps[0]);
+    OCIO_REQUIRE_ASSERT(fileLut1d);
+    OCIO_CHECK_EQUAL(fileLut1d->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+    OCIO_REQUIRE_EQUAL(fileLut1d->getArray().getLength(), 16);
+    for (unsigned long i = 0; i < 16; ++i)
+    {
+        float r = 0.f, g = 0.f, b = 0.f;
+        lut1d->getValue(i, r, g, b);
+        OCIO_CHECK_CLOSE(fileLut1d->getArray().getValues()[3 * i], r, 1e-7f);
+    }
+
+    auto fileLut3d = std::dynamic_pointer_cast<const OCIO::Lut3DOpData>(fileOps[1]);
+    OCIO_REQUIRE_ASSERT(fileLut3d);
+    const auto & values = fileLut3d->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(values.size(), 81);
+    for (unsigned long r = 0; r < 3; ++r)
+    {
+        for (unsigned long g = 0; g < 3; ++g)
+        {
+            for (unsigned long b = 0; b < 3; ++b)
+            {
+                // The array is in blue fastest order.
+                const size_t idx = 3 * (b + 3 * (g + 3 * r));
+                OCIO_CHECK_EQUAL(values[idx + 0], r / 7.0f);
+                OCIO_CHECK_EQUAL(values[idx + 1], g / 11.0f);
+                OCIO_CHECK_EQUAL(values[idx + 2], -b / 13.0f);
+            }
+        }
+    }
+
+    // The encoded arrays require the version 2.1.
+    std::string badVersion(encoded);
+    badVersion.replace(badVersion.find(R"(version="2.1")"), 13, R"(version="2")");
+    ctfStream.clear();
+    ctfStream.str(badVersion);
+    OCIO_CHECK_THROW_WHAT(tester.read(ctfStream, emptyString), OCIO::Exception,
+                          "arrays require the transform file version 2.1 or higher");
+
+    // The values must match the checksum.
+    std::string badChecksum(encoded);
+    const size_t pos = badChecksum.find("checksum=\"") + 10;
+    badChecksum[pos] = badChecksum[pos] == '0' ? '1' : '0';
+    ctfStream.clear();
+    ctfStream.str(badChecksum);
+    OCIO_CHECK_THROW_WHAT(tester.read(ctfStream, emptyString), OCIO::Exception,
+                          "array values do not match the checksum");
+}
+
 OCIO_ADD_TEST(CTFTransform, lut3d_inverse_clf)
 {
     OCIO::ConfigRcPtr config = OCIO::Config::Create();
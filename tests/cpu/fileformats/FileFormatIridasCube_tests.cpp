@@ -360,3 +360,44 @@ OCIO_ADD_TEST(FileFormatIridasCube, load_3d_op)
     OCIO_CHECK_EQUAL(lutArray[23], 2.0f);
 }
 
+
+OCIO_ADD_TEST(FileFormatIridasCube, read_large_3d)
+{
+    // The color triples of a large 3D LUT are parsed at once.
+    constexpr int size = 65;
+
+    auto buildContent = [](const std::string & extraLine)
+    {
+        std::ostringstream oss;
+        oss << "LUT_3D_SIZE " << size << "\n";
+        for (int idx = 0; idx < size * size * size; ++idx)
+        {
+            oss << idx % size << " " << (idx / size) % size << " " << idx / (size * size) << "\n";
+            if (idx == 1000)
+            {
+                oss << "# comment\n\n" << extraLine;
+            }
+        }
+        return oss.str();
+    };
+
+    OCIO::LocalCachedFileRcPtr cachedFile;
+    OCIO_CHECK_NO_THROW(cachedFile = ReadIridasCube(buildContent("")));
+    OCIO_REQUIRE_ASSERT(cachedFile);
+    OCIO_REQUIRE_ASSERT(cachedFile->lut3D);
+
+    const auto & lutArray = cachedFile->lut3D->getArray();
+    OCIO_REQUIRE_EQUAL(lutArray.getLength(), size);
+
+    // The blue index changes the fastest in the LUT array.
+    const unsigned long idx = ((20 * size) + 30) * size + 40;
+    OCIO_CHECK_EQUAL(lutArray[3 * idx + 0], 20.0f);
+    OCIO_CHECK_EQUAL(lutArray[3 * idx + 1], 30.0f);
+    OCIO_CHECK_EQUAL(lutArray[3 * idx + 2], 40.0f);
+
+    // A malformed line makes the reader fall back to the line by line parsing, which reports
+    // the right line number.
+    OCIO_CHECK_THROW_WHAT(ReadIridasCube(buildContent("1.0 1.0\n")),
+                          OCIO::Exception,
+                          "At line (1004): '1.0 1.0'.  Malformed color triples specified.");
+}
@@ -277,11 +277,7 @@ OCIO_ADD_TEST(CDLOp, apply_clamp_fwd)
              CDL_DATA_1::slope, CDL_DATA_1::offset,
              CDL_DATA_1::power, CDL_DATA_1::saturation,
              OCIO::CDLOpData::CDL_V1_2_FWD,
-#ifdef USE_SSE
-             4e-6f);
-#else
              2e-6f);
-#endif
 }
 
 OCIO_ADD_TEST(CDLOp, apply_clamp_rev)
@@ -316,11 +312,7 @@ OCIO_ADD_TEST(CDLOp, apply_clamp_rev)
              CDL_DATA_1::slope, CDL_DATA_1::offset,
              CDL_DATA_1::power, CDL_DATA_1::saturation,
              OCIO::CDLOpData::CDL_V1_2_REV,
-#ifdef USE_SSE
-             9e-6f);
-#else
              1e-5f);
-#endif
 }
 
 OCIO_ADD_TEST(CDLOp, apply_noclamp_fwd)
@@ -355,11 +347,7 @@ OCIO_ADD_TEST(CDLOp, apply_noclamp_fwd)
              CDL_DATA_1::slope, CDL_DATA_1::offset,
              CDL_DATA_1::power, CDL_DATA_1::saturation,
              OCIO::CDLOpData::CDL_NO_CLAMP_FWD,
-#ifdef USE_SSE
-             2e-5f);
-#else
              2e-6f);
-#endif
 }
 
 OCIO_ADD_TEST(CDLOp, apply_noclamp_rev)
@@ -394,11 +382,7 @@ OCIO_ADD_TEST(CDLOp, apply_noclamp_rev)
              CDL_DATA_1::slope, CDL_DATA_1::offset,
              CDL_DATA_1::power, CDL_DATA_1::saturation,
              OCIO::CDLOpData::CDL_NO_CLAMP_REV,
-#ifdef USE_SSE
-             3e-5f);
-#else
              1e-6f);
-#endif
 }
 
 namespace CDL_DATA_2
@@ -435,11 +419,7 @@ OCIO_ADD_TEST(CDLOp, apply_clamp_fwd_2)
              CDL_DATA_2::slope, CDL_DATA_2::offset,
              CDL_DATA_2::power, CDL_DATA_2::saturation,
              OCIO::CDLOpData::CDL_V1_2_FWD,
-#ifdef USE_SSE
-             7e-6f);
-#else
              1e-6f);
-#endif
 }
 
 namespace CDL_DATA_3
@@ -510,11 +490,7 @@ OCIO_ADD_TEST(CDLOp, apply_clamp_fwd_3)
              CDL_DATA_3::slope, CDL_DATA_3::offset,
              CDL_DATA_3::power, CDL_DATA_3::saturation,
              OCIO::CDLOpData::CDL_V1_2_FWD,
-#ifdef USE_SSE
-             2e-5f);
-#else
              1e-6f);
-#endif
 }
 
 OCIO_ADD_TEST(CDLOp, apply_noclamp_fwd_3)
@@ -577,11 +553,7 @@ OCIO_ADD_TEST(CDLOp, apply_noclamp_fwd_3)
              CDL_DATA_3::slope, CDL_DATA_3::offset,
              CDL_DATA_3::power, CDL_DATA_3::saturation,
              OCIO::CDLOpData::CDL_NO_CLAMP_FWD,
-#ifdef USE_SSE
-             5e-6f);
-#else
              1e-6f);
-#endif
 }
 
 OCIO_ADD_TEST(CDLOp, create_transform)
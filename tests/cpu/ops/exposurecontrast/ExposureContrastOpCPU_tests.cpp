@@ -93,7 +93,7 @@ OCIO_ADD_TEST(ExposureContrastRenderer, video)
     ec->getGammaProperty()->makeDynamic();
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECVideoRenderer>(renderer));
     std::vector<float> rgba = rgbaImage;
 
@@ -166,7 +166,7 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log)
     ec->setPivot(0.18);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECLogarithmicRenderer>(renderer));
 
     std::vector<float> rgba = rgbaImage;
@@ -236,7 +236,7 @@ OCIO_ADD_TEST(ExposureContrastRenderer, linear)
     ec->getGammaProperty()->makeDynamic();
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
     OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<OCIO::ECLinearRenderer>(renderer));
 
     std::vector<float> rgba = rgbaImage;
@@ -304,13 +304,13 @@ void TestECInverse(OCIO::ExposureContrastOpData::Style style)
     ec->setPivot(0.18);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
 
     std::vector<float> rgba = rgbaImage;
     renderer->apply(rgba.data(), rgba.data(), 2);
 
     OCIO::ConstExposureContrastOpDataRcPtr const_eci = ec->inverse();
-    OCIO::OpCPURcPtr rendereri = OCIO::GetExposureContrastCPURenderer(const_eci);
+    OCIO::OpCPURcPtr rendereri = OCIO::GetExposureContrastCPURenderer(const_eci, true);
     rendereri->apply(rgba.data(), rgba.data(), 2);
 
     // As the ssePower is an approximation, strict equality is not possible.
@@ -352,7 +352,7 @@ void TestLogParamForStyle(OCIO::ExposureContrastOpData::Style style, bool hasEff
     // Reference.
     {
         OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
         renderer->apply(rgbaRef.data(), rgbaRef.data(), 3);
     }
 
@@ -362,7 +362,7 @@ void TestLogParamForStyle(OCIO::ExposureContrastOpData::Style style, bool hasEff
     std::vector<float> rgba = rgbaImage;
     {
         OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
-        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec);
+        OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
         renderer->apply(rgba.data(), rgba.data(), 3);
         for (int i = 0; i < 12; ++i)
         {
@@ -388,3 +388,41 @@ OCIO_ADD_TEST(ExposureContrastRenderer, log_params)
     TestLogParamForStyle(OCIO::ExposureContrastOpData::STYLE_LOGARITHMIC_REV, true);
 }
 
+
+OCIO_ADD_TEST(ExposureContrastRenderer, latched_params)
+{
+    const std::vector<float> rgbaImage { 0.1f, 0.5f, 1.f, 0.f };
+
+    OCIO::ExposureContrastOpDataRcPtr ec =
+        std::make_shared<OCIO::ExposureContrastOpData>(
+            OCIO::ExposureContrastOpData::STYLE_LINEAR);
+
+    ec->getExposureProperty()->makeDynamic();
+    ec->setExposure(1.0);
+
+    OCIO::ConstExposureContrastOpDataRcPtr const_ec = ec;
+    OCIO::OpCPURcPtr renderer = OCIO::GetExposureContrastCPURenderer(const_ec, true);
+
+    OCIO::DynamicPropertySnapshot snapshot;
+    snapshot.latch(*ec->getExposureProperty());
+
+    std::vector<float> rgba = rgbaImage;
+    renderer->apply(rgba.data(), rgba.data(), 1);
+    OCIO_CHECK_EQUAL(rgba[0], 0.2f);
+
+    // The derived values are computed again when the exposure changes.
+    ec->setExposure(2.0);
+
+    rgba = rgbaImage;
+    renderer->apply(rgba.data(), rgba.data(), 1);
+    OCIO_CHECK_EQUAL(rgba[0], 0.4f);
+
+    // The latched exposure is still used.
+    rgba = rgbaImage;
+    renderer->applyLatched(rgba.data(), rgba.data(), 1, snapshot);
+    OCIO_CHECK_EQUAL(rgba[0], 0.2f);
+
+    rgba = rgbaImage;
+    renderer->apply(rgba.data(), rgba.data(), 1);
+    OCIO_CHECK_EQUAL(rgba[0], 0.4f);
+}
@@ -415,3 +415,155 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, XYZ_TO_LUV)
     img = outputFrame;
     ApplyFixedFunction(&img[0], &inputFrame[0], 2, dataFInv, 1e-5f, __LINE__);
 }
+
+namespace
+{
+// Create pixels covering the interesting cases (i.e. greys, primaries, zeros, negative and
+// large values) followed by pseudo-random ones in [minValue, maxValue]. The number of pixels
+// is not a multiple of the SIMD widths so the remaining pixels are also processed.
+std::vector<float> CreateTestPixels(float minValue, float maxValue)
+{
+    std::vector<float> pixels {
+         0.00f,    0.00f,    0.00f,   1.0f,
+         0.18f,    0.18f,    0.18f,   0.5f,
+         1.00f,    0.00f,    0.00f,   1.0f,
+         0.00f,    1.00f,    0.00f,   1.0f,
+         0.00f,    0.00f,    1.00f,   1.0f,
+         0.90f,    0.05f,    0.22f,   0.5f,
+         0.97f,    0.097f,   0.0097f, 1.0f,
+         0.89f,    0.15f,    0.56f,   0.0f,
+        -1.00f,   -0.001f,   1.20f,   0.0f,
+         0.05f,    0.05f,    0.90f,   1.0f,
+        -0.50f,   -0.25f,   -0.75f,   1.0f,
+       100.00f,   10.00f,    1.00f,   1.0f,
+         1e-6f,    0.00f,    1e-5f,   1.0f,
+         0.50f,    0.50f,   -0.50f,   1.0f,
+    };
+
+    // A simple linear congruential generator so that the values are the same on all platforms.
+    unsigned seed = 12345u;
+    for (int idx = 0; idx < 1003 * 4; ++idx)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const float value = float(seed >> 8) / float(1 << 24);
+        pixels.push_back(minValue + value * (maxValue - minValue));
+    }
+
+    return pixels;
+}
+
+// Compare the vectorized implementations of the renderer (i.e. SSE and AVX2 when supported
+// by the CPU) with its scalar reference implementation.
+template<typename Renderer>
+void ValidateVectorized(const Renderer & renderer,
+                        OCIO::ConstFixedFunctionOpDataRcPtr & fnData,
+                        const std::vector<float> & input,
+                        float errorThreshold,
+                        int lineNo)
+{
+    const long numPixels = long(input.size() / 4);
+
+    std::vector<float> expected(input.size());
+    renderer.applyScalar(&input[0], &expected[0], numPixels);
+
+    std::vector<float> result(input.size());
+    OCIO_CHECK_NO_THROW_FROM(renderer.apply(&input[0], &result[0], numPixels), lineNo);
+
+    OCIO::ConstOpCPURcPtr op;
+    OCIO_CHECK_NO_THROW_FROM(op = OCIO::GetFixedFunctionCPURenderer(fnData), lineNo);
+    std::vector<float> result2(input.size());
+    OCIO_CHECK_NO_THROW_FROM(op->apply(&input[0], &result2[0], numPixels), lineNo);
+
+    for (size_t idx = 0; idx < input.size(); ++idx)
+    {
+        OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(result[idx], expected[idx],
+                                                           errorThreshold, 1.0f), lineNo);
+        OCIO_CHECK_ASSERT_FROM(OCIO::EqualWithSafeRelError(result2[idx], expected[idx],
+                                                           errorThreshold, 1.0f), lineNo);
+    }
+
+    // The result of a pixel must not depend on its position in the image i.e. the pixels
+    // left over by the vectorized loop go through the same computations.
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float pixel[4];
+        OCIO_CHECK_NO_THROW_FROM(op->apply(&input[idx * 4], pixel, 1), lineNo);
+        OCIO_CHECK_ASSERT_FROM(std::memcmp(pixel, &result2[idx * 4], sizeof(pixel)) == 0, lineNo);
+    }
+}
+
+template<typename Renderer, typename... Args>
+void ValidateVectorized(OCIO::FixedFunctionOpData::Style style,
+                        const std::vector<float> & input,
+                        float errorThreshold,
+                        int lineNo,
+                        Args... args)
+{
+    OCIO::ConstFixedFunctionOpDataRcPtr fnData
+        = std::make_shared<OCIO::FixedFunctionOpData>(style);
+    const Renderer renderer(fnData, args...);
+    ValidateVectorized(renderer, fnData, input, errorThreshold, lineNo);
+}
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, vectorized_aces)
+{
+    const std::vector<float> pixels = CreateTestPixels(-0.2f, 1.5f);
+
+    ValidateVectorized<OCIO::Renderer_ACES_RedMod03_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_RED_MOD_03_FWD, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_ACES_RedMod03_Inv>(
+        OCIO::FixedFunctionOpData::ACES_RED_MOD_03_INV, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_ACES_RedMod10_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_RED_MOD_10_FWD, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_ACES_RedMod10_Inv>(
+        OCIO::FixedFunctionOpData::ACES_RED_MOD_10_INV, pixels, 1e-6f, __LINE__);
+
+    ValidateVectorized<OCIO::Renderer_ACES_Glow03_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_GLOW_03_FWD, pixels, 1e-6f, __LINE__, 0.075f, 0.1f);
+    ValidateVectorized<OCIO::Renderer_ACES_Glow03_Inv>(
+        OCIO::FixedFunctionOpData::ACES_GLOW_03_INV, pixels, 1e-6f, __LINE__, 0.075f, 0.1f);
+    ValidateVectorized<OCIO::Renderer_ACES_Glow03_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_GLOW_10_FWD, pixels, 1e-6f, __LINE__, 0.05f, 0.08f);
+    ValidateVectorized<OCIO::Renderer_ACES_Glow03_Inv>(
+        OCIO::FixedFunctionOpData::ACES_GLOW_10_INV, pixels, 1e-6f, __LINE__, 0.05f, 0.08f);
+
+    ValidateVectorized<OCIO::Renderer_ACES_DarkToDim10_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD, pixels, 1e-6f, __LINE__, 0.9811f);
+    ValidateVectorized<OCIO::Renderer_ACES_DarkToDim10_Fwd>(
+        OCIO::FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV, pixels, 1e-6f, __LINE__, 1.0192640913260627f);
+}
+
+OCIO_ADD_TEST(FixedFunctionOpCPU, vectorized_others)
+{
+    const std::vector<float> pixels = CreateTestPixels(-0.5f, 2.0f);
+
+    {
+        OCIO::FixedFunctionOpData::Params params = { 0.78 };
+        OCIO::ConstFixedFunctionOpDataRcPtr fnData
+            = std::make_shared<OCIO::FixedFunctionOpData>(params,
+                                                          OCIO::FixedFunctionOpData::REC2100_SURROUND_FWD);
+        const OCIO::Renderer_REC2100_Surround renderer(fnData);
+        ValidateVectorized(renderer, fnData, pixels, 1e-6f, __LINE__);
+    }
+
+    ValidateVectorized<OCIO::Renderer_RGB_TO_HSV>(
+        OCIO::FixedFunctionOpData::RGB_TO_HSV, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_HSV_TO_RGB>(
+        OCIO::FixedFunctionOpData::HSV_TO_RGB, pixels, 1e-6f, __LINE__);
+
+    ValidateVectorized<OCIO::Renderer_XYZ_TO_xyY>(
+        OCIO::FixedFunctionOpData::XYZ_TO_xyY, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_xyY_TO_XYZ>(
+        OCIO::FixedFunctionOpData::xyY_TO_XYZ, pixels, 1e-6f, __LINE__);
+
+    ValidateVectorized<OCIO::Renderer_XYZ_TO_uvY>(
+        OCIO::FixedFunctionOpData::XYZ_TO_uvY, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_uvY_TO_XYZ>(
+        OCIO::FixedFunctionOpData::uvY_TO_XYZ, pixels, 1e-6f, __LINE__);
+
+    ValidateVectorized<OCIO::Renderer_XYZ_TO_LUV>(
+        OCIO::FixedFunctionOpData::XYZ_TO_LUV, pixels, 1e-6f, __LINE__);
+    ValidateVectorized<OCIO::Renderer_LUV_TO_XYZ>(
+        OCIO::FixedFunctionOpData::LUV_TO_XYZ, pixels, 1e-6f, __LINE__);
+}
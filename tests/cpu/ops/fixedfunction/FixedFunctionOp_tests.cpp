@@ -43,7 +43,7 @@ OCIO_ADD_TEST(FixedFunctionOp, glow03_cpu_engine)
     OCIO::FixedFunctionOp func(funcData);
     OCIO_CHECK_NO_THROW(func.finalize(OCIO::OPTIMIZATION_NONE));
 
-    OCIO::ConstOpCPURcPtr cpuOp = func.getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = func.getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_ACES_Glow03_Fwd"));
@@ -62,7 +62,7 @@ OCIO_ADD_TEST(FixedFunctionOp, darktodim10_cpu_engine)
     OCIO::FixedFunctionOp func(funcData);
     OCIO_CHECK_NO_THROW(func.finalize(OCIO::OPTIMIZATION_NONE));
 
-    OCIO::ConstOpCPURcPtr cpuOp = func.getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = func.getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_ACES_DarkToDim10_Fwd"));
@@ -254,7 +254,7 @@ OCIO_ADD_TEST(FixedFunctionOps, RGB_TO_HSV)
     OCIO_CHECK_ASSERT(op0->isInverse(op1));
     OCIO_CHECK_ASSERT(op1->isInverse(op0));
 
-    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_RGB_TO_HSV"));
@@ -280,7 +280,7 @@ OCIO_ADD_TEST(FixedFunctionOps, XYZ_TO_xyY)
     OCIO_CHECK_ASSERT(op0->isInverse(op1));
     OCIO_CHECK_ASSERT(op1->isInverse(op0));
 
-    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_XYZ_TO_xyY"));
@@ -306,7 +306,7 @@ OCIO_ADD_TEST(FixedFunctionOps, XYZ_TO_uvY)
     OCIO_CHECK_ASSERT(op0->isInverse(op1));
     OCIO_CHECK_ASSERT(op1->isInverse(op0));
 
-    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_XYZ_TO_uvY"));
@@ -332,7 +332,7 @@ OCIO_ADD_TEST(FixedFunctionOps, XYZ_TO_LUV)
     OCIO_CHECK_ASSERT(op0->isInverse(op1));
     OCIO_CHECK_ASSERT(op1->isInverse(op0));
 
-    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp();
+    OCIO::ConstOpCPURcPtr cpuOp = op0->getCPUOp(OCIO::OPTIMIZATION_NONE);
     const OCIO::OpCPU & c = *cpuOp;
     const std::string typeName(typeid(c).name());
     OCIO_CHECK_NE(-1, pystring::find(typeName, "Renderer_XYZ_TO_LUV"));
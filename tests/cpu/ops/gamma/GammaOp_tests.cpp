@@ -59,15 +59,6 @@ OCIO_ADD_TEST(GammaOp, apply_basic_style_fwd)
 
     const std::vector<double> gammaVals = { 1.2, 2.12, 1.123, 1.05 };
 
-#ifdef USE_SSE
-    const float expected_32f[numPixels*4] = {
-        0.0f,        0.0f,        0.0f,        0.0f,
-        0.0f,        0.0f,        0.00001478f, 0.48297336f,
-        0.00010933f, 0.00001323f, 0.03458935f, 0.73928129f,
-        0.18946611f, 0.23005184f, 0.72391760f, 1.00001204f,
-        0.76507961f, 0.89695119f, 1.00001264f, 1.53070319f,
-        1.00601125f, 1.10895324f, 1.57668686f, 0.0f  };
-#else
     const float expected_32f[numPixels*4] = {
         0.0f,        0.0f,        0.0f,        0.0f,
         0.0f,        0.0f,        0.00001478f, 0.48296818f,
@@ -81,7 +72,6 @@ OCIO_ADD_TEST(GammaOp, apply_basic_style_fwd)
         powf(input_32f[18], (float)gammaVals[2]),
         powf(input_32f[19], (float)gammaVals[3]),
         1.00600302f, 1.10897374f, 1.57670521f, 0.0f  };
-#endif
 
     OCIO::OpRcPtrVec ops;
 
@@ -119,15 +109,6 @@ OCIO_ADD_TEST(GammaOp, apply_basic_style_rev)
 
     const std::vector<double> gammaVals = { 1.2, 2.12, 1.123, 1.05 };
 
-#ifdef USE_SSE
-    const float expected_32f[numPixels*4] = {
-        0.0f,        0.0f,        0.0f,        0.0f,
-        0.0f,        0.0f,        0.00014792f, 0.51678240f,
-        0.00177476f, 0.08215060f, 0.06941742f, 0.76033723f, 
-        0.31498342f, 0.72111737f, 0.77400052f, 1.00001109f, 
-        0.83031141f, 0.97609287f, 1.00001061f, 1.47130167f, 
-        1.00417137f, 1.02327621f, 1.43483067f, 0.0f };
-#else
     const float expected_32f[numPixels*4] = {
         0.0f,        0.0f,        0.0f,        0.0f,
         0.0f,        0.0f,        0.00014792f, 0.51677888f,
@@ -141,7 +122,6 @@ OCIO_ADD_TEST(GammaOp, apply_basic_style_rev)
         powf(input_32f[18], (float)(1./gammaVals[2])),
         powf(input_32f[19], (float)(1./gammaVals[3])),
         1.00416493f, 1.02328109f, 1.43484282f, 0.0f };
-#endif
 
     OCIO::OpRcPtrVec ops;
 
@@ -177,15 +157,6 @@ OCIO_ADD_TEST(GammaOp, apply_moncurve_style_fwd)
          0.80f,    0.95f,    1.0f,       1.5f,
          1.005f,   1.05f,    1.5f,      -0.25f }; 
 
-#ifdef USE_SSE
-    const float expected_32f[numPixels*4] = {
-        -0.07738016f, -0.33144456f, -0.20408163f,  0.0f,
-        -0.00019345f,  0.0f,         0.00004081f,  0.49101364f, 
-         0.00003869f,  0.00220963f,  0.04081632f,  0.73652046f,
-         0.05087645f,  0.30550804f,  0.67475068f,  1.00001871f,
-         0.60383129f,  0.91060406f,  1.00002050f,  1.63147723f,
-         1.01142657f,  1.09394502f,  1.84183871f, -0.24550682f };
-#else
     const float expected_32f[numPixels*4] = {
         -0.07738015f, -0.33144456f, -0.20408163f,  0.0f,
         -0.00019345f,  0.0f,         0.00004081f,  0.49101364f, 
@@ -193,7 +164,6 @@ OCIO_ADD_TEST(GammaOp, apply_moncurve_style_fwd)
          0.05087607f,  0.30550399f,  0.67474484f,  1.0f,
          0.60382729f,  0.91061854f,  1.0f,         1.63146877f,
          1.01141202f,  1.09396457f,  1.84183657f, -0.24550682f };
-#endif
 
     OCIO::OpRcPtrVec ops;
 
@@ -228,15 +198,6 @@ OCIO_ADD_TEST(GammaOp, apply_moncurve_style_rev)
          0.80f,    0.95f,    1.0f,       1.5f,
          1.005f,   1.05f,    1.5f,      -0.25f }; 
 
-#ifdef USE_SSE
-    const float expected_32f[numPixels*4] = {
-        -6.18606853f, -1.69711625f, -0.30625000f,  0.0f,
-        -0.01546517f,  0.0f,         0.00006125f,  0.50915080f,
-         0.00309303f,  0.01131410f,  0.06125000f,  0.76366448f,
-         0.51735591f,  0.67569005f,  0.81243133f,  1.00001215f,
-         0.90233862f,  0.97234255f,  1.00000989f,  1.40423023f,
-         1.00229334f,  1.02690458f,  1.31464004f, -0.25457540f };
-#else
     const float expected_32f[numPixels*4] = {
         -6.18606853f, -1.69711625f, -0.30625000f,  0.0f,
         -0.01546517f,  0.0f,         0.00006125f,  0.50915080f,
@@ -247,7 +208,6 @@ OCIO_ADD_TEST(GammaOp, apply_moncurve_style_rev)
          0.90233647f,  0.97234553f,  1.0f,         1.40423405f,
 #else
          0.90233647f,  0.97234553f,  1.0f,         1.40423429f,
-#endif
 
          1.00228834f,  1.02691006f,  1.31464290f, -0.25457540f };
 #endif
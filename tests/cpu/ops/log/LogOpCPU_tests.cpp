@@ -26,7 +26,7 @@ void TestLog(float logBase)
     OCIO::ConstLogOpDataRcPtr logOp = std::make_shared<OCIO::LogOpData>(
         logBase, OCIO::TRANSFORM_DIR_FORWARD);
 
-    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp);
+    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp, true);
     pRenderer->apply(rgba, rgba, 8);
 
     const float minValue = std::numeric_limits<float>::min();
@@ -98,7 +98,7 @@ void TestAntiLog(float logBase)
     OCIO::ConstLogOpDataRcPtr logOp = std::make_shared<OCIO::LogOpData>(
         logBase, OCIO::TRANSFORM_DIR_INVERSE);
 
-    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp);
+    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp, true);
     pRenderer->apply(rgba, rgba, 8);
 
     // Relative error tolerance for the log2 approximation.
@@ -213,7 +213,7 @@ OCIO_ADD_TEST(LogOpCPU, log2lin_test)
     OCIO::ConstLogOpDataRcPtr logOp = std::make_shared<OCIO::LogOpData>(
         dir, base, paramsR, paramsG, paramsB);
 
-    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp);
+    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp, true);
     pRenderer->apply(rgba, rgba, 8);
 
     const OCIO::LogUtil::CTFParams::Params noParam;
@@ -341,7 +341,7 @@ OCIO_ADD_TEST(LogOpCPU, lin2log_test)
     OCIO::ConstLogOpDataRcPtr logOp = std::make_shared<OCIO::LogOpData>(
         dir, base, paramsR, paramsG, paramsB);
 
-    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp);
+    OCIO::ConstOpCPURcPtr pRenderer = OCIO::GetLogRenderer(logOp, true);
     pRenderer->apply(rgba, rgba, 8);
 
     const OCIO::LogUtil::CTFParams::Params noParam;
@@ -395,6 +395,54 @@ OCIO_ADD_TEST(LogOpCPU, lin2log_test)
     OCIO_CHECK_EQUAL(rgba[31], -inf);
 }
 
+OCIO_ADD_TEST(LogOpCPU, vectorized_kernels)
+{
+    // The renderers process several pixels at once (when the CPU allows it) and the
+    // remaining pixels one by one, so check that both paths give the same results.
+
+    OCIO::LogOpData::Params paramsR{ 0.5, 1.1, 0.02, 0.1 };
+    OCIO::LogOpData::Params paramsG{ 0.6, 1.2, 0.03, 0.2 };
+    OCIO::LogOpData::Params paramsB{ 0.7, 1.3, 0.04, 0.3 };
+
+    const std::vector<OCIO::ConstLogOpDataRcPtr> logOps{
+        std::make_shared<OCIO::LogOpData>(10.0, OCIO::TRANSFORM_DIR_FORWARD),
+        std::make_shared<OCIO::LogOpData>(10.0, OCIO::TRANSFORM_DIR_INVERSE),
+        std::make_shared<OCIO::LogOpData>(OCIO::TRANSFORM_DIR_FORWARD, 10.0,
+                                          paramsR, paramsG, paramsB),
+        std::make_shared<OCIO::LogOpData>(OCIO::TRANSFORM_DIR_INVERSE, 10.0,
+                                          paramsR, paramsG, paramsB) };
+
+    // An odd number of pixels to also process a remaining pixel.
+    constexpr long numPixels = 37;
+    std::vector<float> inImg(numPixels * 4);
+    for (size_t idx = 0; idx < inImg.size(); ++idx)
+    {
+        inImg[idx] = float(idx) / 64.0f - 0.25f;
+    }
+
+    for (OCIO::ConstLogOpDataRcPtr logOp : logOps)
+    {
+        for (bool fastLogExp : { true, false })
+        {
+            OCIO::ConstOpCPURcPtr renderer = OCIO::GetLogRenderer(logOp, fastLogExp);
+
+            std::vector<float> res(inImg);
+            renderer->apply(res.data(), res.data(), numPixels);
+
+            for (long pxl = 0; pxl < numPixels; ++pxl)
+            {
+                float ref[4];
+                renderer->apply(&inImg[4 * pxl], ref, 1);
+
+                for (long channel = 0; channel < 4; ++channel)
+                {
+                    OCIO_CHECK_CLOSE(res[4 * pxl + channel], ref[channel], 1e-6f);
+                }
+            }
+        }
+    }
+}
+
 // TODO: Test bitdepth support scaling - (logOp_Log_withScaling_test)
 // TODO: Test half support - (logOp_Log_withHalf_test)
 // TODO: Test bitdepth support scaling - (logOp_AntiLog_withScaling_test)
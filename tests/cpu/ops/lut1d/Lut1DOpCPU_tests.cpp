@@ -125,6 +125,63 @@ OCIO_ADD_TEST(GamutMapUtil, order3_test)
 
 }
 
+OCIO_ADD_TEST(GamutMapUtil, hue_adjust_test)
+{
+    // The hue adjustment of several pixels at once (which could be vectorized) must give the
+    // same results as the adjustment of each pixel.
+
+    const float posinf = std::numeric_limits<float>::infinity();
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+
+    const float values[] = { -1.f, 0.f, 0.25f, 0.5f, 2.f, posinf, -posinf, qnan };
+    constexpr size_t numValues = sizeof(values) / sizeof(float);
+
+    // All the channel orderings including the equal values, the infinities and the NaNs.
+    std::vector<float> RGB, RGB2;
+    for (size_t r = 0; r < numValues; ++r)
+    {
+        for (size_t g = 0; g < numValues; ++g)
+        {
+            for (size_t b = 0; b < numValues; ++b)
+            {
+                RGB.insert(RGB.end(), { values[r], values[g], values[b], 0.f });
+                RGB2.insert(RGB2.end(), { values[r] * 0.5f + 0.1f,
+                                          values[g] * 2.f,
+                                          values[b] - 0.3f,
+                                          values[r] });
+            }
+        }
+    }
+
+    // An odd number of pixels.
+    RGB.insert(RGB.end(), { 0.3f, 0.1f, 0.2f, 0.f });
+    RGB2.insert(RGB2.end(), { 0.6f, 0.2f, 0.3f, 1.f });
+
+    const long numPixels = long(RGB.size() / 4);
+
+    std::vector<float> res(RGB2);
+    OCIO::GamutMapUtils::HueAdjust(RGB.data(), res.data(), numPixels);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        float ref[4] = { RGB2[4 * idx], RGB2[4 * idx + 1], RGB2[4 * idx + 2], RGB2[4 * idx + 3] };
+        OCIO::GamutMapUtils::HueAdjust(&RGB[4 * idx], ref);
+
+        for (long channel = 0; channel < 4; ++channel)
+        {
+            const float val = res[4 * idx + channel];
+            if (OCIO::IsNan(ref[channel]))
+            {
+                OCIO_CHECK_ASSERT(OCIO::IsNan(val));
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(val, ref[channel]);
+            }
+        }
+    }
+}
+
 OCIO_ADD_TEST(Lut1DRenderer, nan_test)
 {
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(8);
@@ -2574,3 +2631,229 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_half_domain_hue_adjust)
     }
 }
 
+
+namespace
+{
+void CheckSearchIndex(const std::vector<float> & values, bool halfDomain, unsigned line)
+{
+    const float * start = values.data();
+    const float * end   = values.data() + values.size() - 1;
+
+    OCIO::LutSearchIndex index;
+    index.build(start, end, halfDomain);
+
+    std::vector<float> testValues{ -0.f, 0.f,
+                                   std::numeric_limits<float>::quiet_NaN(),
+                                   -std::numeric_limits<float>::quiet_NaN() };
+
+    // Test all the LUT entries, the values in-between and values slightly around them.
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        testValues.push_back(values[i]);
+        testValues.push_back(std::nextafter(values[i], -std::numeric_limits<float>::max()));
+        testValues.push_back(std::nextafter(values[i], std::numeric_limits<float>::max()));
+        if (i + 1 < values.size())
+        {
+            testValues.push_back((values[i] + values[i + 1]) / 2.f);
+        }
+    }
+
+    for (const float val : testValues)
+    {
+        // Same clamping as FindLutInv().
+        const float cv = std::min(std::max(val, *start), *end);
+
+        OCIO_CHECK_EQUAL_FROM(index.lowerBound(start, cv) - start,
+                              std::lower_bound(start, end, cv) - start, line);
+    }
+}
+}
+
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_search_index)
+{
+    // The accelerated search must always find the same entry as std::lower_bound().
+
+    // Increasing LUT with flat spots and negative values.
+    {
+        std::vector<float> values(1024);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const float x = (float)i / 1023.f;
+            values[i] = std::pow(std::max(x, 0.1f), 2.2f) * 4.f - 0.2f;
+        }
+        values[500] = values[501] = values[502];
+        CheckSearchIndex(values, false, __LINE__);
+    }
+
+    // Very small LUTs.
+    CheckSearchIndex({ 0.f, 1.f }, false, __LINE__);
+    CheckSearchIndex({ 0.5f, 0.5f, 0.5f }, false, __LINE__);
+    CheckSearchIndex({ -1.f, 0.f, 1.f }, true, __LINE__);
+
+    // Half domain like LUT spanning many orders of magnitude (both halves).
+    {
+        std::vector<float> values;
+        half h;
+        for (unsigned short bits = 0x7bff; bits > 0x8000; --bits)
+        {
+            h.setBits((unsigned short)(bits | 0x8000));
+            values.push_back(h);
+        }
+        for (unsigned short bits = 0; bits <= 0x7bff; ++bits)
+        {
+            h.setBits(bits);
+            values.push_back(h);
+        }
+        CheckSearchIndex(values, true, __LINE__);
+    }
+}
+
+#ifdef USE_SSE
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_half_code_avx2)
+{
+    if (!OCIO::Lut1DRendererHalfCodeAVX2::IsSupported())
+    {
+        return;
+    }
+
+    // The vectorized renderer must produce the same results as the reference one.
+
+    OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(
+        OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE, 65536);
+
+    float * values = &lut->getArray().getValues()[0];
+    half h;
+    for (unsigned i = 0; i < 65536; ++i)
+    {
+        h.setBits((unsigned short)i);
+        const float v = h;
+        values[i * 3 + 0] = v * 0.5f;
+        values[i * 3 + 1] = v < 0.f ? -std::sqrt(-v) : std::sqrt(v);
+        values[i * 3 + 2] = (float)(i % 7) - 3.f;
+    }
+
+    OCIO::ConstLut1DOpDataRcPtr lutConst = lut;
+    OCIO::ConstOpCPURcPtr renderer;
+    OCIO_CHECK_NO_THROW(renderer = OCIO::GetLut1DRenderer(lutConst,
+                                                          OCIO::BIT_DEPTH_F32,
+                                                          OCIO::BIT_DEPTH_F32));
+    OCIO_REQUIRE_ASSERT(renderer);
+    OCIO_CHECK_ASSERT(std::dynamic_pointer_cast<const OCIO::Lut1DRendererHalfCodeAVX2>(renderer));
+
+    const OCIO::Lut1DRendererHalfCode<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32> reference(lutConst);
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf  = std::numeric_limits<float>::infinity();
+
+    std::vector<float> inImg{ qnan, 0.5f, 0.3f, -0.2f,
+                              inf, -inf, 65504.f, qnan,
+                              65520.f, -65520.f, 65519.f, 1.f,
+                              0.f, -0.f, 1e-10f, -1e-10f,
+                              6.1e-5f, -6.1e-5f, 5.96e-8f, 2.f };
+
+    // Values all over the float range including half denormals and the values in-between.
+    for (int i = -2000; i < 2000; ++i)
+    {
+        inImg.push_back(std::pow(1.01f, (float)i));
+        inImg.push_back(-std::pow(1.0117f, (float)i));
+        inImg.push_back((float)i * 0.001f);
+        inImg.push_back((float)i * 0.25f);
+    }
+
+    // Odd number of pixels.
+    inImg.insert(inImg.end(), { 0.1f, 0.2f, 0.3f, 0.4f });
+
+    const long numPixels = (long)inImg.size() / 4;
+
+    std::vector<float> outImg(inImg.size()), refImg(inImg.size());
+    renderer->apply(inImg.data(), outImg.data(), numPixels);
+    reference.apply(inImg.data(), refImg.data(), numPixels);
+
+    for (size_t i = 0; i < inImg.size(); ++i)
+    {
+        if (OCIO::IsNan(refImg[i]))
+        {
+            OCIO_CHECK_ASSERT(OCIO::IsNan(outImg[i]));
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(outImg[i], refImg[i]);
+        }
+    }
+}
+#endif
+
+#ifdef USE_SSE
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_avx2)
+{
+    if (!OCIO::InvLut1DRendererAVX2::IsSupported())
+    {
+        return;
+    }
+
+    // The vectorized renderer must produce the same results as the reference one.
+
+    OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(4096);
+
+    // Increasing with a flat spot, decreasing, and flat start and end.
+    OCIO::Array::Values & vals = lutData->getArray().getValues();
+    for (unsigned i = 0; i < 4096; ++i)
+    {
+        const float x = (float)i / 4095.f;
+        vals[i * 3 + 0] = (i >= 1000 && i < 1010) ? 0.1f : std::pow(x, 2.2f) * 4.f - 0.2f;
+        vals[i * 3 + 1] = 1.f - std::sqrt(x);
+        vals[i * 3 + 2] = std::min(std::max(x * 1.5f - 0.25f, 0.f), 1.f);
+    }
+
+    auto invLut = lutData->inverse();
+    OCIO_CHECK_NO_THROW(invLut->finalize());
+    invLut->setInversionQuality(OCIO::LUT_INVERSION_EXACT);
+
+    OCIO::ConstLut1DOpDataRcPtr constInvLut = invLut;
+    OCIO::ConstOpCPURcPtr renderer;
+    OCIO_CHECK_NO_THROW(renderer = OCIO::GetLut1DRenderer(constInvLut,
+                                                          OCIO::BIT_DEPTH_F32,
+                                                          OCIO::BIT_DEPTH_F32));
+    OCIO_REQUIRE_ASSERT(renderer);
+    OCIO_CHECK_ASSERT(std::dynamic_pointer_cast<const OCIO::InvLut1DRendererAVX2>(renderer));
+
+    const OCIO::InvLut1DRenderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32> reference(constInvLut);
+
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf  = std::numeric_limits<float>::infinity();
+
+    std::vector<float> inImg{ qnan, 0.5f, 0.3f, -0.2f,
+                              inf, -inf, 3.8f, qnan,
+                              -0.2f, 1.f, 0.f, 1.f,
+                              0.1f, 0.f, 1.f, 0.5f };
+
+    for (int i = -1000; i < 6000; ++i)
+    {
+        inImg.push_back((float)i * 0.001f);
+        inImg.push_back((float)i * 0.0002f - 0.1f);
+        inImg.push_back((float)i * 0.0001f + 0.05f);
+        inImg.push_back((float)i);
+    }
+
+    // Number of pixels which is not a multiple of 8.
+    inImg.insert(inImg.end(), { 0.1f, 0.2f, 0.3f, 0.4f });
+
+    const long numPixels = (long)inImg.size() / 4;
+
+    std::vector<float> outImg(inImg.size()), refImg(inImg.size());
+    renderer->apply(inImg.data(), outImg.data(), numPixels);
+    reference.apply(inImg.data(), refImg.data(), numPixels);
+
+    for (size_t i = 0; i < inImg.size(); ++i)
+    {
+        if (OCIO::IsNan(refImg[i]))
+        {
+            OCIO_CHECK_ASSERT(OCIO::IsNan(outImg[i]));
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(outImg[i], refImg[i]);
+        }
+    }
+}
+#endif
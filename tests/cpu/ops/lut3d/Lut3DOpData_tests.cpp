@@ -69,6 +69,69 @@ OCIO_ADD_TEST(Lut3DOpData, clone)
     OCIO_CHECK_ASSERT(pClone->getArray()==ref.getArray());
 }
 
+OCIO_ADD_TEST(Lut3DOpData, shared_values)
+{
+    OCIO::ClearAllCaches();
+
+    unsigned long long refUnique = 0, refLogical = 0;
+    OCIO::GetLutMemoryUsage(refUnique, refLogical);
+
+    OCIO::Lut3DOpDataRcPtr lut1 = std::make_shared<OCIO::Lut3DOpData>(17);
+    lut1->getArray()[1] = 0.123f;
+
+    const OCIO::Lut3DOpData & constLut1 = *lut1;
+    const float * values1 = constLut1.getArray().getValues().data();
+
+    // The clone shares the values until they are modified.
+    OCIO::ConstLut3DOpDataRcPtr clone = lut1->clone();
+    OCIO_CHECK_EQUAL(clone->getArray().getValues().data(), values1);
+
+    lut1->getArray()[2] = 0.5f;
+    OCIO_CHECK_NE(constLut1.getArray().getValues().data(), values1);
+    OCIO_CHECK_EQUAL(clone->getArray().getValues().data(), values1);
+    OCIO_CHECK_EQUAL(clone->getArray()[2], 0.0f);
+
+    // LUTs created independently share the same values once finalized.
+    OCIO::Lut3DOpDataRcPtr lut2 = std::make_shared<OCIO::Lut3DOpData>(17);
+    lut2->getArray()[1] = 0.123f;
+    lut2->getArray()[2] = 0.5f;
+
+    OCIO_CHECK_NO_THROW(lut1->finalize());
+    OCIO_CHECK_NO_THROW(lut2->finalize());
+
+    const OCIO::Lut3DOpData & constLut2 = *lut2;
+    OCIO_CHECK_EQUAL(constLut2.getArray().getValues().data(),
+                     constLut1.getArray().getValues().data());
+    OCIO_CHECK_EQUAL(lut1->getCacheID(), lut2->getCacheID());
+
+    // Finalizing the LUT again does not copy the shared values.
+    const float * sharedValues = constLut1.getArray().getValues().data();
+    OCIO_CHECK_NO_THROW(lut1->finalize());
+    OCIO_CHECK_EQUAL(constLut1.getArray().getValues().data(), sharedValues);
+
+    const unsigned long long size = 17 * 17 * 17 * 3 * sizeof(float);
+
+    unsigned long long unique = 0, logical = 0;
+    OCIO::GetLutMemoryUsage(unique, logical);
+    OCIO_CHECK_EQUAL(unique - refUnique, size);
+    OCIO_CHECK_EQUAL(logical - refLogical, 2 * size);
+
+    // Modifying a LUT never modifies the other one.
+    lut2->getArray()[3] = 1.0f;
+    OCIO_CHECK_EQUAL(constLut1.getArray()[3], 0.0f);
+
+    OCIO::GetLutMemoryUsage(unique, logical);
+    OCIO_CHECK_EQUAL(unique - refUnique, size);
+    OCIO_CHECK_EQUAL(logical - refLogical, size);
+
+    lut1.reset();
+    OCIO::ClearAllCaches();
+
+    OCIO::GetLutMemoryUsage(unique, logical);
+    OCIO_CHECK_EQUAL(unique, refUnique);
+    OCIO_CHECK_EQUAL(logical, refLogical);
+}
+
 OCIO_ADD_TEST(Lut3DOpData, not_supported_length)
 {
     OCIO_CHECK_NO_THROW(OCIO::Lut3DOpData{ OCIO::Lut3DOpData::maxSupportedLength });
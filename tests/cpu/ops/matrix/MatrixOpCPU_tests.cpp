@@ -118,3 +118,161 @@ OCIO_ADD_TEST(MatrixOpCPU, matrix_renderer)
     OCIO_CHECK_EQUAL(rgba[3], 2.f);
 }
 
+
+namespace
+{
+
+// Process several pixels (i.e. including the remaining pixels of the vectorized versions)
+// and compare the results with the 4x4 matrix computed in double precision.
+void CheckMatrixRenderer(OCIO::ConstMatrixOpDataRcPtr & mat, const OCIO::ConstOpCPURcPtr & op)
+{
+    const OCIO::ArrayDouble::Values & m = mat->getArray().getValues();
+    const OCIO::MatrixOpData::Offsets & o = mat->getOffsets();
+
+    constexpr long numPixels = 7;
+
+    std::vector<float> rgba(4 * numPixels);
+    for (size_t idx = 0; idx < rgba.size(); ++idx)
+    {
+        rgba[idx] = float(idx) * 0.1f - 0.5f;
+    }
+    const std::vector<float> inImg(rgba);
+
+    // Process in place.
+    op->apply(&rgba[0], &rgba[0], numPixels);
+
+    for (long pxl = 0; pxl < numPixels; ++pxl)
+    {
+        const float * in = &inImg[4 * pxl];
+        for (unsigned long row = 0; row < 4; ++row)
+        {
+            const double res = in[0] * m[4 * row + 0] + in[1] * m[4 * row + 1]
+                               + in[2] * m[4 * row + 2] + in[3] * m[4 * row + 3] + o[row];
+            OCIO_CHECK_CLOSE(rgba[4 * pxl + row], float(res), 1e-6f);
+        }
+
+        // The result of a pixel does not depend on its position in the image (i.e. the
+        // vectorized and the remaining pixels versions give identical results).
+        float pixel[4] = { in[0], in[1], in[2], in[3] };
+        op->apply(pixel, pixel, 1);
+        for (unsigned long channel = 0; channel < 4; ++channel)
+        {
+            OCIO_CHECK_EQUAL(rgba[4 * pxl + channel], pixel[channel]);
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(MatrixOpCPU, matrix3x3_renderer)
+{
+    OCIO::MatrixOpDataRcPtr mat = std::make_shared<OCIO::MatrixOpData>();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.2, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    mat->setRGBA(m44);
+
+    OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+    OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+    OCIO_CHECK_ASSERT((bool)op);
+
+    const OCIO::Matrix3x3Renderer * matOp
+        = dynamic_cast<const OCIO::Matrix3x3Renderer *>(op.get());
+    OCIO_CHECK_ASSERT(matOp);
+    OCIO_CHECK_ASSERT(!dynamic_cast<const OCIO::Matrix3x3WithOffsetRenderer *>(op.get()));
+
+    CheckMatrixRenderer(m, op);
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, matrix3x3_with_offset_renderer)
+{
+    OCIO::MatrixOpDataRcPtr mat = std::make_shared<OCIO::MatrixOpData>();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.2, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    mat->setRGBA(m44);
+    const double offsets[4] = { 0.1, -0.2, 0.3, 0.0 };
+    mat->setRGBAOffsets(offsets);
+
+    OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+    OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+    OCIO_CHECK_ASSERT((bool)op);
+
+    const OCIO::Matrix3x3WithOffsetRenderer * matOp
+        = dynamic_cast<const OCIO::Matrix3x3WithOffsetRenderer *>(op.get());
+    OCIO_CHECK_ASSERT(matOp);
+    OCIO_CHECK_ASSERT(!dynamic_cast<const OCIO::BlockDiagonalRenderer *>(op.get()));
+
+    CheckMatrixRenderer(m, op);
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, block_diagonal_renderer)
+{
+    OCIO::MatrixOpDataRcPtr mat = std::make_shared<OCIO::MatrixOpData>();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.2, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 0.5 };
+    mat->setRGBA(m44);
+
+    {
+        OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+        OCIO_CHECK_ASSERT((bool)op);
+
+        const OCIO::BlockDiagonalRenderer * matOp
+            = dynamic_cast<const OCIO::BlockDiagonalRenderer *>(op.get());
+        OCIO_CHECK_ASSERT(matOp);
+
+        CheckMatrixRenderer(m, op);
+    }
+
+    // Only the alpha offset is not null.
+    mat->setArrayValue(15, 1.0);
+    mat->setOffsetValue(3, 0.25);
+
+    {
+        OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+        OCIO_CHECK_ASSERT((bool)op);
+
+        const OCIO::BlockDiagonalRenderer * matOp
+            = dynamic_cast<const OCIO::BlockDiagonalRenderer *>(op.get());
+        OCIO_CHECK_ASSERT(matOp);
+
+        CheckMatrixRenderer(m, op);
+    }
+
+    // The alpha channel depends on the RGB channels.
+    mat->setArrayValue(12, 0.1);
+
+    {
+        OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+        OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+        OCIO_CHECK_ASSERT((bool)op);
+
+        const OCIO::MatrixWithOffsetRenderer * matOp
+            = dynamic_cast<const OCIO::MatrixWithOffsetRenderer *>(op.get());
+        OCIO_CHECK_ASSERT(matOp);
+
+        CheckMatrixRenderer(m, op);
+    }
+}
+
+OCIO_ADD_TEST(MatrixOpCPU, offset_renderer)
+{
+    OCIO::MatrixOpDataRcPtr mat = std::make_shared<OCIO::MatrixOpData>();
+    const double offsets[4] = { 0.1, -0.2, 0.3, 0.4 };
+    mat->setRGBAOffsets(offsets);
+
+    OCIO::ConstMatrixOpDataRcPtr m = OCIO::DynamicPtrCast<const OCIO::MatrixOpData>(mat);
+    OCIO::ConstOpCPURcPtr op = OCIO::GetMatrixRenderer(m);
+    OCIO_CHECK_ASSERT((bool)op);
+
+    const OCIO::OffsetRenderer * offOp = dynamic_cast<const OCIO::OffsetRenderer *>(op.get());
+    OCIO_CHECK_ASSERT(offOp);
+
+    CheckMatrixRenderer(m, op);
+}
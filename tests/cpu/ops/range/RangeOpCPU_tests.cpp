@@ -457,3 +457,103 @@ OCIO_ADD_TEST(RangeOpCPU, high_clipping)
     OCIO_CHECK_CLOSE(image[11],  0.00f, g_error);
 }
 
+
+OCIO_ADD_TEST(RangeOpCPU, fused_renderer)
+{
+    const double empty = OCIO::RangeOpData::EmptyValue();
+
+    // The ranges of the tests above.
+    const std::vector<std::vector<double>> ranges = { { 0., 1., 0.5, 1.5 },
+                                                      { 0., empty, 0.5, empty },
+                                                      { empty, 1., empty, 1.5 },
+                                                      { 0., 1., -0.5, 0.5 },
+                                                      { 0.1, 1.1, 0.1, 1.1 },
+                                                      { 0.1, empty, 0.1, empty },
+                                                      { empty, 1.1, empty, 1.1 } };
+
+    // More pixels than a block of the fused renderer.
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    const float values[] = { -0.50f, -0.25f, 0.50f, 0.0f,
+                              0.75f,  1.00f, 1.25f, 1.0f,
+                              1.25f,  1.50f, 1.75f, 0.0f,
+                               qnan,   qnan,  qnan, 0.0f,
+                               0.0f,   0.0f,  0.0f, qnan,
+                                inf,    inf,   inf, 0.0f,
+                               0.0f,   0.0f,  0.0f,  inf,
+                               -inf,   -inf,  -inf, 0.0f,
+                               0.0f,   0.0f,  0.0f, -inf };
+    std::vector<float> inImg;
+    while (inImg.size() < 4 * 600)
+    {
+        inImg.insert(inImg.end(), std::begin(values), std::end(values));
+    }
+    const long numPixels = long(inImg.size() / 4);
+
+    OCIO::MatrixOpDataRcPtr mat = std::make_shared<OCIO::MatrixOpData>();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.1, 0.2, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    mat->setRGBA(m44);
+    OCIO::ConstMatrixOpDataRcPtr m = mat;
+    OCIO::ConstOpCPURcPtr matOp = OCIO::GetMatrixRenderer(m);
+
+    auto checkImages = [](const std::vector<float> & res, const std::vector<float> & ref)
+    {
+        for (size_t idx = 0; idx < ref.size(); ++idx)
+        {
+            if (OCIO::IsNan(ref[idx]))
+            {
+                OCIO_CHECK_ASSERT(OCIO::IsNan(res[idx]));
+            }
+            else
+            {
+                OCIO_CHECK_EQUAL(res[idx], ref[idx]);
+            }
+        }
+    };
+
+    for (const auto & values : ranges)
+    {
+        OCIO::RangeOpDataRcPtr range
+            = std::make_shared<OCIO::RangeOpData>(values[0], values[1], values[2], values[3]);
+        OCIO_CHECK_NO_THROW(range->validate());
+        OCIO_CHECK_NO_THROW(range->finalize());
+
+        OCIO::ConstRangeOpDataRcPtr r = range;
+        OCIO::ConstRangeOpDataRcPtr none;
+        OCIO::ConstOpCPURcPtr rangeOp = OCIO::GetRangeRenderer(r);
+
+        // The range as an input stage.
+        {
+            std::vector<float> ref(inImg.size());
+            rangeOp->apply(&inImg[0], &ref[0], numPixels);
+            matOp->apply(&ref[0], &ref[0], numPixels);
+
+            OCIO::ConstOpCPURcPtr op = OCIO::GetRangeFusedRenderer(r, matOp, none);
+
+            std::vector<float> res(inImg.size());
+            OCIO_CHECK_NO_THROW(op->apply(&inImg[0], &res[0], numPixels));
+            checkImages(res, ref);
+
+            // In place.
+            res = inImg;
+            OCIO_CHECK_NO_THROW(op->apply(&res[0], &res[0], numPixels));
+            checkImages(res, ref);
+        }
+
+        // The range as an output stage.
+        {
+            std::vector<float> ref(inImg.size());
+            matOp->apply(&inImg[0], &ref[0], numPixels);
+            rangeOp->apply(&ref[0], &ref[0], numPixels);
+
+            OCIO::ConstOpCPURcPtr op = OCIO::GetRangeFusedRenderer(none, matOp, r);
+
+            std::vector<float> res(inImg.size());
+            OCIO_CHECK_NO_THROW(op->apply(&inImg[0], &res[0], numPixels));
+            checkImages(res, ref);
+        }
+    }
+}
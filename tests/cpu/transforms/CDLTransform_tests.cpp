@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <thread>
+
 #include "transforms/CDLTransform.cpp"
 
 #include "UnitTest.h"
@@ -319,6 +321,91 @@ OCIO_ADD_TEST(CDLTransform, faulty_file_content)
     }
 }
 
+OCIO_ADD_TEST(CDLTransform, large_ccc_file)
+{
+    std::string filename;
+    OCIO_CHECK_NO_THROW(OCIO::Platform::CreateTempFilename(filename, ""));
+
+    static constexpr int NumCC = 20000;
+
+    {
+        std::fstream stream(filename, std::ios_base::out|std::ios_base::trunc);
+        stream << "<ColorCorrectionCollection>\n";
+        for (int i = 0; i < NumCC; ++i)
+        {
+            stream << "    <ColorCorrection id=\"shot" << i << "\">\n"
+                   << "        <SOPNode>\n"
+                   << "            <Slope>" << i << " 1 1</Slope>\n"
+                   << "            <Offset>0 0 0</Offset>\n"
+                   << "            <Power>1 1 1</Power>\n"
+                   << "        </SOPNode>\n"
+                   << "    </ColorCorrection>\n";
+        }
+        stream << "</ColorCorrectionCollection>\n";
+    }
+
+    OCIO::ClearAllCaches();
+
+    // The ids are concurrently resolved by several threads while the file is loaded.
+    static constexpr int NumThreads = 4;
+    std::vector<int> numErrors(NumThreads, 0);
+
+    // Each id is resolved by two threads, by id and by index.
+    auto lookups = [&](int idx)
+    {
+        for (int i = idx % 2; i < NumCC; i += 2)
+        {
+            try
+            {
+                const std::string id = "shot" + std::to_string(i);
+                auto cdl = OCIO::CDLTransform::CreateFromFile(filename.c_str(), id.c_str());
+
+                double slope[3] = { 0., 0., 0. };
+                cdl->getSlope(slope);
+
+                if (slope[0] != double(i) || cdl != OCIO::CDLTransform::CreateFromFile(
+                                                        filename.c_str(), std::to_string(i).c_str()))
+                {
+                    ++numErrors[idx];
+                }
+            }
+            catch (...)
+            {
+                ++numErrors[idx];
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int idx = 0; idx < NumThreads; ++idx)
+    {
+        threads.emplace_back(lookups, idx);
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int idx = 0; idx < NumThreads; ++idx)
+    {
+        OCIO_CHECK_EQUAL(numErrors[idx], 0);
+    }
+
+    // All the lookups share the same transforms.
+    OCIO_CHECK_EQUAL(OCIO::CDLTransform::CreateFromFile(filename.c_str(), "shot42"),
+                     OCIO::CDLTransform::CreateFromFile(filename.c_str(), "42"));
+
+    OCIO_CHECK_THROW_WHAT(OCIO::CDLTransform::CreateFromFile(filename.c_str(), "shot20000"),
+                          OCIO::Exception, "could not be loaded from the src file");
+    OCIO_CHECK_THROW_WHAT(OCIO::CDLTransform::CreateFromFile(filename.c_str(), "20000"),
+                          OCIO::Exception, "could not be loaded from the src file");
+    OCIO_CHECK_THROW_WHAT(OCIO::CDLTransform::CreateFromFile(filename.c_str(), "-1"),
+                          OCIO::Exception, "could not be loaded from the src file");
+
+    OCIO::ClearAllCaches();
+    std::remove(filename.c_str());
+}
+
 OCIO_ADD_TEST(CDLTransform, buildops)
 {
     auto cdl = OCIO::CDLTransform::Create();
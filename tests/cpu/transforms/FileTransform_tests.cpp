@@ -179,7 +179,7 @@ OCIO_ADD_TEST(FileTransform, all_formats)
     OCIO_CHECK_EQUAL(19, formatRegistry.getNumRawFormats());
     OCIO_CHECK_EQUAL(24, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_READ));
     OCIO_CHECK_EQUAL(10, formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_BAKE));
-    OCIO_CHECK_EQUAL(2,  formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_WRITE));
+    OCIO_CHECK_EQUAL(3,  formatRegistry.getNumFormats(OCIO::FORMAT_CAPABILITY_WRITE));
 
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("3dl", "flame"));
     OCIO_CHECK_ASSERT(FormatNameFoundByExtension("cc", "ColorCorrection"));
@@ -270,3 +270,104 @@ OCIO_ADD_TEST(FileTransform, validate)
     tr->setSrc("");
     OCIO_CHECK_THROW(tr->validate(), OCIO::Exception);
 }
+
+namespace
+{
+bool IsFileCached(const std::string & fileName)
+{
+    const std::string filepath = std::string(OCIO::getTestFilesDir()) + "/" + fileName;
+
+    OCIO::AutoMutex lock(OCIO::g_fileCacheLock);
+    return OCIO::g_fileCache.find(filepath) != OCIO::g_fileCache.end();
+}
+
+OCIO::ConstProcessorRcPtr GetGroupProcessor(const OCIO::StringVec & fileNames)
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    for (const auto & fileName : fileNames)
+    {
+        group->appendTransform(OCIO::CreateFileTransform(fileName));
+    }
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    config->setMajorVersion(2);
+
+    // Use search paths to resolve references.
+    config->addSearchPath(OCIO::getTestFilesDir());
+
+    return config->getProcessor(group);
+}
+} // anon.
+
+OCIO_ADD_TEST(FileTransform, lazy_loading)
+{
+    const OCIO::StringVec fileNames{ "logtolin_8to8.lut",
+                                     "iridas_3d.cube",
+                                     "references_some_inverted.ctf" };
+
+    // Reference with the files loaded when the processor is created.
+    OCIO::ClearAllCaches();
+    OCIO::SetLazyFileLoading(false);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = GetGroupProcessor(fileNames));
+    OCIO_CHECK_ASSERT(IsFileCached(fileNames[1]));
+
+    float ref[3]{ 0.1f, 0.5f, 0.9f };
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor()->applyRGB(ref));
+
+    OCIO::ClearAllCaches();
+    OCIO::SetLazyFileLoading(true);
+    OCIO_CHECK_ASSERT(OCIO::IsLazyFileLoading());
+
+    OCIO_CHECK_NO_THROW(proc = GetGroupProcessor(fileNames));
+
+    // The processor is identified without loading the files.
+    OCIO_CHECK_ASSERT(!proc->isNoOp());
+    const std::string cacheID = proc->getCacheID();
+    OCIO_CHECK_ASSERT(cacheID != "<NOOP>");
+
+    OCIO::ConstProcessorMetadataRcPtr metadata = proc->getProcessorMetadata();
+    OCIO_REQUIRE_EQUAL(metadata->getNumFiles(), 3);
+
+    for (const auto & fileName : fileNames)
+    {
+        OCIO_CHECK_ASSERT(!IsFileCached(fileName));
+    }
+
+    // The files are loaded when the ops are needed.
+    float res[3]{ 0.1f, 0.5f, 0.9f };
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor()->applyRGB(res));
+
+    for (const auto & fileName : fileNames)
+    {
+        OCIO_CHECK_ASSERT(IsFileCached(fileName));
+    }
+
+    OCIO_CHECK_EQUAL(res[0], ref[0]);
+    OCIO_CHECK_EQUAL(res[1], ref[1]);
+    OCIO_CHECK_EQUAL(res[2], ref[2]);
+
+    // The placeholders are replaced by the ops of the files.
+    OCIO_CHECK_NO_THROW(proc->getDefaultGPUProcessor());
+    OCIO_CHECK_ASSERT(proc->getNumTransforms() > 3);
+
+    // The cache id does not depend on when the files are loaded.
+    OCIO::ConstProcessorRcPtr loadedProc;
+    OCIO_CHECK_NO_THROW(loadedProc = GetGroupProcessor(fileNames));
+    OCIO_CHECK_NO_THROW(loadedProc->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(std::string(loadedProc->getCacheID()), cacheID);
+    OCIO_CHECK_EQUAL(std::string(proc->getCacheID()), cacheID);
+
+    // The errors are reported when the files are loaded, including the recursions.
+    OCIO_CHECK_NO_THROW(proc = GetGroupProcessor({ "reference_cycle_itself.ctf" }));
+    OCIO_CHECK_THROW_WHAT(proc->getDefaultCPUProcessor(), OCIO::Exception,
+                          "is creating a recursion");
+
+    OCIO_CHECK_NO_THROW(proc = GetGroupProcessor({ "array_missing_values.clf" }));
+    OCIO_CHECK_THROW_WHAT(proc->getDefaultCPUProcessor(), OCIO::Exception,
+                          "failed while loading ops");
+
+    OCIO::SetLazyFileLoading(false);
+    OCIO::ClearAllCaches();
+}